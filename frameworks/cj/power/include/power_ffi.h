@@ -23,6 +23,8 @@ extern "C" {
     bool FfiPowerIsActive();
     uint32_t FfiPowerGetPowerMode();
     bool FfiPowerIsStandby(int32_t &code);
+    void FfiPowerOnStateChange(int64_t callbackId, int32_t &code);
+    void FfiPowerOffStateChange(int64_t callbackId);
 }
 
 #endif
\ No newline at end of file
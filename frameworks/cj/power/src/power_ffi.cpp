@@ -13,12 +13,20 @@
  * limitations under the License.
  */
 
+#include <map>
+#include <mutex>
+
+#include "cj_lambda.h"
 #include "power_mgr_client.h"
+#include "power_state_subscription.h"
 #include "power_ffi.h"
 
 namespace OHOS {
 namespace PowerMgr {
 static PowerMgrClient& g_powerMgrClient = PowerMgrClient::GetInstance();
+// callback id of the CJ lambda to its entry in the process wide subscription
+static std::mutex g_stateListenerMutex;
+static std::map<int64_t, uint64_t> g_stateListeners;
 extern "C" {
     bool FfiPowerIsActive()
     {
@@ -28,7 +36,7 @@ extern "C" {
 
     uint32_t FfiPowerGetPowerMode()
     {
-        PowerMode mode = g_powerMgrClient.GetDeviceMode();
+        PowerMode mode = PowerStateSubscription::GetInstance().GetDeviceMode();
         return static_cast<uint32_t>(mode);
     }
 
@@ -41,6 +49,34 @@ extern "C" {
         }
         return isStandby;
     }
+
+    void FfiPowerOnStateChange(int64_t callbackId, int32_t &code)
+    {
+        std::lock_guard<std::mutex> lock(g_stateListenerMutex);
+        if (g_stateListeners.count(callbackId) != 0) {
+            return;
+        }
+        auto callback = CJLambda::Create(reinterpret_cast<void (*)(uint32_t)>(callbackId));
+        uint64_t id = 0;
+        PowerErrors errCode = PowerStateSubscription::GetInstance().Subscribe(
+            [callback](PowerState state) { callback(static_cast<uint32_t>(state)); }, id);
+        if (errCode != PowerErrors::ERR_OK) {
+            code = static_cast<int32_t>(errCode);
+            return;
+        }
+        g_stateListeners.emplace(callbackId, id);
+    }
+
+    void FfiPowerOffStateChange(int64_t callbackId)
+    {
+        std::lock_guard<std::mutex> lock(g_stateListenerMutex);
+        auto iter = g_stateListeners.find(callbackId);
+        if (iter == g_stateListeners.end()) {
+            return;
+        }
+        PowerStateSubscription::GetInstance().Unsubscribe(iter->second);
+        g_stateListeners.erase(iter);
+    }
 }
 } // namespace PowerMgr
 } // namespace OHOS
\ No newline at end of file
@@ -21,6 +21,9 @@
 #include "power_log.h"
 #include "power_mgr_client.h"
 #include "power_shutdown_callback.h"
+#include "power_state_subscription.h"
+#include <mutex>
+#include <vector>
 #include <fcntl.h>
 #include <sys/ioctl.h>
 #include <unistd.h>
@@ -36,6 +39,13 @@ namespace {
 static PowerMgrClient& g_powerMgrClient = PowerMgrClient::GetInstance();
 thread_local OHOS::sptr<PowerShutdownCallback> g_powerShutdownCallback = new (std::nothrow) PowerShutdownCallback();
 constexpr int32_t RESTORE_DEFAULT_SCREENOFF_TIME = -1;
+// the ArkTS 'stateChange' listeners and their entries in the process wide subscription
+struct StateListener {
+    ::taihe::callback<void(int32_t)> callback;
+    uint64_t id;
+};
+std::mutex g_stateListenerMutex;
+std::vector<StateListener> g_stateListeners;
 
 static void SetFrameworkBootStage(bool isReboot)
 {
@@ -124,7 +134,7 @@ void Suspend(optional_view<bool> isImmediate)
 
 DevicePowerMode GetPowerMode()
 {
-    PowerMode mode = g_powerMgrClient.GetDeviceMode();
+    PowerMode mode = PowerStateSubscription::GetInstance().GetDeviceMode();
     DevicePowerMode deviceMode(DevicePowerMode::key_t::MODE_NORMAL);
     switch (mode) {
         case PowerMode::NORMAL_MODE:
@@ -275,6 +285,40 @@ void UnregisterShutdownCallback(::taihe::optional_view<::taihe::callback<void(My
         POWER_HILOGI(FEATURE_SHUTDOWN, "UnRegisterShutdownCallback callBack is null");
     }
 }
+
+void OnStateChange(::taihe::callback_view<void(int32_t state)> callback)
+{
+    std::lock_guard<std::mutex> lock(g_stateListenerMutex);
+    ::taihe::callback<void(int32_t)> stateCallback = callback;
+    for (const auto& listener : g_stateListeners) {
+        if (listener.callback == stateCallback) {
+            return;
+        }
+    }
+    uint64_t id = 0;
+    PowerErrors code = PowerStateSubscription::GetInstance().Subscribe(
+        [stateCallback](OHOS::PowerMgr::PowerState state) { stateCallback(static_cast<int32_t>(state)); }, id);
+    if (code != PowerErrors::ERR_OK) {
+        POWER_HILOGE(FEATURE_POWER_STATE, "OnStateChange failed. code:%{public}d", static_cast<int32_t>(code));
+        taihe::set_business_error(static_cast<int32_t>(code), GetErrorMessage(code));
+        return;
+    }
+    g_stateListeners.push_back({stateCallback, id});
+}
+
+void OffStateChange(::taihe::optional_view<::taihe::callback<void(int32_t state)>> callback)
+{
+    // without a callback every listener is removed, an unknown callback removes none
+    std::lock_guard<std::mutex> lock(g_stateListenerMutex);
+    for (auto iter = g_stateListeners.begin(); iter != g_stateListeners.end();) {
+        if (callback.has_value() && !(iter->callback == callback.value())) {
+            ++iter;
+            continue;
+        }
+        PowerStateSubscription::GetInstance().Unsubscribe(iter->id);
+        iter = g_stateListeners.erase(iter);
+    }
+}
 }  // namespace
 
 // Since these macros are auto-generate, lint will cause false positive
@@ -295,4 +339,6 @@ TH_EXPORT_CPP_API_GetPowerConfig(GetPowerConfig);
 TH_EXPORT_CPP_API_SetPowerConfig(SetPowerConfig);
 TH_EXPORT_CPP_API_RegisterShutdownCallback(RegisterShutdownCallback);
 TH_EXPORT_CPP_API_UnregisterShutdownCallback(UnregisterShutdownCallback);
+TH_EXPORT_CPP_API_OnStateChange(OnStateChange);
+TH_EXPORT_CPP_API_OffStateChange(OffStateChange);
 // NOLINTEND
\ No newline at end of file
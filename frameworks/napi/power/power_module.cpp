@@ -103,6 +103,62 @@ static napi_value CreatePowerKeyFilteringStrategy(napi_env env, napi_value expor
     return exports;
 }
 
+static napi_value EnumPowerStateClassConstructor(napi_env env, napi_callback_info info)
+{
+    napi_value thisArg = nullptr;
+    void* data = nullptr;
+
+    napi_get_cb_info(env, info, nullptr, nullptr, &thisArg, &data);
+
+    napi_value global = nullptr;
+    napi_get_global(env, &global);
+
+    return thisArg;
+}
+
+// the values passed to the 'stateChange' listeners
+static napi_value CreatePowerState(napi_env env, napi_value exports)
+{
+    napi_value awake = nullptr;
+    napi_value freeze = nullptr;
+    napi_value inactive = nullptr;
+    napi_value standBy = nullptr;
+    napi_value doze = nullptr;
+    napi_value sleep = nullptr;
+    napi_value hibernate = nullptr;
+    napi_value shutdown = nullptr;
+    napi_value dim = nullptr;
+
+    napi_create_int32(env, (int32_t)PowerState::AWAKE, &awake);
+    napi_create_int32(env, (int32_t)PowerState::FREEZE, &freeze);
+    napi_create_int32(env, (int32_t)PowerState::INACTIVE, &inactive);
+    napi_create_int32(env, (int32_t)PowerState::STAND_BY, &standBy);
+    napi_create_int32(env, (int32_t)PowerState::DOZE, &doze);
+    napi_create_int32(env, (int32_t)PowerState::SLEEP, &sleep);
+    napi_create_int32(env, (int32_t)PowerState::HIBERNATE, &hibernate);
+    napi_create_int32(env, (int32_t)PowerState::SHUTDOWN, &shutdown);
+    napi_create_int32(env, (int32_t)PowerState::DIM, &dim);
+
+    napi_property_descriptor desc[] = {
+        DECLARE_NAPI_STATIC_PROPERTY("AWAKE", awake),
+        DECLARE_NAPI_STATIC_PROPERTY("FREEZE", freeze),
+        DECLARE_NAPI_STATIC_PROPERTY("INACTIVE", inactive),
+        DECLARE_NAPI_STATIC_PROPERTY("STAND_BY", standBy),
+        DECLARE_NAPI_STATIC_PROPERTY("DOZE", doze),
+        DECLARE_NAPI_STATIC_PROPERTY("SLEEP", sleep),
+        DECLARE_NAPI_STATIC_PROPERTY("HIBERNATE", hibernate),
+        DECLARE_NAPI_STATIC_PROPERTY("SHUTDOWN", shutdown),
+        DECLARE_NAPI_STATIC_PROPERTY("DIM", dim),
+    };
+    napi_value result = nullptr;
+    napi_define_class(env, "PowerState", NAPI_AUTO_LENGTH, EnumPowerStateClassConstructor, nullptr,
+        sizeof(desc) / sizeof(*desc), desc, &result);
+
+    napi_set_named_property(env, exports, "PowerState", result);
+
+    return exports;
+}
+
 EXTERN_C_START
 /*
  * function for module exports
@@ -134,10 +190,13 @@ static napi_value PowerInit(napi_env env, napi_value exports)
         DECLARE_NAPI_FUNCTION("refreshActivity", PowerNapi::RefreshActivity),
         DECLARE_NAPI_FUNCTION("setPowerKeyFilteringStrategy", PowerNapi::SetPowerKeyFilteringStrategy),
         DECLARE_NAPI_FUNCTION("registerShutdownCallback", PowerNapi::RegisterShutdownCallback),
-        DECLARE_NAPI_FUNCTION("unregisterShutdownCallback", PowerNapi::UnRegisterShutdownCallback)};
+        DECLARE_NAPI_FUNCTION("unregisterShutdownCallback", PowerNapi::UnRegisterShutdownCallback),
+        DECLARE_NAPI_FUNCTION("on", PowerNapi::On),
+        DECLARE_NAPI_FUNCTION("off", PowerNapi::Off)};
     NAPI_CALL(env, napi_define_properties(env, exports, sizeof(desc) / sizeof(desc[0]), desc));
     CreateDevicePowerMode(env, exports);
     CreatePowerKeyFilteringStrategy(env, exports);
+    CreatePowerState(env, exports);
     POWER_HILOGD(COMP_FWK, "The initialization of the Power module is complete");
 
     return exports;
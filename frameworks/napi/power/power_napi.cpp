@@ -20,6 +20,8 @@
 #include "power_common.h"
 #include "power_log.h"
 #include "power_mgr_client.h"
+#include "power_state_observer.h"
+#include "power_state_subscription.h"
 #include <fcntl.h>
 #include <sys/ioctl.h>
 #include <unistd.h>
@@ -44,6 +46,9 @@ constexpr uint32_t HIBERNATE_ARGC = 1;
 constexpr uint32_t REFRESH_ACTIVITY_ARGC = 1;
 constexpr uint32_t POWERRKEY_FILTERING_STRATEGY_ARGC = 1;
 constexpr uint32_t SHUTDOWN_CALLBACK_ARGC = 1;
+constexpr uint32_t EVENT_ON_ARGC = 2;
+constexpr uint32_t EVENT_OFF_MAX_ARGC = 2;
+const std::string STATE_CHANGE_EVENT = "stateChange";
 constexpr int32_t INDEX_0 = 0;
 constexpr int32_t INDEX_1 = 1;
 constexpr int32_t RESTORE_DEFAULT_SCREENOFF_TIME = -1;
@@ -158,6 +163,7 @@ napi_value PowerNapi::Reboot(napi_env env, napi_callback_info info)
 
 napi_value PowerNapi::IsActive(napi_env env, napi_callback_info info)
 {
+    // the cache would lag behind a wakeup or suspend this process just requested
     bool isScreen = g_powerMgrClient.IsScreenOn();
     napi_value napiValue;
     NAPI_CALL(env, napi_get_boolean(env, isScreen, &napiValue));
@@ -274,7 +280,7 @@ napi_value PowerNapi::SetPowerMode(napi_env env, napi_callback_info info)
 
 napi_value PowerNapi::GetPowerMode(napi_env env, napi_callback_info info)
 {
-    PowerMode mode = g_powerMgrClient.GetDeviceMode();
+    PowerMode mode = PowerStateSubscription::GetInstance().GetDeviceMode();
     napi_value napiValue;
     NAPI_CALL(env, napi_create_uint32(env, static_cast<uint32_t>(mode), &napiValue));
     return napiValue;
@@ -659,5 +665,53 @@ napi_value PowerNapi::UnRegisterShutdownCallback(napi_env env, napi_callback_inf
     }
     return result;
 }
+napi_value PowerNapi::On(napi_env env, napi_callback_info info)
+{
+    size_t argc = EVENT_ON_ARGC;
+    napi_value argv[argc];
+    NapiUtils::GetCallbackInfo(env, info, argc, argv);
+
+    NapiErrors errors;
+    if (argc != EVENT_ON_ARGC || !NapiUtils::CheckValueType(env, argv[INDEX_0], napi_string) ||
+        !NapiUtils::CheckValueType(env, argv[INDEX_1], napi_function)) {
+        POWER_HILOGE(FEATURE_POWER_STATE, "On ERR_PARAM_INVALID");
+        return errors.ThrowError(env, PowerErrors::ERR_PARAM_INVALID);
+    }
+    std::string type = NapiUtils::GetStringFromNapi(env, argv[INDEX_0]);
+    if (type != STATE_CHANGE_EVENT) {
+        POWER_HILOGE(FEATURE_POWER_STATE, "On unknown event %{public}s", type.c_str());
+        return errors.ThrowError(env, PowerErrors::ERR_PARAM_INVALID);
+    }
+    PowerErrors code = PowerStateObserver::GetInstance().Add(env, argv[INDEX_1]);
+    if (code != PowerErrors::ERR_OK) {
+        POWER_HILOGE(FEATURE_POWER_STATE, "On failed. code:%{public}d", static_cast<int32_t>(code));
+        return errors.ThrowError(env, code);
+    }
+    return nullptr;
+}
+
+napi_value PowerNapi::Off(napi_env env, napi_callback_info info)
+{
+    size_t argc = EVENT_OFF_MAX_ARGC;
+    napi_value argv[argc];
+    NapiUtils::GetCallbackInfo(env, info, argc, argv);
+
+    NapiErrors errors;
+    if (argc == INDEX_0 || !NapiUtils::CheckValueType(env, argv[INDEX_0], napi_string) ||
+        NapiUtils::GetStringFromNapi(env, argv[INDEX_0]) != STATE_CHANGE_EVENT) {
+        POWER_HILOGE(FEATURE_POWER_STATE, "Off ERR_PARAM_INVALID");
+        return errors.ThrowError(env, PowerErrors::ERR_PARAM_INVALID);
+    }
+    napi_value callback = nullptr;
+    if (argc == EVENT_OFF_MAX_ARGC && !NapiUtils::CheckValueType(env, argv[INDEX_1], napi_undefined)) {
+        if (!NapiUtils::CheckValueType(env, argv[INDEX_1], napi_function)) {
+            POWER_HILOGE(FEATURE_POWER_STATE, "Off ERR_PARAM_INVALID");
+            return errors.ThrowError(env, PowerErrors::ERR_PARAM_INVALID);
+        }
+        callback = argv[INDEX_1];
+    }
+    PowerStateObserver::GetInstance().Remove(env, callback);
+    return nullptr;
+}
 } // namespace PowerMgr
 } // namespace OHOS
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "power_state_observer.h"
+
+#include "power_log.h"
+#include "power_state_subscription.h"
+
+namespace OHOS {
+namespace PowerMgr {
+namespace {
+constexpr uint32_t STATE_CALLBACK_ARGC = 1;
+}
+
+PowerStateObserver& PowerStateObserver::GetInstance()
+{
+    static PowerStateObserver* instance = new PowerStateObserver();
+    return *instance;
+}
+
+PowerErrors PowerStateObserver::Add(napi_env env, napi_value callback)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& listener : listeners_) {
+        if (IsSameCallback(listener, env, callback)) {
+            return PowerErrors::ERR_OK;
+        }
+    }
+    auto listener = std::make_shared<Listener>();
+    listener->env = env;
+    if (napi_create_reference(env, callback, 1, &listener->callbackRef) != napi_ok) {
+        POWER_HILOGW(FEATURE_POWER_STATE, "Failed to create a JS callback reference");
+        return PowerErrors::ERR_PARAM_INVALID;
+    }
+    std::weak_ptr<Listener> weakListener = listener;
+    PowerErrors code = PowerStateSubscription::GetInstance().Subscribe(
+        [weakListener](PowerState state) { Post(weakListener, state); }, listener->id);
+    if (code != PowerErrors::ERR_OK) {
+        napi_delete_reference(env, listener->callbackRef);
+        return code;
+    }
+    listeners_.push_back(listener);
+    // listeners of a worker that exits without calling off are dropped with its env
+    if (cleanupEnvs_.insert(env).second) {
+        napi_add_env_cleanup_hook(env, OnEnvCleanup, env);
+    }
+    return PowerErrors::ERR_OK;
+}
+
+void PowerStateObserver::Remove(napi_env env, napi_value callback)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto iter = listeners_.begin(); iter != listeners_.end();) {
+        bool matched = (callback == nullptr) ? (*iter)->env == env : IsSameCallback(*iter, env, callback);
+        if (!matched) {
+            ++iter;
+            continue;
+        }
+        Release(*iter);
+        iter = listeners_.erase(iter);
+    }
+}
+
+void PowerStateObserver::Release(const std::shared_ptr<Listener>& listener)
+{
+    // events already posted to the JS thread see the listener inactive and are dropped
+    listener->active = false;
+    PowerStateSubscription::GetInstance().Unsubscribe(listener->id);
+    if (listener->callbackRef != nullptr) {
+        napi_delete_reference(listener->env, listener->callbackRef);
+        listener->callbackRef = nullptr;
+    }
+}
+
+bool PowerStateObserver::IsSameCallback(
+    const std::shared_ptr<Listener>& listener, napi_env env, napi_value callback) const
+{
+    if (listener->env != env || listener->callbackRef == nullptr) {
+        return false;
+    }
+    napi_value value = nullptr;
+    bool isEqual = false;
+    if (napi_get_reference_value(env, listener->callbackRef, &value) != napi_ok ||
+        napi_strict_equals(env, value, callback, &isEqual) != napi_ok) {
+        return false;
+    }
+    return isEqual;
+}
+
+void PowerStateObserver::Post(const std::weak_ptr<Listener>& weakListener, PowerState state)
+{
+    std::shared_ptr<Listener> listener = weakListener.lock();
+    if (listener == nullptr) {
+        return;
+    }
+    auto task = [listener, state]() { Call(listener, state); };
+    if (napi_send_event(listener->env, task, napi_eprio_high, "PowerStateChange") != napi_status::napi_ok) {
+        POWER_HILOGW(FEATURE_POWER_STATE, "napi_send_event failed, state=%{public}u", static_cast<uint32_t>(state));
+    }
+}
+
+void PowerStateObserver::Call(const std::shared_ptr<Listener>& listener, PowerState state)
+{
+    if (!listener->active || listener->callbackRef == nullptr) {
+        return;
+    }
+    napi_env env = listener->env;
+    napi_handle_scope scope = nullptr;
+    napi_open_handle_scope(env, &scope);
+    if (scope == nullptr) {
+        POWER_HILOGW(FEATURE_POWER_STATE, "scope is nullptr");
+        return;
+    }
+    napi_value callback = nullptr;
+    napi_value stateValue = nullptr;
+    napi_value callResult = nullptr;
+    if (napi_get_reference_value(env, listener->callbackRef, &callback) != napi_ok ||
+        napi_create_uint32(env, static_cast<uint32_t>(state), &stateValue) != napi_ok) {
+        POWER_HILOGW(FEATURE_POWER_STATE, "Failed to prepare the state change callback");
+        napi_close_handle_scope(env, scope);
+        return;
+    }
+    napi_status status = napi_call_function(env, nullptr, callback, STATE_CALLBACK_ARGC, &stateValue, &callResult);
+    if (status != napi_ok) {
+        POWER_HILOGW(FEATURE_POWER_STATE, "napi_call_function callback failed, status = %{public}d", status);
+    }
+    napi_close_handle_scope(env, scope);
+}
+
+void PowerStateObserver::OnEnvCleanup(void* data)
+{
+    napi_env env = static_cast<napi_env>(data);
+    PowerStateObserver& observer = GetInstance();
+    observer.Remove(env, nullptr);
+    std::lock_guard<std::mutex> lock(observer.mutex_);
+    observer.cleanupEnvs_.erase(env);
+}
+} // namespace PowerMgr
+} // namespace OHOS
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_POWER_MANAGER_POWER_STATE_OBSERVER_H
+#define POWERMGR_POWER_MANAGER_POWER_STATE_OBSERVER_H
+
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "napi/native_api.h"
+#include "napi/native_node_api.h"
+
+#include "power_errors.h"
+#include "power_state_machine_info.h"
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * The JS listeners of power.on('stateChange'). Each listener is one entry of the process wide
+ * PowerStateSubscription and is called on the thread of the env that added it.
+ */
+class PowerStateObserver {
+public:
+    static PowerStateObserver& GetInstance();
+
+    PowerErrors Add(napi_env env, napi_value callback);
+    // without a callback every listener of env is removed
+    void Remove(napi_env env, napi_value callback);
+
+private:
+    struct Listener {
+        napi_env env {nullptr};
+        napi_ref callbackRef {nullptr};
+        uint64_t id {0};
+        // only touched on the JS thread of env
+        bool active {true};
+    };
+
+    PowerStateObserver() = default;
+    ~PowerStateObserver() = default;
+
+    static void Post(const std::weak_ptr<Listener>& weakListener, PowerState state);
+    static void Call(const std::shared_ptr<Listener>& listener, PowerState state);
+    static void OnEnvCleanup(void* data);
+    bool IsSameCallback(const std::shared_ptr<Listener>& listener, napi_env env, napi_value callback) const;
+    void Release(const std::shared_ptr<Listener>& listener);
+
+    std::mutex mutex_;
+    std::vector<std::shared_ptr<Listener>> listeners_;
+    std::set<napi_env> cleanupEnvs_;
+};
+} // namespace PowerMgr
+} // namespace OHOS
+
+#endif // POWERMGR_POWER_MANAGER_POWER_STATE_OBSERVER_H
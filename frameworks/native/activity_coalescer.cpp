@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "activity_coalescer.h"
+
+#include <cstdlib>
+#include <string>
+
+#include "power_state_machine_info.h"
+#include "syspara/parameter.h"
+
+namespace OHOS {
+namespace PowerMgr {
+namespace {
+constexpr int32_t DECIMAL = 10;
+
+// a cached handle only touches the shared parameter area, no IPC to the parameter service
+int64_t ReadCachedParameter(CachedHandle handle, int64_t def)
+{
+    const char* value = (handle == nullptr) ? nullptr : CachedParameterGet(handle);
+    if (value == nullptr || value[0] == '\0') {
+        return def;
+    }
+    char* end = nullptr;
+    long long result = strtoll(value, &end, DECIMAL);
+    return (end == nullptr || *end != '\0') ? def : static_cast<int64_t>(result);
+}
+} // namespace
+
+ActivityCoalescer& ActivityCoalescer::GetInstance()
+{
+    static ActivityCoalescer* instance = []() {
+        std::string interval = std::to_string(MIN_TIME_MS_BETWEEN_USERACTIVITIES);
+        CachedHandle intervalHandle = CachedParameterCreate(REFRESH_ACTIVITY_INTERVAL_PARAM, interval.c_str());
+        CachedHandle serialHandle = CachedParameterCreate(POWER_STATE_SERIAL_PARAM, "0");
+        return new ActivityCoalescer(
+            [intervalHandle]() { return ReadCachedParameter(intervalHandle, MIN_TIME_MS_BETWEEN_USERACTIVITIES); },
+            [serialHandle]() { return static_cast<uint64_t>(ReadCachedParameter(serialHandle, 0)); });
+    }();
+    return *instance;
+}
+
+ActivityCoalescer::ActivityCoalescer(const IntervalReader& readInterval, const SerialReader& readSerial)
+    : readInterval_(readInterval), readSerial_(readSerial)
+{
+}
+
+bool ActivityCoalescer::ShouldSend(int64_t nowMs, uint64_t& stateSerial)
+{
+    stateSerial = readSerial_();
+    if (stateSerial != lastSerial_.load(std::memory_order_relaxed)) {
+        return true;
+    }
+    int64_t lastAcceptedMs = lastAcceptedMs_.load(std::memory_order_relaxed);
+    int64_t intervalMs = readInterval_();
+    if (lastAcceptedMs == 0 || intervalMs <= 0 || nowMs < lastAcceptedMs || nowMs - lastAcceptedMs >= intervalMs) {
+        return true;
+    }
+    coalescedCount_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void ActivityCoalescer::OnAccepted(int64_t sentMs, uint64_t stateSerial)
+{
+    lastAcceptedMs_.store(sentMs, std::memory_order_relaxed);
+    lastSerial_.store(stateSerial, std::memory_order_relaxed);
+}
+
+uint64_t ActivityCoalescer::GetCoalescedCount() const
+{
+    return coalescedCount_.load(std::memory_order_relaxed);
+}
+} // namespace PowerMgr
+} // namespace OHOS
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_POWER_MANAGER_ACTIVITY_COALESCER_H
+#define POWERMGR_POWER_MANAGER_ACTIVITY_COALESCER_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+#include <nocopyable.h>
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Drops the RefreshActivity calls of this process that the service would throttle anyway. Once the
+ * service accepted a refresh, it ignores every other one for the interval it publishes, so the
+ * client does not need to pay for the IPC. The first refresh after a power state change is always
+ * sent, the service resets its throttle on state changes as well.
+ */
+class ActivityCoalescer {
+public:
+    using IntervalReader = std::function<int64_t()>;
+    using SerialReader = std::function<uint64_t()>;
+
+    static ActivityCoalescer& GetInstance();
+
+    ActivityCoalescer(const IntervalReader& readInterval, const SerialReader& readSerial);
+    ~ActivityCoalescer() = default;
+
+    // false when a refresh accepted less than an interval ago makes the service drop this one,
+    // stateSerial is to be passed to OnAccepted
+    bool ShouldSend(int64_t nowMs, uint64_t& stateSerial);
+    // the service accepted the refresh that was sent at sentMs
+    void OnAccepted(int64_t sentMs, uint64_t stateSerial);
+    uint64_t GetCoalescedCount() const;
+
+private:
+    DISALLOW_COPY_AND_MOVE(ActivityCoalescer);
+
+    IntervalReader readInterval_;
+    SerialReader readSerial_;
+    std::atomic<int64_t> lastAcceptedMs_ {0};
+    std::atomic<uint64_t> lastSerial_ {0};
+    std::atomic<uint64_t> coalescedCount_ {0};
+};
+} // namespace PowerMgr
+} // namespace OHOS
+
+#endif // POWERMGR_POWER_MANAGER_ACTIVITY_COALESCER_H
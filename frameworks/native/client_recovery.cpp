@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "client_recovery.h"
+
+#include <algorithm>
+#include <random>
+#include <unistd.h>
+
+#include "power_log.h"
+#include "running_lock_registry.h"
+
+namespace OHOS {
+namespace PowerMgr {
+PowerClientRecovery& PowerClientRecovery::GetInstance()
+{
+    static PowerClientRecovery* instance = new PowerClientRecovery();
+    return *instance;
+}
+
+void PowerClientRecovery::AddCallback(
+    RestoreCallbackType type, const sptr<IRemoteObject>& callback, int32_t param, uint64_t displayId)
+{
+    if (callback == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = std::find_if(callbacks_.begin(), callbacks_.end(), [&](const RestoreCallbackEntry& entry) {
+        return entry.type == type && entry.callback == callback && entry.displayId == displayId;
+    });
+    if (iter != callbacks_.end()) {
+        iter->param = param;
+        return;
+    }
+    if (callbacks_.size() >= PowerRestoreSession::MAX_CALLBACK_NUM) {
+        POWER_HILOGW(COMP_FWK, "too many callbacks, type=%{public}u is not restored", static_cast<uint32_t>(type));
+        return;
+    }
+    callbacks_.push_back({type, callback, param, displayId});
+}
+
+void PowerClientRecovery::RemoveCallback(
+    RestoreCallbackType type, const sptr<IRemoteObject>& callback, uint64_t displayId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    callbacks_.erase(std::remove_if(callbacks_.begin(), callbacks_.end(), [&](const RestoreCallbackEntry& entry) {
+        return entry.type == type && entry.callback == callback && entry.displayId == displayId;
+    }), callbacks_.end());
+}
+
+size_t PowerClientRecovery::GetCallbackCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return callbacks_.size();
+}
+
+PowerRestoreSession PowerClientRecovery::BuildSession(const sptr<IPowerMgr>& proxy) const
+{
+    PowerRestoreSession session;
+    std::vector<std::shared_ptr<RunningLock>> locks = RunningLockRegistry::GetInstance().GetLiveLocks();
+    for (const auto& runningLock : locks) {
+        if (session.locks.size() >= PowerRestoreSession::MAX_LOCK_NUM) {
+            POWER_HILOGW(COMP_FWK, "too many running locks, the rest is not restored");
+            break;
+        }
+        if (runningLock->token_ == nullptr) {
+            continue;
+        }
+        runningLock->SetProxy(proxy);
+        session.locks.push_back({runningLock->token_, runningLock->runningLockInfo_});
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    session.callbacks = callbacks_;
+    return session;
+}
+
+bool PowerClientRecovery::Restore(const sptr<IPowerMgr>& proxy)
+{
+    if (proxy == nullptr) {
+        return false;
+    }
+    PowerRestoreSession session = BuildSession(proxy);
+    if (session.IsEmpty()) {
+        return true;
+    }
+    int32_t powerError = static_cast<int32_t>(PowerErrors::ERR_CONNECTION_FAIL);
+    int32_t ret = proxy->RestoreSessionIpc(session, powerError);
+    POWER_HILOGI(COMP_FWK, "restore session, locks=%{public}zu, callbacks=%{public}zu, ret=%{public}d, "
+        "powerError=%{public}d", session.locks.size(), session.callbacks.size(), ret, powerError);
+    return ret == ERR_OK && static_cast<PowerErrors>(powerError) == PowerErrors::ERR_OK;
+}
+
+uint32_t PowerClientRecovery::GetJitterMs() const
+{
+    static const uint32_t jitterMs = []() {
+        std::random_device device;
+        std::mt19937 engine(device() ^ static_cast<uint32_t>(getpid()));
+        std::uniform_int_distribution<uint32_t> distribution(0, RESTORE_JITTER_MAX_MS);
+        return distribution(engine);
+    }();
+    return jitterMs;
+}
+
+bool PowerClientRecovery::ScheduleRestore(const std::function<void()>& task)
+{
+    if (task == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(restoreMutex_);
+    if (restorePending_) {
+        return false;
+    }
+    uint32_t jitterMs = GetJitterMs();
+    POWER_HILOGI(COMP_FWK, "restore scheduled after %{public}u ms", jitterMs);
+    FFRTTask restoreTask = [this, task]() {
+        {
+            std::lock_guard<std::mutex> lock(restoreMutex_);
+            restorePending_ = false;
+        }
+        task();
+    };
+    restoreHandle_ = FFRTUtils::SubmitDelayTask(restoreTask, jitterMs, queue_);
+    restorePending_ = true;
+    return true;
+}
+
+void PowerClientRecovery::CancelRestore()
+{
+    std::lock_guard<std::mutex> lock(restoreMutex_);
+    if (!restorePending_) {
+        return;
+    }
+    FFRTUtils::CancelTask(restoreHandle_, queue_);
+    restorePending_ = false;
+    POWER_HILOGI(COMP_FWK, "pending restore cancelled");
+}
+} // namespace PowerMgr
+} // namespace OHOS
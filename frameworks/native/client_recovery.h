@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_POWER_MANAGER_CLIENT_RECOVERY_H
+#define POWERMGR_POWER_MANAGER_CLIENT_RECOVERY_H
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "ffrt_utils.h"
+#include "ipower_mgr.h"
+#include "power_restore_session.h"
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Restores the state of this process after the power service restarts. Callback registrations are
+ * recorded here, the running locks come from RunningLockRegistry, and both are sent in a single
+ * RestoreSessionIpc. The restore is delayed by a random jitter so that the processes of the device
+ * do not all reconnect at the same moment.
+ */
+class PowerClientRecovery {
+public:
+    static constexpr uint32_t RESTORE_JITTER_MAX_MS = 1000;
+
+    static PowerClientRecovery& GetInstance();
+
+    void AddCallback(RestoreCallbackType type, const sptr<IRemoteObject>& callback, int32_t param = 0,
+        uint64_t displayId = UINT64_MAX);
+    void RemoveCallback(RestoreCallbackType type, const sptr<IRemoteObject>& callback,
+        uint64_t displayId = UINT64_MAX);
+    size_t GetCallbackCount() const;
+
+    // snapshot of the live locks and the recorded callbacks, the locks are rebound to proxy
+    PowerRestoreSession BuildSession(const sptr<IPowerMgr>& proxy) const;
+    // send the session of this process, false if the service did not accept it
+    bool Restore(const sptr<IPowerMgr>& proxy);
+    // run task once after the jitter, further calls while one is pending are dropped
+    bool ScheduleRestore(const std::function<void()>& task);
+    // drop the pending restore, the service it was meant for died again
+    void CancelRestore();
+    uint32_t GetJitterMs() const;
+
+private:
+    PowerClientRecovery() = default;
+    ~PowerClientRecovery() = default;
+    DISALLOW_COPY_AND_MOVE(PowerClientRecovery);
+
+    mutable std::mutex mutex_;
+    std::vector<RestoreCallbackEntry> callbacks_;
+    std::mutex restoreMutex_;
+    bool restorePending_ {false}; // guard by restoreMutex_
+    FFRTHandle restoreHandle_; // guard by restoreMutex_
+    FFRTQueue queue_ {"power_client_recovery"};
+};
+} // namespace PowerMgr
+} // namespace OHOS
+
+#endif // POWERMGR_POWER_MANAGER_CLIENT_RECOVERY_H
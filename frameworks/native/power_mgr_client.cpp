@@ -17,6 +17,7 @@
 
 #include <sys/ioctl.h>
 #include <fcntl.h>
+#include <atomic>
 #include <cinttypes>
 #include <mutex>
 #include <memory>
@@ -28,6 +29,7 @@
 #include <if_system_ability_manager.h>
 #include <iservice_registry.h>
 #include <system_ability_definition.h>
+#include <system_ability_status_change_stub.h>
 #include "new"
 #include "refbase.h"
 #include "ipower_mgr.h"
@@ -39,21 +41,35 @@
 #include "iscreen_off_pre_callback.h"
 #include "power_log.h"
 #include "power_common.h"
+#include "activity_coalescer.h"
+#include "client_recovery.h"
 #include "running_lock_info.h"
+#include "running_lock_registry.h"
 #include "power_mgr_async_reply_stub.h"
+#include "power_state_subscription.h"
 
 #define SET_REBOOT _IOW(BOOT_DETECTOR_IOCTL_BASE, 109, int)
 
 namespace OHOS {
 namespace PowerMgr {
-std::vector<std::weak_ptr<RunningLock>> PowerMgrClient::runningLocks_;
-std::mutex PowerMgrClient::runningLocksMutex_;
 std::mutex g_instanceMutex;
 constexpr int32_t MAX_VERSION_STRING_SIZE = 4;
 constexpr int32_t MAX_SCENE_NAME_STRING_SIZE = 128;
 constexpr int32_t MAX_CONFIG_VALUE_STRING_SIZE = 128;
 constexpr uint32_t PARAM_MAX_NUM = 10;
 
+class PowerMgrClient::PowerMgrStatusListener : public SystemAbilityStatusChangeStub {
+public:
+    explicit PowerMgrStatusListener(PowerMgrClient& client) : client_(client) {}
+    ~PowerMgrStatusListener() override = default;
+    void OnAddSystemAbility(int32_t systemAbilityId, const std::string& deviceId) override;
+    void OnRemoveSystemAbility(int32_t systemAbilityId, const std::string& deviceId) override;
+
+private:
+    DISALLOW_COPY_AND_MOVE(PowerMgrStatusListener);
+    PowerMgrClient& client_;
+};
+
 PowerMgrClient::PowerMgrClient()
 {
     token_ = sptr<IPCObjectStub>::MakeSptr(u"ohos.powermgr.ClientAlivenessToken");
@@ -61,8 +77,9 @@ PowerMgrClient::PowerMgrClient()
 
 PowerMgrClient::~PowerMgrClient()
 {
-    if (proxy_ != nullptr) {
-        auto remoteObject = proxy_->AsObject();
+    sptr<IPowerMgr> proxy = LoadProxy();
+    if (proxy != nullptr) {
+        auto remoteObject = proxy->AsObject();
         if (remoteObject != nullptr) {
             remoteObject->RemoveDeathRecipient(deathRecipient_);
         }
@@ -86,98 +103,175 @@ ErrCode PowerMgrClient::Connect()
     return ERR_OK;
 }
 
+sptr<IPowerMgr> PowerMgrClient::LoadProxy() const
+{
+    auto snapshot = std::atomic_load(&proxy_);
+    return snapshot != nullptr ? *snapshot : sptr<IPowerMgr>(nullptr);
+}
+
+void PowerMgrClient::StoreProxy(const sptr<IPowerMgr>& proxy)
+{
+    std::atomic_store(&proxy_, proxy != nullptr ? std::make_shared<const sptr<IPowerMgr>>(proxy) : nullptr);
+}
+
 sptr<IPowerMgr> PowerMgrClient::GetPowerMgrProxy()
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (proxy_ != nullptr) {
-        return proxy_;
+    // fast path, a published snapshot is read without taking any lock
+    sptr<IPowerMgr> proxy = LoadProxy();
+    if (proxy != nullptr) {
+        return proxy;
     }
 
+    // slow path, only one caller connects and the others get its result
+    std::lock_guard<std::mutex> lock(mutex_);
+    proxy = LoadProxy();
+    if (proxy != nullptr) {
+        return proxy;
+    }
     sptr<ISystemAbilityManager> sam = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
     if (sam == nullptr) {
         POWER_HILOGE(COMP_FWK, "Failed to obtain SystemAbilityMgr");
-        return proxy_;
+        return nullptr;
     }
     sptr<IRemoteObject> remoteObject_ = sam->CheckSystemAbility(POWER_MANAGER_SERVICE_ID);
     if (remoteObject_ == nullptr) {
         POWER_HILOGE(COMP_FWK, "Check SystemAbility failed");
-        return proxy_;
+        return nullptr;
     }
 
     sptr<IRemoteObject::DeathRecipient> drt = new(std::nothrow) PowerMgrDeathRecipient(*this);
     if (drt == nullptr) {
         POWER_HILOGE(COMP_FWK, "Failed to create PowerMgrDeathRecipient");
-        return proxy_;
+        return nullptr;
     }
     if ((remoteObject_->IsProxyObject()) && (!remoteObject_->AddDeathRecipient(drt))) {
         POWER_HILOGE(COMP_FWK, "Add death recipient to PowerMgr service failed");
-        return proxy_;
+        return nullptr;
     }
 
-    proxy_ = iface_cast<IPowerMgr>(remoteObject_);
+    proxy = iface_cast<IPowerMgr>(remoteObject_);
     deathRecipient_ = drt;
+    StoreProxy(proxy);
     POWER_HILOGI(COMP_FWK, "Connecting PowerMgrService success, pid=%{public}d", getpid());
-    return proxy_;
+    return proxy;
+}
+
+void PowerMgrClient::PowerMgrStatusListener::OnAddSystemAbility(int32_t systemAbilityId, const std::string& deviceId)
+{
+    if (systemAbilityId != POWER_MANAGER_SERVICE_ID) {
+        return;
+    }
+    POWER_HILOGI(COMP_FWK, "PowerMgr service added");
+    client_.OnServiceAdded();
+}
+
+void PowerMgrClient::PowerMgrStatusListener::OnRemoveSystemAbility(
+    int32_t systemAbilityId, const std::string& deviceId)
+{
 }
 
 void PowerMgrClient::PowerMgrDeathRecipient::OnRemoteDied(const wptr<IRemoteObject>& remote)
 {
     POWER_HILOGW(COMP_FWK, "Recv death notice, PowerMgr Death");
-    client_.ResetProxy(remote);
-
-    // wait for powermgr service restart
-    ErrCode ret = E_GET_POWER_SERVICE_FAILED;
-    uint32_t retryCount = 0;
-    while (++retryCount <= CONNECT_RETRY_COUNT) {
-        usleep(CONNECT_RETRY_MS);
-        sptr<IPowerMgr> proxy = client_.GetPowerMgrProxy();
-        if (proxy != nullptr) {
-            POWER_HILOGI(COMP_FWK, "retry connect success, count %{public}d", retryCount);
-            ret = ERR_OK;
-            break;
-        }
-        POWER_HILOGI(COMP_FWK, "retry connect failed, count %{public}d", retryCount);
+    if (!client_.ResetProxy(remote)) {
+        return;
+    }
+    // the state changes are missed until the new service has the subscription again
+    PowerStateSubscription::GetInstance().InvalidateCache();
+    // the running locks are recovered once samgr reports the restarted service
+    PowerClientRecovery::GetInstance().CancelRestore();
+    client_.needRecover_.store(true);
+    client_.SubscribeServiceStatus();
+}
+
+void PowerMgrClient::SubscribeServiceStatus()
+{
+    std::lock_guard<std::mutex> lock(listenerMutex_);
+    if (statusListener_ != nullptr) {
+        return;
+    }
+    sptr<ISystemAbilityManager> sam = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
+    if (sam == nullptr) {
+        POWER_HILOGE(COMP_FWK, "Failed to obtain SystemAbilityMgr");
+        return;
+    }
+    sptr<PowerMgrStatusListener> listener = new (std::nothrow) PowerMgrStatusListener(*this);
+    if (listener == nullptr) {
+        POWER_HILOGE(COMP_FWK, "Failed to create PowerMgrStatusListener");
+        return;
     }
+    int32_t ret = sam->SubscribeSystemAbility(POWER_MANAGER_SERVICE_ID, listener);
     if (ret != ERR_OK) {
+        POWER_HILOGE(COMP_FWK, "Subscribe PowerMgr service failed, ret=%{public}d", ret);
         return;
     }
+    statusListener_ = listener;
+}
 
-    // recover running lock info
-    client_.RecoverRunningLocks();
+void PowerMgrClient::OnServiceAdded()
+{
+    // samgr also reports the service right after subscribing, only the first notice after a death recovers
+    if (!needRecover_.exchange(false)) {
+        return;
+    }
+    // staggered, so that the processes of the device do not all hit the new service at once
+    PowerClientRecovery::GetInstance().ScheduleRestore([this]() { RestoreSession(); });
+}
+
+void PowerMgrClient::RestoreSession()
+{
+    sptr<IPowerMgr> proxy = GetPowerMgrProxy();
+    if (proxy == nullptr) {
+        POWER_HILOGE(COMP_FWK, "reconnect failed");
+        needRecover_.store(true);
+        return;
+    }
+    if (!PowerClientRecovery::GetInstance().Restore(proxy)) {
+        POWER_HILOGW(COMP_FWK, "restore session failed, recover running locks one by one");
+        RecoverRunningLocks();
+    }
+    PowerStateSubscription::GetInstance().RefreshCache();
 }
 
 void PowerMgrClient::RecoverRunningLocks()
 {
     POWER_HILOGI(COMP_FWK, "start to recover running locks");
-    std::lock_guard<std::mutex> lock(runningLocksMutex_);
-    for (auto runningLock : runningLocks_) {
-        if (runningLock.expired()) {
-            continue;
-        }
-        std::shared_ptr<RunningLock> lock = runningLock.lock();
-        if (lock != nullptr) {
-            sptr<IPowerMgr> proxy = GetPowerMgrProxy();
-            RETURN_IF(proxy == nullptr);
-            lock->Recover(proxy);
-        }
+    std::vector<std::shared_ptr<RunningLock>> locks = RunningLockRegistry::GetInstance().GetLiveLocks();
+    for (const auto& lock : locks) {
+        sptr<IPowerMgr> proxy = GetPowerMgrProxy();
+        RETURN_IF(proxy == nullptr);
+        lock->Recover(proxy);
     }
 }
 
-void PowerMgrClient::ResetProxy(const wptr<IRemoteObject>& remote)
+size_t PowerMgrClient::GetLiveRunningLockCount()
+{
+    return RunningLockRegistry::GetInstance().GetLiveCount();
+}
+
+size_t PowerMgrClient::GetLiveRunningLockCount(RunningLockType type)
+{
+    return RunningLockRegistry::GetInstance().GetLiveCount(type);
+}
+
+bool PowerMgrClient::ResetProxy(const wptr<IRemoteObject>& remote)
 {
     if (remote == nullptr) {
         POWER_HILOGE(COMP_FWK, "OnRemoteDied failed, remote is nullptr");
-        return;
+        return false;
     }
 
     std::lock_guard<std::mutex> lock(mutex_);
-    RETURN_IF(proxy_ == nullptr);
+    sptr<IPowerMgr> proxy = LoadProxy();
+    RETURN_IF_WITH_RET(proxy == nullptr, false);
 
-    auto serviceRemote = proxy_->AsObject();
+    auto serviceRemote = proxy->AsObject();
     if ((serviceRemote != nullptr) && (serviceRemote == remote.promote())) {
         serviceRemote->RemoveDeathRecipient(deathRecipient_);
-        proxy_ = nullptr;
+        StoreProxy(nullptr);
+        return true;
     }
+    return false;
 }
 
 PowerErrors PowerMgrClient::RebootDevice(const std::string& reason)
@@ -315,12 +409,20 @@ void PowerMgrClient::WakeupDeviceAsync(WakeupDeviceType reason, const std::strin
 
 bool PowerMgrClient::RefreshActivity(UserActivityType type)
 {
+    int64_t now = GetTickCount();
+    uint64_t stateSerial = 0;
+    if (!ActivityCoalescer::GetInstance().ShouldSend(now, stateSerial)) {
+        POWER_HILOGD(FEATURE_ACTIVITY, "RefreshActivity coalesced");
+        return true;
+    }
     sptr<IPowerMgr> proxy = GetPowerMgrProxy();
     RETURN_IF_WITH_RET(proxy == nullptr, false);
     bool ret = false;
     int32_t activityType = static_cast<int32_t>(type);
-    int32_t result = proxy->RefreshActivityIpc(GetTickCount(), activityType, true);
+    int32_t result = proxy->RefreshActivityIpc(now, activityType, true);
     if (result == ERR_OK) {
+        // the service does not tell whether it throttled this one, at worst a refresh is dropped early
+        ActivityCoalescer::GetInstance().OnAccepted(now, stateSerial);
         ret = true;
     }
     POWER_HILOGD(FEATURE_ACTIVITY, "Calling RefreshActivity Success");
@@ -447,7 +549,7 @@ std::shared_ptr<RunningLock> PowerMgrClient::CreateRunningLock(const std::string
         return nullptr;
     }
     // Client CreateRunningLock
-    POWER_HILOGI(COMP_LOCK, "CrtN:%{public}s,T=%{public}d", name.c_str(), type);
+    POWER_HILOGI_LIMITED(COMP_LOCK, "CrtN:%{public}s,T=%{public}d", name.c_str(), type);
     auto error = runningLock->Init();
     if (error != PowerErrors::ERR_OK) {
         POWER_HILOGE(FEATURE_RUNNING_LOCK, "RunningLock init failed");
@@ -455,8 +557,7 @@ std::shared_ptr<RunningLock> PowerMgrClient::CreateRunningLock(const std::string
         return nullptr;
     }
 
-    std::lock_guard<std::mutex> lock(runningLocksMutex_);
-    runningLocks_.push_back(std::weak_ptr<RunningLock>(runningLock));
+    RunningLockRegistry::GetInstance().Add(runningLock);
     return runningLock;
 }
 
@@ -474,7 +575,8 @@ std::shared_ptr<RunningLock> PowerMgrClient::CreateRunningLock(
         POWER_HILOGE(FEATURE_RUNNING_LOCK, "Failed to create RunningLock record");
         return nullptr;
     }
-    POWER_HILOGI(COMP_LOCK, "CrtN:%{public}s,T=%{public}d,D=%{public}" PRIu64, name.c_str(), type, displayId);
+    POWER_HILOGI_LIMITED(COMP_LOCK, "CrtN:%{public}s,T=%{public}d,D=%{public}" PRIu64, name.c_str(), type,
+        displayId);
     auto error = runningLock->Init();
     if (error != PowerErrors::ERR_OK) {
         POWER_HILOGE(FEATURE_RUNNING_LOCK, "RunningLock init failed");
@@ -482,8 +584,7 @@ std::shared_ptr<RunningLock> PowerMgrClient::CreateRunningLock(
         return nullptr;
     }
 
-    std::lock_guard<std::mutex> lock(runningLocksMutex_);
-    runningLocks_.push_back(std::weak_ptr<RunningLock>(runningLock));
+    RunningLockRegistry::GetInstance().Add(runningLock);
     return runningLock;
 }
 #endif
@@ -523,13 +624,16 @@ bool PowerMgrClient::RegisterPowerStateCallback(const sptr<IPowerStateCallback>&
     sptr<IPowerMgr> proxy = GetPowerMgrProxy();
     RETURN_IF_WITH_RET((callback == nullptr) || (proxy == nullptr), false);
     int32_t ret = proxy->RegisterPowerStateCallbackIpc(callback, isSync);
-    return ret == ERR_OK;
+    RETURN_IF_WITH_RET(ret != ERR_OK, false);
+    PowerClientRecovery::GetInstance().AddCallback(RestoreCallbackType::POWER_STATE, callback->AsObject(), isSync);
+    return true;
 }
 
 bool PowerMgrClient::UnRegisterPowerStateCallback(const sptr<IPowerStateCallback>& callback)
 {
     sptr<IPowerMgr> proxy = GetPowerMgrProxy();
     RETURN_IF_WITH_RET((callback == nullptr) || (proxy == nullptr), false);
+    PowerClientRecovery::GetInstance().RemoveCallback(RestoreCallbackType::POWER_STATE, callback->AsObject());
     int32_t ret = proxy->UnRegisterPowerStateCallbackIpc(callback);
     return ret == ERR_OK;
 }
@@ -540,13 +644,17 @@ bool PowerMgrClient::RegisterSyncSleepCallback(const sptr<ISyncSleepCallback>& c
     RETURN_IF_WITH_RET((callback == nullptr) || (proxy == nullptr), false);
     int32_t priorityValue = static_cast<int32_t>(priority);
     int32_t ret = proxy->RegisterSyncSleepCallbackIpc(callback, priorityValue);
-    return ret == ERR_OK;
+    RETURN_IF_WITH_RET(ret != ERR_OK, false);
+    PowerClientRecovery::GetInstance().AddCallback(
+        RestoreCallbackType::SYNC_SLEEP, callback->AsObject(), priorityValue);
+    return true;
 }
 
 bool PowerMgrClient::UnRegisterSyncSleepCallback(const sptr<ISyncSleepCallback>& callback)
 {
     sptr<IPowerMgr> proxy = GetPowerMgrProxy();
     RETURN_IF_WITH_RET((callback == nullptr) || (proxy == nullptr), false);
+    PowerClientRecovery::GetInstance().RemoveCallback(RestoreCallbackType::SYNC_SLEEP, callback->AsObject());
     int32_t ret = proxy->UnRegisterSyncSleepCallbackIpc(callback);
     return ret == ERR_OK;
 }
@@ -561,7 +669,10 @@ bool PowerMgrClient::RegisterSuspendTakeoverCallback(const sptr<ITakeOverSuspend
         return false;
     }
     int32_t ret = proxy->RegisterSuspendTakeoverCallbackIpc(callback, static_cast<int>(priority));
-    return ret == ERR_OK;
+    RETURN_IF_WITH_RET(ret != ERR_OK, false);
+    PowerClientRecovery::GetInstance().AddCallback(
+        RestoreCallbackType::SUSPEND_TAKEOVER, callback->AsObject(), static_cast<int32_t>(priority));
+    return true;
 }
 
 bool PowerMgrClient::UnRegisterSuspendTakeoverCallback(const sptr<ITakeOverSuspendCallback>& callback)
@@ -572,6 +683,7 @@ bool PowerMgrClient::UnRegisterSuspendTakeoverCallback(const sptr<ITakeOverSuspe
         POWER_HILOGE(FEATURE_SUSPEND, "%{public}s callback or proxy is nullptr", __func__);
         return false;
     }
+    PowerClientRecovery::GetInstance().RemoveCallback(RestoreCallbackType::SUSPEND_TAKEOVER, callback->AsObject());
     int32_t ret = proxy->UnRegisterSuspendTakeoverCallbackIpc(callback);
     return ret == ERR_OK;
 }
@@ -588,13 +700,17 @@ bool PowerMgrClient::RegisterSyncHibernateCallback(const sptr<ISyncHibernateCall
     RETURN_IF_WITH_RET((callback == nullptr) || (proxy == nullptr), false);
     int32_t priorityValue = static_cast<int32_t>(priority);
     int32_t ret = proxy->RegisterSyncHibernateCallbackIpc(callback, priorityValue);
-    return ret == ERR_OK;
+    RETURN_IF_WITH_RET(ret != ERR_OK, false);
+    PowerClientRecovery::GetInstance().AddCallback(
+        RestoreCallbackType::SYNC_HIBERNATE, callback->AsObject(), priorityValue);
+    return true;
 }
 
 bool PowerMgrClient::UnRegisterSyncHibernateCallback(const sptr<ISyncHibernateCallback>& callback)
 {
     sptr<IPowerMgr> proxy = GetPowerMgrProxy();
     RETURN_IF_WITH_RET((callback == nullptr) || (proxy == nullptr), false);
+    PowerClientRecovery::GetInstance().RemoveCallback(RestoreCallbackType::SYNC_HIBERNATE, callback->AsObject());
     int32_t ret = proxy->UnRegisterSyncHibernateCallbackIpc(callback);
     return ret == ERR_OK;
 }
@@ -604,13 +720,16 @@ bool PowerMgrClient::RegisterPowerModeCallback(const sptr<IPowerModeCallback>& c
     sptr<IPowerMgr> proxy = GetPowerMgrProxy();
     RETURN_IF_WITH_RET((callback == nullptr) || (proxy == nullptr), false);
     int32_t ret = proxy->RegisterPowerModeCallbackIpc(callback);
-    return ret == ERR_OK;
+    RETURN_IF_WITH_RET(ret != ERR_OK, false);
+    PowerClientRecovery::GetInstance().AddCallback(RestoreCallbackType::POWER_MODE, callback->AsObject());
+    return true;
 }
 
 bool PowerMgrClient::UnRegisterPowerModeCallback(const sptr<IPowerModeCallback>& callback)
 {
     sptr<IPowerMgr> proxy = GetPowerMgrProxy();
     RETURN_IF_WITH_RET((callback == nullptr) || (proxy == nullptr), false);
+    PowerClientRecovery::GetInstance().RemoveCallback(RestoreCallbackType::POWER_MODE, callback->AsObject());
     int32_t ret = proxy->UnRegisterPowerModeCallbackIpc(callback);
     return ret == ERR_OK;
 }
@@ -621,7 +740,10 @@ bool PowerMgrClient::RegisterScreenStateCallback(int32_t remainTime, const sptr<
     RETURN_IF_WITH_RET((remainTime <= 0) || (callback == nullptr) || (proxy == nullptr), false);
     POWER_HILOGI(FEATURE_SCREEN_OFF_PRE, "Register screen off pre Callback by client");
     int32_t ret = proxy->RegisterScreenStateCallbackIpc(remainTime, callback);
-    return ret == ERR_OK;
+    RETURN_IF_WITH_RET(ret != ERR_OK, false);
+    PowerClientRecovery::GetInstance().AddCallback(
+        RestoreCallbackType::SCREEN_OFF_PRE, callback->AsObject(), remainTime);
+    return true;
 }
 
 bool PowerMgrClient::UnRegisterScreenStateCallback(const sptr<IScreenOffPreCallback>& callback)
@@ -629,6 +751,7 @@ bool PowerMgrClient::UnRegisterScreenStateCallback(const sptr<IScreenOffPreCallb
     sptr<IPowerMgr> proxy = GetPowerMgrProxy();
     RETURN_IF_WITH_RET((callback == nullptr) || (proxy == nullptr), false);
     POWER_HILOGI(FEATURE_SCREEN_OFF_PRE, "Unregister screen off pre Callback by client");
+    PowerClientRecovery::GetInstance().RemoveCallback(RestoreCallbackType::SCREEN_OFF_PRE, callback->AsObject());
     int32_t ret = proxy->UnRegisterScreenStateCallbackIpc(callback);
     return ret == ERR_OK;
 }
@@ -639,7 +762,9 @@ bool PowerMgrClient::RegisterRunningLockCallback(const sptr<IPowerRunninglockCal
     RETURN_IF_WITH_RET((callback == nullptr) || (proxy == nullptr), false);
     POWER_HILOGI(FEATURE_RUNNING_LOCK, "Register running lock Callback by client");
     int32_t ret = proxy->RegisterRunningLockCallbackIpc(callback);
-    return ret == ERR_OK;
+    RETURN_IF_WITH_RET(ret != ERR_OK, false);
+    PowerClientRecovery::GetInstance().AddCallback(RestoreCallbackType::RUNNING_LOCK, callback->AsObject());
+    return true;
 }
 
 bool PowerMgrClient::UnRegisterRunningLockCallback(const sptr<IPowerRunninglockCallback>& callback)
@@ -647,6 +772,7 @@ bool PowerMgrClient::UnRegisterRunningLockCallback(const sptr<IPowerRunninglockC
     sptr<IPowerMgr> proxy = GetPowerMgrProxy();
     RETURN_IF_WITH_RET((callback == nullptr) || (proxy == nullptr), false);
     POWER_HILOGI(FEATURE_RUNNING_LOCK, "Unregister running lock Callback by client");
+    PowerClientRecovery::GetInstance().RemoveCallback(RestoreCallbackType::RUNNING_LOCK, callback->AsObject());
     int32_t ret = proxy->UnRegisterRunningLockCallbackIpc(callback);
     return ret == ERR_OK;
 }
@@ -680,6 +806,10 @@ PowerErrors PowerMgrClient::SetDeviceMode(const PowerMode mode)
     int32_t powerError = static_cast<int32_t>(PowerErrors::ERR_CONNECTION_FAIL);
     int32_t modeValue = static_cast<int32_t>(mode);
     proxy->SetDeviceModeIpc(modeValue, powerError);
+    if (static_cast<PowerErrors>(powerError) == PowerErrors::ERR_OK) {
+        // the mode callback is oneway, do not let a cached GetDeviceMode lag behind our own change
+        PowerStateSubscription::GetInstance().OnModeChanged(mode);
+    }
     return static_cast<PowerErrors>(powerError);
 }
 
@@ -806,6 +936,9 @@ PowerErrors PowerMgrClient::RegisterUlsrCallback(const sptr<IUlsrCallback>& call
     int32_t powerError = static_cast<int32_t>(PowerErrors::ERR_CONNECTION_FAIL);
     int32_t priorityValue = static_cast<int32_t>(priority);
     proxy->RegisterUlsrCallbackIpc(callback, priorityValue, powerError);
+    if (static_cast<PowerErrors>(powerError) == PowerErrors::ERR_OK) {
+        PowerClientRecovery::GetInstance().AddCallback(RestoreCallbackType::ULSR, callback->AsObject(), priorityValue);
+    }
     return static_cast<PowerErrors>(powerError);
 }
 
@@ -816,17 +949,27 @@ PowerErrors PowerMgrClient::UnRegisterUlsrCallback(const sptr<IUlsrCallback>& ca
     RETURN_IF_WITH_RET(proxy == nullptr, PowerErrors::ERR_CONNECTION_FAIL);
     POWER_HILOGI(FEATURE_WAKEUP, "Unregister Ulsr Callback by client");
     int32_t powerError = static_cast<int32_t>(PowerErrors::ERR_CONNECTION_FAIL);
+    PowerClientRecovery::GetInstance().RemoveCallback(RestoreCallbackType::ULSR, callback->AsObject());
     proxy->UnRegisterUlsrCallbackIpc(callback, powerError);
     return static_cast<PowerErrors>(powerError);
 }
 
 PowerErrors PowerMgrClient::RefreshActivity(UserActivityType type, const std::string& refreshReason)
 {
+    int64_t now = GetTickCount();
+    uint64_t stateSerial = 0;
+    if (!ActivityCoalescer::GetInstance().ShouldSend(now, stateSerial)) {
+        // the answer of the service to a refresh inside its throttling interval
+        return PowerErrors::ERR_FREQUENT_FUNCTION_CALL;
+    }
     sptr<IPowerMgr> proxy = GetPowerMgrProxy();
     RETURN_IF_WITH_RET(proxy == nullptr, PowerErrors::ERR_CONNECTION_FAIL);
     int32_t activityType = static_cast<int32_t>(type);
     int32_t powerError = static_cast<int32_t>(PowerErrors::ERR_CONNECTION_FAIL);
-    proxy->RefreshActivityIpc(GetTickCount(), activityType, refreshReason, powerError);
+    proxy->RefreshActivityIpc(now, activityType, refreshReason, powerError);
+    if (static_cast<PowerErrors>(powerError) == PowerErrors::ERR_OK) {
+        ActivityCoalescer::GetInstance().OnAccepted(now, stateSerial);
+    }
     return static_cast<PowerErrors>(powerError);
 }
 
@@ -849,6 +992,10 @@ PowerErrors PowerMgrClient::RegisterAsyncShutdownCallback(
     int32_t powerError = static_cast<int32_t>(PowerErrors::ERR_CONNECTION_FAIL);
     int32_t priorityValue = static_cast<int32_t>(priority);
     proxy->RegisterAsyncShutdownCallbackIpc(callback, priorityValue, powerError);
+    if (static_cast<PowerErrors>(powerError) == PowerErrors::ERR_OK) {
+        PowerClientRecovery::GetInstance().AddCallback(
+            RestoreCallbackType::ASYNC_SHUTDOWN, callback->AsObject(), priorityValue);
+    }
     return static_cast<PowerErrors>(powerError);
 }
 
@@ -858,6 +1005,7 @@ PowerErrors PowerMgrClient::UnRegisterAsyncShutdownCallback(const sptr<IAsyncShu
     RETURN_IF_WITH_RET(callback == nullptr, PowerErrors::ERR_PARAM_INVALID);
     RETURN_IF_WITH_RET(proxy == nullptr, PowerErrors::ERR_CONNECTION_FAIL);
     int32_t powerError = static_cast<int32_t>(PowerErrors::ERR_CONNECTION_FAIL);
+    PowerClientRecovery::GetInstance().RemoveCallback(RestoreCallbackType::ASYNC_SHUTDOWN, callback->AsObject());
     proxy->UnRegisterAsyncShutdownCallbackIpc(callback, powerError);
     return static_cast<PowerErrors>(powerError);
 }
@@ -881,6 +1029,10 @@ PowerErrors PowerMgrClient::RegisterRunningLockChangedCallback(
     RETURN_IF_WITH_RET(proxy == nullptr, PowerErrors::ERR_CONNECTION_FAIL);
     int32_t powerError = static_cast<int32_t>(PowerErrors::ERR_CONNECTION_FAIL);
     proxy->RegisterRunningLockChangedCallbackIpc(callback, displayId, powerError);
+    if (static_cast<PowerErrors>(powerError) == PowerErrors::ERR_OK) {
+        PowerClientRecovery::GetInstance().AddCallback(
+            RestoreCallbackType::RUNNING_LOCK_CHANGED, callback->AsObject(), 0, displayId);
+    }
     return static_cast<PowerErrors>(powerError);
 #else
     return PowerErrors::ERR_OK;
@@ -895,6 +1047,8 @@ PowerErrors PowerMgrClient::UnRegisterRunningLockChangedCallback(
     RETURN_IF_WITH_RET(callback == nullptr, PowerErrors::ERR_PARAM_INVALID);
     RETURN_IF_WITH_RET(proxy == nullptr, PowerErrors::ERR_CONNECTION_FAIL);
     int32_t powerError = static_cast<int32_t>(PowerErrors::ERR_CONNECTION_FAIL);
+    PowerClientRecovery::GetInstance().RemoveCallback(
+        RestoreCallbackType::RUNNING_LOCK_CHANGED, callback->AsObject(), displayId);
     proxy->UnRegisterRunningLockChangedCallbackIpc(callback, displayId, powerError);
     return static_cast<PowerErrors>(powerError);
 #else
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "power_restore_session.h"
+
+#include <message_parcel.h>
+
+#include "new"
+#include "power_common.h"
+#include "power_log.h"
+
+namespace OHOS {
+namespace PowerMgr {
+bool PowerRestoreSession::ReadFromParcel(Parcel& parcel)
+{
+    auto& messageParcel = static_cast<MessageParcel&>(parcel);
+    uint32_t lockNum = 0;
+    RETURN_IF_READ_PARCEL_FAILED_WITH_RET(parcel, Uint32, lockNum, false);
+    if (lockNum > MAX_LOCK_NUM) {
+        POWER_HILOGE(COMP_FWK, "restore lock num exceed limit, num=%{public}u", lockNum);
+        return false;
+    }
+    locks.clear();
+    locks.reserve(lockNum);
+    for (uint32_t index = 0; index < lockNum; index++) {
+        RestoreLockEntry entry;
+        entry.token = messageParcel.ReadRemoteObject();
+        if (entry.token == nullptr || !entry.info.ReadFromParcel(parcel)) {
+            POWER_HILOGE(COMP_FWK, "read restore lock failed, index=%{public}u", index);
+            return false;
+        }
+        locks.push_back(std::move(entry));
+    }
+
+    uint32_t callbackNum = 0;
+    RETURN_IF_READ_PARCEL_FAILED_WITH_RET(parcel, Uint32, callbackNum, false);
+    if (callbackNum > MAX_CALLBACK_NUM) {
+        POWER_HILOGE(COMP_FWK, "restore callback num exceed limit, num=%{public}u", callbackNum);
+        return false;
+    }
+    callbacks.clear();
+    callbacks.reserve(callbackNum);
+    for (uint32_t index = 0; index < callbackNum; index++) {
+        RestoreCallbackEntry entry;
+        uint32_t type = 0;
+        RETURN_IF_READ_PARCEL_FAILED_WITH_RET(parcel, Uint32, type, false);
+        if (type >= static_cast<uint32_t>(RestoreCallbackType::BUTT)) {
+            POWER_HILOGE(COMP_FWK, "invalid restore callback type=%{public}u", type);
+            return false;
+        }
+        entry.type = static_cast<RestoreCallbackType>(type);
+        RETURN_IF_READ_PARCEL_FAILED_WITH_RET(parcel, Int32, entry.param, false);
+        RETURN_IF_READ_PARCEL_FAILED_WITH_RET(parcel, Uint64, entry.displayId, false);
+        entry.callback = messageParcel.ReadRemoteObject();
+        if (entry.callback == nullptr) {
+            POWER_HILOGE(COMP_FWK, "read restore callback failed, index=%{public}u", index);
+            return false;
+        }
+        callbacks.push_back(std::move(entry));
+    }
+    return true;
+}
+
+bool PowerRestoreSession::Marshalling(Parcel& parcel) const
+{
+    if (locks.size() > MAX_LOCK_NUM || callbacks.size() > MAX_CALLBACK_NUM) {
+        POWER_HILOGE(COMP_FWK, "restore session exceed limit, locks=%{public}zu, callbacks=%{public}zu",
+            locks.size(), callbacks.size());
+        return false;
+    }
+    auto& messageParcel = static_cast<MessageParcel&>(parcel);
+    RETURN_IF_WRITE_PARCEL_FAILED_WITH_RET(parcel, Uint32, static_cast<uint32_t>(locks.size()), false);
+    for (const auto& entry : locks) {
+        if (!messageParcel.WriteRemoteObject(entry.token) || !entry.info.Marshalling(parcel)) {
+            POWER_HILOGE(COMP_FWK, "write restore lock failed");
+            return false;
+        }
+    }
+    RETURN_IF_WRITE_PARCEL_FAILED_WITH_RET(parcel, Uint32, static_cast<uint32_t>(callbacks.size()), false);
+    for (const auto& entry : callbacks) {
+        RETURN_IF_WRITE_PARCEL_FAILED_WITH_RET(parcel, Uint32, static_cast<uint32_t>(entry.type), false);
+        RETURN_IF_WRITE_PARCEL_FAILED_WITH_RET(parcel, Int32, entry.param, false);
+        RETURN_IF_WRITE_PARCEL_FAILED_WITH_RET(parcel, Uint64, entry.displayId, false);
+        if (!messageParcel.WriteRemoteObject(entry.callback)) {
+            POWER_HILOGE(COMP_FWK, "write restore callback failed");
+            return false;
+        }
+    }
+    return true;
+}
+
+PowerRestoreSession* PowerRestoreSession::Unmarshalling(Parcel& parcel)
+{
+    PowerRestoreSession* session = new (std::nothrow) PowerRestoreSession();
+    if (session == nullptr) {
+        return nullptr;
+    }
+    if (!session->ReadFromParcel(parcel)) {
+        delete session;
+        return nullptr;
+    }
+    return session;
+}
+} // namespace PowerMgr
+} // namespace OHOS
@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "power_state_subscription.h"
+
+#include <cinttypes>
+#include <vector>
+
+#include "new"
+#include "power_log.h"
+#include "power_mgr_client.h"
+#include "power_mode_callback_stub.h"
+#include "power_state_callback_stub.h"
+
+namespace OHOS {
+namespace PowerMgr {
+namespace {
+class ClientPowerStateSource : public PowerStateSource {
+public:
+    bool RegisterStateCallback(const sptr<IPowerStateCallback>& callback) override
+    {
+        return PowerMgrClient::GetInstance().RegisterPowerStateCallback(callback, false);
+    }
+    void UnRegisterStateCallback(const sptr<IPowerStateCallback>& callback) override
+    {
+        PowerMgrClient::GetInstance().UnRegisterPowerStateCallback(callback);
+    }
+    bool RegisterModeCallback(const sptr<IPowerModeCallback>& callback) override
+    {
+        return PowerMgrClient::GetInstance().RegisterPowerModeCallback(callback);
+    }
+    void UnRegisterModeCallback(const sptr<IPowerModeCallback>& callback) override
+    {
+        PowerMgrClient::GetInstance().UnRegisterPowerModeCallback(callback);
+    }
+    bool IsScreenOn() override
+    {
+        return PowerMgrClient::GetInstance().IsScreenOn();
+    }
+    PowerState GetState() override
+    {
+        return PowerMgrClient::GetInstance().GetState();
+    }
+    PowerMode GetDeviceMode() override
+    {
+        return PowerMgrClient::GetInstance().GetDeviceMode();
+    }
+};
+
+// the owner detaches itself before it is destroyed, the service may still hold the callback
+template<typename Base>
+class OwnedCallback : public Base {
+public:
+    explicit OwnedCallback(PowerStateSubscription* owner) : owner_(owner) {}
+    void Detach()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        owner_ = nullptr;
+    }
+
+protected:
+    template<typename Func>
+    void WithOwner(Func&& func)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (owner_ != nullptr) {
+            func(*owner_);
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    PowerStateSubscription* owner_;
+};
+
+class SubscriptionStateCallback : public OwnedCallback<PowerStateCallbackStub> {
+public:
+    using OwnedCallback::OwnedCallback;
+    void OnAsyncPowerStateChanged(PowerState state) override
+    {
+        WithOwner([state](PowerStateSubscription& owner) { owner.OnStateChanged(state); });
+    }
+};
+
+class SubscriptionModeCallback : public OwnedCallback<PowerModeCallbackStub> {
+public:
+    using OwnedCallback::OwnedCallback;
+    void OnPowerModeChanged(PowerMode mode) override
+    {
+        WithOwner([mode](PowerStateSubscription& owner) { owner.OnModeChanged(mode); });
+    }
+};
+
+// states the service only enters with the screen off, FREEZE and UNKNOWN keep the last answer
+bool IsScreenOffState(PowerState state)
+{
+    switch (state) {
+        case PowerState::INACTIVE:
+        case PowerState::STAND_BY:
+        case PowerState::DOZE:
+        case PowerState::SLEEP:
+        case PowerState::HIBERNATE:
+        case PowerState::SHUTDOWN:
+            return true;
+        default:
+            return false;
+    }
+}
+} // namespace
+
+PowerStateSubscription& PowerStateSubscription::GetInstance()
+{
+    // never destroyed, the listeners of static objects may still unsubscribe during exit
+    static PowerStateSubscription* instance = new PowerStateSubscription();
+    return *instance;
+}
+
+PowerStateSubscription::PowerStateSubscription() : PowerStateSubscription(std::make_unique<ClientPowerStateSource>())
+{
+}
+
+PowerStateSubscription::PowerStateSubscription(std::unique_ptr<PowerStateSource> source) : source_(std::move(source))
+{
+    stateCallback_ = new (std::nothrow) SubscriptionStateCallback(this);
+    modeCallback_ = new (std::nothrow) SubscriptionModeCallback(this);
+}
+
+PowerStateSubscription::~PowerStateSubscription()
+{
+    {
+        std::lock_guard<std::mutex> lock(registerMutex_);
+        Unregister();
+    }
+    if (stateCallback_ != nullptr) {
+        static_cast<SubscriptionStateCallback*>(stateCallback_.GetRefPtr())->Detach();
+    }
+    if (modeCallback_ != nullptr) {
+        static_cast<SubscriptionModeCallback*>(modeCallback_.GetRefPtr())->Detach();
+    }
+}
+
+PowerErrors PowerStateSubscription::Subscribe(const StateListener& listener, uint64_t& id)
+{
+    if (listener == nullptr) {
+        return PowerErrors::ERR_PARAM_INVALID;
+    }
+    std::lock_guard<std::mutex> lock(registerMutex_);
+    if (!registered_ && !Register()) {
+        // the service refuses power state callbacks without ohos.permission.POWER_MANAGER
+        return PowerErrors::ERR_PERMISSION_DENIED;
+    }
+    std::lock_guard<std::mutex> listenerLock(listenerMutex_);
+    id = nextId_++;
+    listeners_.emplace(id, std::make_shared<StateListener>(listener));
+    POWER_HILOGD(FEATURE_POWER_STATE, "state listener %{public}" PRIu64 " subscribed, count=%{public}zu", id,
+        listeners_.size());
+    return PowerErrors::ERR_OK;
+}
+
+void PowerStateSubscription::Unsubscribe(uint64_t id)
+{
+    std::lock_guard<std::mutex> lock(registerMutex_);
+    bool isLast = false;
+    {
+        std::lock_guard<std::mutex> listenerLock(listenerMutex_);
+        if (listeners_.erase(id) == 0) {
+            return;
+        }
+        isLast = listeners_.empty();
+    }
+    if (isLast) {
+        Unregister();
+    }
+}
+
+size_t PowerStateSubscription::GetListenerCount() const
+{
+    std::lock_guard<std::mutex> lock(listenerMutex_);
+    return listeners_.size();
+}
+
+bool PowerStateSubscription::Register()
+{
+    if (stateCallback_ == nullptr || modeCallback_ == nullptr) {
+        return false;
+    }
+    if (!source_->RegisterStateCallback(stateCallback_)) {
+        POWER_HILOGW(FEATURE_POWER_STATE, "register power state callback failed");
+        return false;
+    }
+    registered_ = true;
+    SeedState();
+    // only system applications may watch the mode, the others keep asking the service
+    modeRegistered_ = source_->RegisterModeCallback(modeCallback_);
+    if (modeRegistered_) {
+        SeedMode();
+    }
+    POWER_HILOGI(FEATURE_POWER_STATE, "power state subscription registered, mode=%{public}d", modeRegistered_);
+    return true;
+}
+
+void PowerStateSubscription::Unregister()
+{
+    if (!registered_) {
+        return;
+    }
+    stateCached_.store(false, std::memory_order_release);
+    modeCached_.store(false, std::memory_order_release);
+    source_->UnRegisterStateCallback(stateCallback_);
+    if (modeRegistered_) {
+        source_->UnRegisterModeCallback(modeCallback_);
+    }
+    registered_ = false;
+    modeRegistered_ = false;
+    POWER_HILOGI(FEATURE_POWER_STATE, "power state subscription unregistered");
+}
+
+void PowerStateSubscription::SeedState()
+{
+    uint64_t changes = 0;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        changes = stateChanges_;
+    }
+    bool isScreenOn = source_->IsScreenOn();
+    PowerState state = source_->GetState();
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    if (changes == stateChanges_) {
+        screenOn_.store(isScreenOn, std::memory_order_relaxed);
+        state_.store(state, std::memory_order_relaxed);
+    }
+    stateCached_.store(true, std::memory_order_release);
+}
+
+void PowerStateSubscription::SeedMode()
+{
+    uint64_t changes = 0;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        changes = modeChanges_;
+    }
+    PowerMode mode = source_->GetDeviceMode();
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    if (changes == modeChanges_) {
+        mode_.store(mode, std::memory_order_relaxed);
+    }
+    modeCached_.store(true, std::memory_order_release);
+}
+
+bool PowerStateSubscription::IsScreenOn()
+{
+    if (stateCached_.load(std::memory_order_acquire)) {
+        return screenOn_.load(std::memory_order_relaxed);
+    }
+    return source_->IsScreenOn();
+}
+
+PowerState PowerStateSubscription::GetState()
+{
+    if (stateCached_.load(std::memory_order_acquire)) {
+        return state_.load(std::memory_order_relaxed);
+    }
+    return source_->GetState();
+}
+
+PowerMode PowerStateSubscription::GetDeviceMode()
+{
+    if (modeCached_.load(std::memory_order_acquire)) {
+        return mode_.load(std::memory_order_relaxed);
+    }
+    return source_->GetDeviceMode();
+}
+
+bool PowerStateSubscription::IsStateCached() const
+{
+    return stateCached_.load(std::memory_order_acquire);
+}
+
+bool PowerStateSubscription::IsModeCached() const
+{
+    return modeCached_.load(std::memory_order_acquire);
+}
+
+void PowerStateSubscription::InvalidateCache()
+{
+    stateCached_.store(false, std::memory_order_release);
+    modeCached_.store(false, std::memory_order_release);
+}
+
+void PowerStateSubscription::RefreshCache()
+{
+    std::lock_guard<std::mutex> lock(registerMutex_);
+    if (!registered_) {
+        return;
+    }
+    SeedState();
+    if (modeRegistered_) {
+        SeedMode();
+    }
+}
+
+void PowerStateSubscription::OnStateChanged(PowerState state)
+{
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        stateChanges_++;
+        state_.store(state, std::memory_order_relaxed);
+        if (state == PowerState::AWAKE || state == PowerState::DIM) {
+            screenOn_.store(true, std::memory_order_relaxed);
+        } else if (IsScreenOffState(state)) {
+            screenOn_.store(false, std::memory_order_relaxed);
+        }
+    }
+    std::vector<std::shared_ptr<StateListener>> listeners;
+    {
+        std::lock_guard<std::mutex> lock(listenerMutex_);
+        listeners.reserve(listeners_.size());
+        for (const auto& [id, listener] : listeners_) {
+            listeners.push_back(listener);
+        }
+    }
+    POWER_HILOGD(FEATURE_POWER_STATE, "state=%{public}u, listeners=%{public}zu", static_cast<uint32_t>(state),
+        listeners.size());
+    for (const auto& listener : listeners) {
+        (*listener)(state);
+    }
+}
+
+void PowerStateSubscription::OnModeChanged(PowerMode mode)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    modeChanges_++;
+    mode_.store(mode, std::memory_order_relaxed);
+}
+} // namespace PowerMgr
+} // namespace OHOS
@@ -26,6 +26,7 @@
 #include "power_common.h"
 #include "power_log.h"
 #include "power_mgr_errors.h"
+#include "running_lock_registry.h"
 #include "running_lock_token_stub.h"
 
 namespace OHOS {
@@ -44,6 +45,7 @@ RunningLock::RunningLock(
 
 RunningLock::~RunningLock()
 {
+    RunningLockRegistry::GetInstance().Remove(this);
     if (token_ != nullptr) {
         Release();
     }
@@ -61,7 +63,7 @@ PowerErrors RunningLock::Init()
 
 PowerErrors RunningLock::Create()
 {
-    sptr<IPowerMgr> proxy = proxy_.promote();
+    sptr<IPowerMgr> proxy = GetProxy();
     if (proxy == nullptr) {
         POWER_HILOGE(FEATURE_RUNNING_LOCK, "CProxy=null");
         return PowerErrors::ERR_CONNECTION_FAIL;
@@ -75,13 +77,25 @@ PowerErrors RunningLock::Recover(const wptr<IPowerMgr>& proxy)
 {
     POWER_HILOGI(FEATURE_RUNNING_LOCK, "recover running lock name %{public}s type %{public}d",
         runningLockInfo_.name.c_str(), runningLockInfo_.type);
-    proxy_ = proxy;
+    SetProxy(proxy);
     return Create();
 }
 
+void RunningLock::SetProxy(const wptr<IPowerMgr>& proxy)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    proxy_ = proxy;
+}
+
+sptr<IPowerMgr> RunningLock::GetProxy()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return proxy_.promote();
+}
+
 ErrCode RunningLock::UpdateWorkSource(const std::vector<int32_t>& workSources)
 {
-    sptr<IPowerMgr> proxy = proxy_.promote();
+    sptr<IPowerMgr> proxy = GetProxy();
     if (proxy == nullptr) {
         POWER_HILOGE(FEATURE_RUNNING_LOCK, "UpProxy=null");
         return E_GET_POWER_SERVICE_FAILED;
@@ -97,7 +111,7 @@ ErrCode RunningLock::UpdateWorkSource(const std::vector<int32_t>& workSources)
 
 ErrCode RunningLock::Lock(int32_t timeOutMs)
 {
-    sptr<IPowerMgr> proxy = proxy_.promote();
+    sptr<IPowerMgr> proxy = GetProxy();
     if (proxy == nullptr) {
         POWER_HILOGE(FEATURE_RUNNING_LOCK, "LProxy=null");
         return E_GET_POWER_SERVICE_FAILED;
@@ -122,7 +136,7 @@ ErrCode RunningLock::Lock(int32_t timeOutMs)
 
 ErrCode RunningLock::UnLock()
 {
-    sptr<IPowerMgr> proxy = proxy_.promote();
+    sptr<IPowerMgr> proxy = GetProxy();
     if (proxy == nullptr) {
         POWER_HILOGE(FEATURE_RUNNING_LOCK, "UnProxy=null");
         return E_GET_POWER_SERVICE_FAILED;
@@ -139,7 +153,7 @@ ErrCode RunningLock::UnLock()
 
 bool RunningLock::IsUsed()
 {
-    sptr<IPowerMgr> proxy = proxy_.promote();
+    sptr<IPowerMgr> proxy = GetProxy();
     if (proxy == nullptr) {
         POWER_HILOGE(FEATURE_RUNNING_LOCK, "IProxy=null");
         return false;
@@ -152,7 +166,7 @@ bool RunningLock::IsUsed()
 
 void RunningLock::Release()
 {
-    sptr<IPowerMgr> proxy = proxy_.promote();
+    sptr<IPowerMgr> proxy = GetProxy();
     if (proxy == nullptr) {
         POWER_HILOGE(FEATURE_RUNNING_LOCK, "RProxy=null");
         return;
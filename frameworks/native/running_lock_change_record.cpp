@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "running_lock_change_record.h"
+
+#include "power_common.h"
+
+namespace OHOS {
+namespace PowerMgr {
+bool RunningLockChangeRecord::Marshalling(Parcel& parcel) const
+{
+    RETURN_IF_WRITE_PARCEL_FAILED_WITH_RET(parcel, Uint64, lockid, false);
+    RETURN_IF_WRITE_PARCEL_FAILED_WITH_RET(parcel, Int32, pid, false);
+    RETURN_IF_WRITE_PARCEL_FAILED_WITH_RET(parcel, Int32, uid, false);
+    RETURN_IF_WRITE_PARCEL_FAILED_WITH_RET(parcel, Int32, type, false);
+    RETURN_IF_WRITE_PARCEL_FAILED_WITH_RET(parcel, Uint32, static_cast<uint32_t>(action), false);
+    RETURN_IF_WRITE_PARCEL_FAILED_WITH_RET(parcel, Int64, timestamp, false);
+    RETURN_IF_WRITE_PARCEL_FAILED_WITH_RET(parcel, String, name, false);
+    RETURN_IF_WRITE_PARCEL_FAILED_WITH_RET(parcel, String, bundleName, false);
+    return true;
+}
+
+bool RunningLockChangeRecord::ReadFromParcel(Parcel& parcel)
+{
+    uint32_t readAction = 0;
+    RETURN_IF_READ_PARCEL_FAILED_WITH_RET(parcel, Uint64, lockid, false);
+    RETURN_IF_READ_PARCEL_FAILED_WITH_RET(parcel, Int32, pid, false);
+    RETURN_IF_READ_PARCEL_FAILED_WITH_RET(parcel, Int32, uid, false);
+    RETURN_IF_READ_PARCEL_FAILED_WITH_RET(parcel, Int32, type, false);
+    RETURN_IF_READ_PARCEL_FAILED_WITH_RET(parcel, Uint32, readAction, false);
+    RETURN_IF_READ_PARCEL_FAILED_WITH_RET(parcel, Int64, timestamp, false);
+    RETURN_IF_READ_PARCEL_FAILED_WITH_RET(parcel, String, name, false);
+    RETURN_IF_READ_PARCEL_FAILED_WITH_RET(parcel, String, bundleName, false);
+    RETURN_IF_WITH_RET(readAction >= static_cast<uint32_t>(RunningLockChangeAction::BUTT), false);
+    action = static_cast<RunningLockChangeAction>(readAction);
+    return true;
+}
+
+std::string RunningLockChangeRecord::ToMessage() const
+{
+    std::string message;
+    message.append("LOCKID=").append(std::to_string(lockid))
+            .append(" PID=").append(std::to_string(pid))
+            .append(" UID=").append(std::to_string(uid))
+            .append(" TYPE=").append(std::to_string(type))
+            .append(" NAME=").append(name)
+            .append(" BUNDLENAME=").append(bundleName)
+            .append(" TAG=").append(GetTag(action))
+            .append(" TIMESTAMP=").append(std::to_string(timestamp));
+    return message;
+}
+
+const char* RunningLockChangeRecord::GetTag(RunningLockChangeAction action)
+{
+    switch (action) {
+        case RunningLockChangeAction::ADD:
+            return "DUBAI_TAG_RUNNINGLOCK_ADD";
+        case RunningLockChangeAction::REMOVE:
+            return "DUBAI_TAG_RUNNINGLOCK_REMOVE";
+        case RunningLockChangeAction::UPDATE:
+            return "DUBAI_TAG_RUNNINGLOCK_UPDATE";
+        default:
+            return "";
+    }
+}
+} // namespace PowerMgr
+} // namespace OHOS
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "running_lock_registry.h"
+
+namespace OHOS {
+namespace PowerMgr {
+RunningLockRegistry& RunningLockRegistry::GetInstance()
+{
+    // never destroyed, locks owned by static objects may still unlink themselves during exit
+    static RunningLockRegistry* instance = new RunningLockRegistry();
+    return *instance;
+}
+
+void RunningLockRegistry::Add(const std::shared_ptr<RunningLock>& runningLock)
+{
+    if (runningLock == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (runningLock->registered_) {
+        return;
+    }
+    runningLock->self_ = runningLock;
+    runningLock->prev_ = nullptr;
+    runningLock->next_ = head_;
+    if (head_ != nullptr) {
+        head_->prev_ = runningLock.get();
+    }
+    head_ = runningLock.get();
+    runningLock->registered_ = true;
+    typeCounts_[runningLock->runningLockInfo_.type]++;
+    liveCount_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RunningLockRegistry::Remove(RunningLock* runningLock)
+{
+    if (runningLock == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!runningLock->registered_) {
+        return;
+    }
+    if (runningLock->prev_ != nullptr) {
+        runningLock->prev_->next_ = runningLock->next_;
+    } else {
+        head_ = runningLock->next_;
+    }
+    if (runningLock->next_ != nullptr) {
+        runningLock->next_->prev_ = runningLock->prev_;
+    }
+    runningLock->prev_ = nullptr;
+    runningLock->next_ = nullptr;
+    runningLock->registered_ = false;
+    auto iter = typeCounts_.find(runningLock->runningLockInfo_.type);
+    if (iter != typeCounts_.end() && --iter->second == 0) {
+        typeCounts_.erase(iter);
+    }
+    liveCount_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+std::vector<std::shared_ptr<RunningLock>> RunningLockRegistry::GetLiveLocks() const
+{
+    std::vector<std::shared_ptr<RunningLock>> locks;
+    std::lock_guard<std::mutex> lock(mutex_);
+    locks.reserve(liveCount_.load(std::memory_order_relaxed));
+    for (RunningLock* node = head_; node != nullptr; node = node->next_) {
+        // expired when the destructor is waiting for the mutex to unlink it
+        std::shared_ptr<RunningLock> runningLock = node->self_.lock();
+        if (runningLock != nullptr) {
+            locks.push_back(std::move(runningLock));
+        }
+    }
+    return locks;
+}
+
+size_t RunningLockRegistry::GetLiveCount() const
+{
+    return liveCount_.load(std::memory_order_relaxed);
+}
+
+size_t RunningLockRegistry::GetLiveCount(RunningLockType type) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = typeCounts_.find(type);
+    return iter == typeCounts_.end() ? 0 : iter->second;
+}
+} // namespace PowerMgr
+} // namespace OHOS
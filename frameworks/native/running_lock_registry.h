@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_RUNNING_LOCK_REGISTRY_H
+#define POWERMGR_RUNNING_LOCK_REGISTRY_H
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "running_lock.h"
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Client side registry of the running locks created by this process, used to recover them
+ * after the power service restarts. The registry is an intrusive list through the locks
+ * themselves: a lock links itself when created and unlinks itself in its destructor, so the
+ * footprint follows the number of live locks and both operations are O(1).
+ */
+class RunningLockRegistry {
+public:
+    static RunningLockRegistry& GetInstance();
+
+    void Add(const std::shared_ptr<RunningLock>& runningLock);
+    void Remove(RunningLock* runningLock);
+    // locks that are still alive, a lock being destroyed is skipped
+    std::vector<std::shared_ptr<RunningLock>> GetLiveLocks() const;
+    size_t GetLiveCount() const;
+    size_t GetLiveCount(RunningLockType type) const;
+
+private:
+    RunningLockRegistry() = default;
+    ~RunningLockRegistry() = default;
+    DISALLOW_COPY_AND_MOVE(RunningLockRegistry);
+
+    mutable std::mutex mutex_;
+    RunningLock* head_ {nullptr};
+    std::atomic<size_t> liveCount_ {0};
+    std::map<RunningLockType, size_t> typeCounts_;
+};
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWERMGR_RUNNING_LOCK_REGISTRY_H
@@ -19,12 +19,25 @@
 #include <iremote_object.h>
 #include <iremote_proxy.h>
 #include <iremote_stub.h>
+#include <vector>
+
+#include "running_lock_change_record.h"
 
 namespace OHOS {
 namespace PowerMgr {
 class IPowerRunninglockCallback : public IRemoteBroker {
 public:
     virtual void HandleRunningLockMessage(std::string message) = 0;
+    /**
+     * Changes in the order they happened, droppedCount is the number of records lost since the
+     * previous batch. By default every record is passed on to HandleRunningLockMessage as text.
+     */
+    virtual void HandleRunningLockChanges(const std::vector<RunningLockChangeRecord>& records, uint32_t droppedCount)
+    {
+        for (const auto& record : records) {
+            HandleRunningLockMessage(record.ToMessage());
+        }
+    }
 
     DECLARE_INTERFACE_DESCRIPTOR(u"ohos.powermgr.IPowerRunninglockCallback");
 };
@@ -16,6 +16,8 @@
 #ifndef POWERMGR_POWER_MGR_CLIENT_H
 #define POWERMGR_POWER_MGR_CLIENT_H
 
+#include <atomic>
+#include <memory>
 #include <string>
 #include <singleton.h>
 
@@ -34,8 +36,6 @@ class PowerMgrClient final {
 public:
     static PowerMgrClient& GetInstance();
     virtual ~PowerMgrClient();
-    static const uint32_t CONNECT_RETRY_COUNT = 5;
-    static const uint32_t CONNECT_RETRY_MS = 800000;
     /**
      * Reboot the device.
      *
@@ -280,6 +280,11 @@ public:
     bool RegisterPowerModeCallback(const sptr<IPowerModeCallback>& callback);
     bool UnRegisterPowerModeCallback(const sptr<IPowerModeCallback>& callback);
     void RecoverRunningLocks();
+    /**
+     * Number of running locks created by this process that are still alive.
+     */
+    size_t GetLiveRunningLockCount();
+    size_t GetLiveRunningLockCount(RunningLockType type);
     bool RegisterScreenStateCallback(int32_t remainTime, const sptr<IScreenOffPreCallback>& callback);
     bool UnRegisterScreenStateCallback(const sptr<IScreenOffPreCallback>& callback);
     bool RegisterRunningLockCallback(const sptr<IPowerRunninglockCallback>& callback);
@@ -387,14 +392,25 @@ private:
         PowerMgrClient& client_;
     };
 
+    // notified by samgr when the service is (re)started, defined in the source file
+    class PowerMgrStatusListener;
+
     ErrCode Connect();
     sptr<IPowerMgr> GetPowerMgrProxy();
-    void ResetProxy(const wptr<IRemoteObject>& remote);
-    sptr<IPowerMgr> proxy_ {nullptr};
+    sptr<IPowerMgr> LoadProxy() const;
+    void StoreProxy(const sptr<IPowerMgr>& proxy);
+    bool ResetProxy(const wptr<IRemoteObject>& remote);
+    void SubscribeServiceStatus();
+    void OnServiceAdded();
+    void RestoreSession();
+    // published with std::atomic_load/atomic_store, readers never take mutex_
+    std::shared_ptr<const sptr<IPowerMgr>> proxy_ {nullptr};
     sptr<IRemoteObject::DeathRecipient> deathRecipient_ {nullptr};
+    // serializes connecting and resetting the proxy
     std::mutex mutex_;
-    static std::vector<std::weak_ptr<RunningLock>> runningLocks_;
-    static std::mutex runningLocksMutex_;
+    std::mutex listenerMutex_;
+    sptr<PowerMgrStatusListener> statusListener_ {nullptr};
+    std::atomic_bool needRecover_ {false};
     sptr<IRemoteObject> token_ {nullptr};
     PowerErrors error_ = PowerErrors::ERR_OK;
 
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_POWER_RESTORE_SESSION_H
+#define POWERMGR_POWER_RESTORE_SESSION_H
+
+#include <vector>
+
+#include <iremote_object.h>
+#include <parcel.h>
+
+#include "running_lock_info.h"
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Kind of a callback registration carried by a restore session.
+ */
+enum class RestoreCallbackType : uint32_t {
+    POWER_STATE = 0,
+    SYNC_SLEEP,
+    SYNC_HIBERNATE,
+    SUSPEND_TAKEOVER,
+    POWER_MODE,
+    SCREEN_OFF_PRE,
+    RUNNING_LOCK,
+    ULSR,
+    ASYNC_SHUTDOWN,
+    RUNNING_LOCK_CHANGED,
+    BUTT
+};
+
+struct RestoreLockEntry {
+    sptr<IRemoteObject> token;
+    RunningLockInfo info;
+};
+
+struct RestoreCallbackEntry {
+    RestoreCallbackType type {RestoreCallbackType::BUTT};
+    sptr<IRemoteObject> callback;
+    // isSync, priority or remain time depending on the type
+    int32_t param {0};
+    uint64_t displayId {UINT64_MAX};
+};
+
+/**
+ * Everything a client process had registered with the power service, sent in one IPC after the
+ * service restarts instead of replaying every lock and callback.
+ */
+class PowerRestoreSession : public Parcelable {
+public:
+    static constexpr uint32_t MAX_LOCK_NUM = 4096;
+    static constexpr uint32_t MAX_CALLBACK_NUM = 512;
+
+    bool IsEmpty() const
+    {
+        return locks.empty() && callbacks.empty();
+    }
+    bool ReadFromParcel(Parcel& parcel);
+    bool Marshalling(Parcel& parcel) const override;
+    static PowerRestoreSession* Unmarshalling(Parcel& parcel);
+
+    std::vector<RestoreLockEntry> locks;
+    std::vector<RestoreCallbackEntry> callbacks;
+};
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWERMGR_POWER_RESTORE_SESSION_H
@@ -20,6 +20,7 @@ namespace OHOS {
 namespace PowerMgr {
 enum class PowerRunningLockCallbackInterfaceCode {
     POWER_RUNNINGLOCK_CHANGED = 0,
+    POWER_RUNNINGLOCK_CHANGES = 1,
 };
 } // space PowerMgr
 } // namespace OHOS
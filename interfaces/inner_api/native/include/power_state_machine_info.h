@@ -44,6 +44,12 @@ constexpr int MAX_STRING_LENGTH = 128;
 // Throttling interval for user activity calls.
 constexpr int64_t MIN_TIME_MS_BETWEEN_USERACTIVITIES = 100; // 100ms
 
+// The throttling interval published by the service, clients coalesce user activity calls with it.
+constexpr const char* REFRESH_ACTIVITY_INTERVAL_PARAM = "powermgr.activity.refresh_interval_ms";
+
+// Bumped by the service on every power state change, the first user activity after it is never coalesced.
+constexpr const char* POWER_STATE_SERIAL_PARAM = "powermgr.state.serial";
+
 // Throttling interval for multimode activity calls.
 constexpr int64_t MIN_TIME_MS_BETWEEN_MULTIMODEACTIVITIES = 100; // 100ms
 
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_POWER_STATE_SUBSCRIPTION_H
+#define POWERMGR_POWER_STATE_SUBSCRIPTION_H
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <nocopyable.h>
+
+#include "ipower_mode_callback.h"
+#include "ipower_state_callback.h"
+#include "power_errors.h"
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Where PowerStateSubscription registers its callbacks and reads the initial values, the power
+ * service through PowerMgrClient unless a test injects its own.
+ */
+class PowerStateSource {
+public:
+    virtual ~PowerStateSource() = default;
+    virtual bool RegisterStateCallback(const sptr<IPowerStateCallback>& callback) = 0;
+    virtual void UnRegisterStateCallback(const sptr<IPowerStateCallback>& callback) = 0;
+    virtual bool RegisterModeCallback(const sptr<IPowerModeCallback>& callback) = 0;
+    virtual void UnRegisterModeCallback(const sptr<IPowerModeCallback>& callback) = 0;
+    virtual bool IsScreenOn() = 0;
+    virtual PowerState GetState() = 0;
+    virtual PowerMode GetDeviceMode() = 0;
+};
+
+/**
+ * One power state registration per process, shared by every JS, CJ and ArkTS listener. The first
+ * listener registers an async IPowerStateCallback and an IPowerModeCallback with the service, the
+ * last one to leave unregisters them. While registered, the last state and mode are kept so that
+ * IsScreenOn and GetDeviceMode are answered without an IPC.
+ *
+ * Listeners run on the IPC thread that delivers the change and may still be called once after
+ * Unsubscribe returns, a binding that posts to its own thread has to check that it is still
+ * subscribed there.
+ */
+class PowerStateSubscription {
+public:
+    using StateListener = std::function<void(PowerState)>;
+
+    static PowerStateSubscription& GetInstance();
+
+    PowerStateSubscription();
+    explicit PowerStateSubscription(std::unique_ptr<PowerStateSource> source);
+    ~PowerStateSubscription();
+
+    // id is set to a non zero handle for Unsubscribe when ERR_OK is returned
+    PowerErrors Subscribe(const StateListener& listener, uint64_t& id);
+    void Unsubscribe(uint64_t id);
+    size_t GetListenerCount() const;
+
+    // from the cache while subscribed, from the service otherwise
+    bool IsScreenOn();
+    PowerState GetState();
+    PowerMode GetDeviceMode();
+    bool IsStateCached() const;
+    bool IsModeCached() const;
+
+    // the service died, changes may be missed until the registration is restored
+    void InvalidateCache();
+    // the registration was restored, read the values that may have changed meanwhile
+    void RefreshCache();
+
+    void OnStateChanged(PowerState state);
+    void OnModeChanged(PowerMode mode);
+
+private:
+    DISALLOW_COPY_AND_MOVE(PowerStateSubscription);
+
+    bool Register();
+    void Unregister();
+    void SeedState();
+    void SeedMode();
+
+    std::unique_ptr<PowerStateSource> source_;
+    sptr<IPowerStateCallback> stateCallback_;
+    sptr<IPowerModeCallback> modeCallback_;
+
+    // serializes the registration with the service, held across its IPCs
+    std::mutex registerMutex_;
+    bool registered_ {false};
+    bool modeRegistered_ {false};
+
+    mutable std::mutex listenerMutex_;
+    std::map<uint64_t, std::shared_ptr<StateListener>> listeners_;
+    uint64_t nextId_ {1};
+
+    // a seed is dropped when a change arrived while it was read from the service
+    std::mutex cacheMutex_;
+    uint64_t stateChanges_ {0};
+    uint64_t modeChanges_ {0};
+    std::atomic_bool stateCached_ {false};
+    std::atomic_bool modeCached_ {false};
+    std::atomic_bool screenOn_ {false};
+    std::atomic<PowerState> state_ {PowerState::UNKNOWN};
+    std::atomic<PowerMode> mode_ {PowerMode::NORMAL_MODE};
+};
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWERMGR_POWER_STATE_SUBSCRIPTION_H
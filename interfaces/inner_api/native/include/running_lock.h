@@ -60,12 +60,22 @@ public:
     static constexpr uint32_t CREATE_WITH_SCREEN_ON = 0x10000000;
 
 private:
+    friend class RunningLockRegistry;
+    friend class PowerClientRecovery;
     PowerErrors Create();
     void Release();
+    // the proxy is rebound by the recovery while the app calls Lock/UnLock
+    void SetProxy(const wptr<IPowerMgr>& proxy);
+    sptr<IPowerMgr> GetProxy();
     std::mutex mutex_;
     RunningLockInfo runningLockInfo_;
     sptr<IRemoteObject> token_;
-    wptr<IPowerMgr> proxy_;
+    wptr<IPowerMgr> proxy_; // guard by mutex_
+    // links of the client side registry, guarded by the registry mutex
+    RunningLock* prev_ {nullptr};
+    RunningLock* next_ {nullptr};
+    std::weak_ptr<RunningLock> self_;
+    bool registered_ {false};
 };
 } // namespace PowerMgr
 } // namespace OHOS
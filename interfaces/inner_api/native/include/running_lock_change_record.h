@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_RUNNING_LOCK_CHANGE_RECORD_H
+#define POWERMGR_RUNNING_LOCK_CHANGE_RECORD_H
+
+#include <cstdint>
+#include <string>
+
+#include <parcel.h>
+
+namespace OHOS {
+namespace PowerMgr {
+enum class RunningLockChangeAction : uint32_t {
+    ADD = 0,
+    REMOVE,
+    UPDATE,
+    BUTT
+};
+
+/**
+ * One change of a running lock as delivered to IPowerRunninglockCallback observers.
+ */
+struct RunningLockChangeRecord {
+    uint64_t lockid {0};
+    int32_t pid {0};
+    int32_t uid {0};
+    int32_t type {0};
+    RunningLockChangeAction action {RunningLockChangeAction::BUTT};
+    int64_t timestamp {0};
+    // lock name without the suffix the client appends to make it unique
+    std::string name;
+    std::string bundleName;
+
+    bool Marshalling(Parcel& parcel) const;
+    bool ReadFromParcel(Parcel& parcel);
+    // "LOCKID=... PID=... UID=... TYPE=... NAME=... BUNDLENAME=... TAG=... TIMESTAMP=..."
+    std::string ToMessage() const;
+    static const char* GetTag(RunningLockChangeAction action);
+};
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWERMGR_RUNNING_LOCK_CHANGE_RECORD_H
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_POWER_EVENT_RECORDER_H
+#define POWERMGR_POWER_EVENT_RECORDER_H
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "ffrt_utils.h"
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Keeps HiSysEvent writes off the paths of the power service that emit them. Events are buffered and
+ * written on a serial queue when the buffer fills up, a few seconds after the first pending one, or
+ * while the suspend callbacks run. Events keep their order, so each one is written for itself. Deferred
+ * events wait for the next flush, so that the suspend path writes nothing before the kernel suspend attempt.
+ */
+class PowerEventRecorder {
+public:
+    // runs the tasks in order on one serial queue, after delayMs when it is not 0
+    using Submitter = std::function<void(const std::vector<FFRTTask>& tasks, uint32_t delayMs)>;
+
+    static constexpr uint32_t FLUSH_DELAY_MS = 5000;
+    static constexpr size_t MAX_PENDING_EVENT_NUM = 64;
+
+    static PowerEventRecorder& GetInstance();
+
+    explicit PowerEventRecorder(const Submitter& submit);
+    ~PowerEventRecorder() = default;
+
+    // an event written as is, after every event recorded before it
+    void Record(const FFRTTask& write);
+    // like Record, but starts no timer, it is written by the next flush
+    void Defer(const FFRTTask& write);
+    // hands everything pending to the queue
+    void Flush();
+    size_t GetPendingCount();
+
+private:
+    // true when the caller has to start the flush timer
+    bool OnPendingLocked();
+    void StartTimer();
+    std::vector<FFRTTask> TakePending();
+
+    Submitter submit_;
+    std::mutex mutex_;
+    std::vector<FFRTTask> events_;
+    bool timerStarted_ {false};
+};
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWERMGR_POWER_EVENT_RECORDER_H
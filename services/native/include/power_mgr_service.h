@@ -64,6 +64,7 @@ enum class PowerConnectStatus : int32_t {
 #endif
 
 class RunningLockMgr;
+class PowerInitTaskGraph;
 class PowerMgrService final : public SystemAbility, public PowerMgrServiceAdapter {
     DECLARE_SYSTEM_ABILITY(PowerMgrService)
     DECLARE_DELAYED_SP_SINGLETON(PowerMgrService);
@@ -174,6 +175,7 @@ public:
         ProxFilteringStrategy strategy, const sptr<IRemoteObject>& token) override;
     virtual PowerErrors GetPowerConfig(const std::string& sceneName, std::string& configVal) override;
     virtual PowerErrors SetPowerConfig(const std::string& sceneName, const std::string& configVal) override;
+    virtual PowerErrors RestoreSession(const PowerRestoreSession& session) override;
 
     void SetEnableDoze(bool enable);
     void RegisterShutdownCallback(const sptr<ITakeOverShutdownCallback>& callback, ShutdownPriority priority) override;
@@ -236,11 +238,11 @@ public:
     bool TriggerUlsrSyncCallback();
     void TriggerUlsrWakeupCallback(bool ulsrResult);
     void TriggerUlsrWakeupCallbackWithResult();
-    void WaitAndTriggerUlsrWakeup();
     bool IsUlsrSucceed();
     void OnUlsrTimerExpired();
 #endif
     void OnChargeStateChanged();
+    void DumpInitInfo(std::string& result);
 
     inline PowerModeModule& GetPowerModeModule()
     {
@@ -370,6 +372,7 @@ private:
     static void RegisterBootCompletedCallback();
     static void PowerExternalAbilityInit();
     static bool IsDeveloperMode();
+    static bool IsParallelInitEnable();
 #ifdef HAS_SENSORS_SENSOR_PART
     static void HallSensorCallback(SensorEvent* event);
 #endif
@@ -411,6 +414,7 @@ private:
 
     bool Init();
     bool PowerStateMachineInit();
+    std::shared_ptr<PowerInitTaskGraph> CreateBootCompletedInitGraph();
     void OnAddSystemAbilityInner(int32_t systemAbilityId, const std::string& deviceId);
     std::string GetBundleNameByUid(const int32_t uid);
     RunningLockParam FillRunningLockParam(const RunningLockInfo& info, const uint64_t lockid, int32_t timeOutMS = -1);
@@ -426,6 +430,7 @@ private:
     void RegisterExternalCallback();
     void UnregisterExternalCallback();
     bool IsDeviceSupportedTypeUserIdle();
+    bool RestoreCallback(const RestoreCallbackEntry& entry);
 #ifdef POWER_MANAGER_SCREEN_SAVER
     void ScreenSaverInit();
 #endif
@@ -459,6 +464,8 @@ private:
     std::shared_ptr<SuspendController> suspendController_ {nullptr};
     std::shared_ptr<WakeupController> wakeupController_ {nullptr};
     sptr<IRemoteObject> ptoken_ {nullptr};
+    std::shared_ptr<PowerInitTaskGraph> startInitGraph_ {nullptr};
+    std::shared_ptr<PowerInitTaskGraph> bootInitGraph_ {nullptr}; // std::atomic_load/atomic_store only
 #ifdef POWER_MANAGER_POWER_ENABLE_S4
     std::shared_ptr<HibernateController> hibernateController_ {nullptr};
     bool isHibernateEnable_ {true};
@@ -19,6 +19,7 @@
 #include <iremote_object.h>
 #include "ipower_mgr.h"
 #include "power_mgr_stub.h"
+#include "power_restore_session.h"
 #include "hibernate/hibernate_callback_priority.h"
 
 namespace OHOS {
@@ -131,6 +132,7 @@ public:
         const std::string& sceneName, std::string& configVal, int32_t& powerError) override;
     virtual int32_t SetPowerConfigIpc(
         const std::string& sceneName, const std::string& configVal, int32_t& powerError) override;
+    virtual int32_t RestoreSessionIpc(const PowerRestoreSession& session, int32_t& powerError) override;
 
     virtual PowerErrors RebootDevice(const std::string& reason) = 0;
     virtual PowerErrors RebootDeviceForDeprecated(const std::string& reason, bool force = false) = 0;
@@ -230,6 +232,7 @@ public:
 
     virtual PowerErrors GetPowerConfig(const std::string& sceneName, std::string& configVal) = 0;
     virtual PowerErrors SetPowerConfig(const std::string& sceneName, const std::string& configVal) = 0;
+    virtual PowerErrors RestoreSession(const PowerRestoreSession& session) = 0;
 };
 } // namespace PowerMgr
 } // namespace OHOS
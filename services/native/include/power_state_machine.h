@@ -194,22 +194,11 @@ public:
     {
         externalScreenNumber_ = exScreenNumber;
     }
-    bool IsOnlySecondDisplayModeSupported() const
-    {
-        int32_t displayMode = system::GetIntParameter("const.product.support_display_mode", 0);
-        return (displayMode & DISPLAY_MODE_ONLY_SECOND_SCREEN) > 0;
-    }
+    bool IsOnlySecondDisplayModeSupported() const;
     bool IsLidOrSwitchOpen();
     void HandleOnlySecondScreenWhenCoverOpen(StateChangeReason reason);
-    bool IsLidEventUsed()
-    {
-        return system::GetIntParameter("const.power.lid_type_for_only_external_screen", 0) == 1;
-    }
-    bool Is2In1PadMode()
-    {
-        return system::GetBoolParameter("const.window.support_window_pcmode_switch", false) &&
-            !system::GetBoolParameter("persist.sceneboard.ispcmode", false);
-    }
+    bool IsLidEventUsed();
+    bool Is2In1PadMode();
 #endif
 
     // only use for test
@@ -502,6 +491,12 @@ private:
     std::atomic<bool> isDuringCall_ {false};
     std::atomic<bool> isProximityCloseEventFiltered_ {false};
     int64_t activeTimeBeforeLongTimeDim_ {-1};
+    // published as POWER_STATE_SERIAL_PARAM, the clients forward the first refresh after a change
+    std::atomic<uint64_t> stateSerial_ {0};
+    std::atomic<bool> serialPublishPending_ {false};
+    FFRTQueue serialQueue_ {"power_state_serial"};
+    void PublishStateSerial();
+    std::atomic<bool> refreshThrottleReset_ {false};
     bool SetDreamingState(StateChangeReason reason);
 #ifdef POWER_MANAGER_ENABLE_WATCH_CUSTOMIZED_SCREEN_COMMON_EVENT_RULES
     bool SetScreenCommonEventRules(StateChangeReason reason);
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hdi_running_lock_queue.h"
+
+#include "power_log.h"
+
+namespace OHOS {
+namespace PowerMgr {
+int32_t HdiRunningLockQueue::Hold(const RunningLockParam& param)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!synchronous_ && failedHolds_.empty()) {
+            EnqueueLocked(Op::HOLD, param);
+            return RUNNINGLOCK_SUCCESS;
+        }
+    }
+    // the earlier commands must reach the HDI first, a pending unhold of this lock would release it again
+    std::lock_guard<std::mutex> drainLock(drainMutex_);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (CancelPendingLocked(Op::HOLD, param.lockid)) {
+            return RUNNINGLOCK_SUCCESS;
+        }
+    }
+    DrainLocked();
+    int32_t ret = Apply({Op::HOLD, param});
+    // the caller gets the result, a failed hold is not tried again
+    std::lock_guard<std::mutex> lock(mutex_);
+    failedHolds_.erase(param.lockid);
+    return ret;
+}
+
+int32_t HdiRunningLockQueue::Unhold(const RunningLockParam& param)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    // the HDI never got this lock, there is nothing to release
+    if (failedHolds_.erase(param.lockid) != 0 && lastPending_.find(param.lockid) == lastPending_.end()) {
+        return RUNNINGLOCK_SUCCESS;
+    }
+    EnqueueLocked(Op::UNHOLD, param);
+    return RUNNINGLOCK_SUCCESS;
+}
+
+bool HdiRunningLockQueue::CancelPendingLocked(Op op, uint64_t lockid)
+{
+    auto iter = lastPending_.find(lockid);
+    if (iter == lastPending_.end() || iter->second->op == op) {
+        return false;
+    }
+    pending_.erase(iter->second);
+    lastPending_.erase(iter);
+    coalescedCount_++;
+    return true;
+}
+
+bool HdiRunningLockQueue::EnqueueLocked(Op op, const RunningLockParam& param)
+{
+    if (CancelPendingLocked(op, param.lockid)) {
+        return false;
+    }
+    pending_.push_back({op, param});
+    lastPending_[param.lockid] = std::prev(pending_.end());
+    if (!drainScheduled_) {
+        drainScheduled_ = true;
+        queue_.submit([this]() { Drain(); });
+    }
+    return true;
+}
+
+void HdiRunningLockQueue::Drain()
+{
+    std::lock_guard<std::mutex> drainLock(drainMutex_);
+    DrainLocked();
+}
+
+void HdiRunningLockQueue::DrainLocked()
+{
+    std::list<Entry> batch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // the failed holds are older than every pending command
+        for (const auto& failed : failedHolds_) {
+            batch.push_back({Op::HOLD, failed.second});
+        }
+        failedHolds_.clear();
+        batch.splice(batch.end(), pending_);
+        lastPending_.clear();
+        drainScheduled_ = false;
+    }
+    for (const auto& entry : batch) {
+        int32_t ret = Apply(entry);
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (entry.op == Op::HOLD && ret != RUNNINGLOCK_SUCCESS) {
+            failedHolds_[entry.param.lockid] = entry.param;
+        } else {
+            failedHolds_.erase(entry.param.lockid);
+        }
+    }
+}
+
+int32_t HdiRunningLockQueue::Apply(const Entry& entry)
+{
+    int32_t ret = entry.op == Op::HOLD ? hold_(entry.param) : unhold_(entry.param);
+    if (ret != RUNNINGLOCK_SUCCESS) {
+        POWER_HILOGW(FEATURE_RUNNING_LOCK, "hdi %{public}s failed, name=%{public}s, ret=%{public}d",
+            entry.op == Op::HOLD ? "hold" : "unhold", entry.param.name.c_str(), ret);
+    }
+    return ret;
+}
+
+void HdiRunningLockQueue::SetSynchronous(bool synchronous)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        synchronous_ = synchronous;
+    }
+    if (synchronous) {
+        Drain();
+    }
+}
+
+bool HdiRunningLockQueue::IsSynchronous()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return synchronous_;
+}
+
+size_t HdiRunningLockQueue::GetPendingCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_.size();
+}
+
+uint64_t HdiRunningLockQueue::GetCoalescedCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return coalescedCount_;
+}
+
+size_t HdiRunningLockQueue::GetFailedHoldCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return failedHolds_.size();
+}
+} // namespace PowerMgr
+} // namespace OHOS
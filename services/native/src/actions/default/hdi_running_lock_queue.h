@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_HDI_RUNNING_LOCK_QUEUE_H
+#define POWERMGR_HDI_RUNNING_LOCK_QUEUE_H
+
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "actions/running_lock_action_info.h"
+#include "ffrt_utils.h"
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Ordered queue of the hold/unhold commands sent to the power HDI. Commands are applied in batches
+ * on an ffrt queue, and a hold/unhold pair of one lock that is still pending cancels out.
+ *
+ * Deferring a hold is only safe while the HDI is not suspending on its own, so the queue is switched
+ * to synchronous mode before StartSuspend/ForceSuspend/Hibernate: pending commands are applied first
+ * and later holds reach the HDI before they return. Unholds may always be deferred.
+ *
+ * A deferred hold that the HDI rejected is kept and tried again on every drain, and while one is kept
+ * the holds are applied synchronously, so that the callers see the HDI result.
+ */
+class HdiRunningLockQueue {
+public:
+    using Command = std::function<int32_t(const RunningLockParam& param)>;
+
+    HdiRunningLockQueue(Command hold, Command unhold) : hold_(std::move(hold)), unhold_(std::move(unhold)) {}
+    ~HdiRunningLockQueue() = default;
+
+    int32_t Hold(const RunningLockParam& param);
+    int32_t Unhold(const RunningLockParam& param);
+    // apply every pending command on the calling thread
+    void Drain();
+    void SetSynchronous(bool synchronous);
+    bool IsSynchronous();
+    size_t GetPendingCount();
+    uint64_t GetCoalescedCount();
+    // the locks the service holds but the HDI does not, nonzero means the system must not suspend
+    size_t GetFailedHoldCount();
+
+private:
+    enum class Op : uint32_t {
+        HOLD,
+        UNHOLD
+    };
+    struct Entry {
+        Op op;
+        RunningLockParam param;
+    };
+
+    // false if the command cancelled a pending command of the other kind, true if it was queued
+    bool EnqueueLocked(Op op, const RunningLockParam& param);
+    bool CancelPendingLocked(Op op, uint64_t lockid);
+    void DrainLocked();
+    int32_t Apply(const Entry& entry);
+
+    Command hold_;
+    Command unhold_;
+    std::mutex drainMutex_;
+    std::mutex mutex_;
+    std::list<Entry> pending_;
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> lastPending_;
+    bool synchronous_ {false};
+    bool drainScheduled_ {false};
+    uint64_t coalescedCount_ {0};
+    std::unordered_map<uint64_t, RunningLockParam> failedHolds_;
+    FFRTQueue queue_ {"power_hdi_running_lock_queue"};
+};
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWERMGR_HDI_RUNNING_LOCK_QUEUE_H
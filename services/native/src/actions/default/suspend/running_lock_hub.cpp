@@ -33,7 +33,7 @@ void RunningLockHub::Acquire(const std::string& name)
         runningLockMap_[name]++;
     }
     NotifySuspendCounter(true);
-    POWER_HILOGI(FEATURE_RUNNING_LOCK, "Acquire runningLock, name: %{public}s", name.c_str());
+    POWER_HILOGI_LIMITED(FEATURE_RUNNING_LOCK, "Acquire runningLock, name: %{public}s", name.c_str());
 }
 
 void RunningLockHub::Release(const std::string& name)
@@ -54,7 +54,7 @@ void RunningLockHub::Release(const std::string& name)
         }
     }
     NotifySuspendCounter(false);
-    POWER_HILOGI(FEATURE_RUNNING_LOCK, "Release runningLock, name: %{public}s", name.c_str());
+    POWER_HILOGI_LIMITED(FEATURE_RUNNING_LOCK, "Release runningLock, name: %{public}s", name.c_str());
 }
 
 bool RunningLockHub::InitFd()
@@ -18,6 +18,7 @@
 #include "hisysevent.h"
 #endif
 #include "power_common.h"
+#include "power_event_recorder.h"
 #include "power_log.h"
 #include "suspend/running_lock_hub.h"
 
@@ -147,6 +148,20 @@ void SystemSuspendController::DisallowAutoSleep()
     allowSleepTask_ = false;
 }
 
+void SystemSuspendController::PrepareSuspend()
+{
+    // written while the suspend callbacks run, the suspend call does not wait for it
+    PowerEventRecorder::GetInstance().Flush();
+    FFRTTask task = [this] {
+        if (GetPowerInterface() == nullptr) {
+            POWER_HILOGW(COMP_SVC, "The hdf interface is null before suspend");
+            return;
+        }
+        lockQueue_.Drain();
+    };
+    FFRTUtils::SubmitTask(task);
+}
+
 void SystemSuspendController::Suspend(
     const std::function<void()>& onSuspend, const std::function<void()>& onWakeup, bool force)
 {
@@ -158,14 +173,28 @@ void SystemSuspendController::Suspend(
         return;
     }
 #ifdef HAS_HIVIEWDFX_HISYSEVENT_PART
-    HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "DO_SUSPEND", HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-        "TYPE", static_cast<int32_t>(1));
-    HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "SUSPEND_STATISTIC",
-        HiviewDFX::HiSysEvent::EventType::STATISTIC, "DO_SUSPEND", static_cast<int8_t>(true));
+    PowerEventRecorder::GetInstance().Defer([] {
+        HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "DO_SUSPEND",
+            HiviewDFX::HiSysEvent::EventType::BEHAVIOR, "TYPE", static_cast<int32_t>(1));
+        HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "SUSPEND_STATISTIC",
+            HiviewDFX::HiSysEvent::EventType::STATISTIC, "DO_SUSPEND", static_cast<int8_t>(true));
+    });
 #endif
     if (force) {
+        lockQueue_.SetSynchronous(true);
+        size_t failedNum = lockQueue_.GetFailedHoldCount();
+        if (failedNum != 0) {
+            POWER_HILOGE(COMP_SVC, "%{public}zu running locks not held by hdi, force suspend anyway", failedNum);
+        }
         powerInterface->ForceSuspend();
     } else if (allowSleepTask_.load()) {
+        lockQueue_.SetSynchronous(true);
+        size_t failedNum = lockQueue_.GetFailedHoldCount();
+        if (failedNum != 0) {
+            POWER_HILOGE(COMP_SVC, "%{public}zu running locks not held by hdi, skip suspend", failedNum);
+            lockQueue_.SetSynchronous(false);
+            return;
+        }
         powerInterface->StartSuspend();
     }
 }
@@ -179,10 +208,14 @@ void SystemSuspendController::Wakeup()
         return;
     }
 #ifdef HAS_HIVIEWDFX_HISYSEVENT_PART
-    HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "DO_SUSPEND", HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
-        "TYPE", static_cast<int32_t>(0));
+    PowerEventRecorder::GetInstance().Defer([] {
+        HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "DO_SUSPEND",
+            HiviewDFX::HiSysEvent::EventType::BEHAVIOR, "TYPE", static_cast<int32_t>(0));
+    });
 #endif
     powerInterface->StopSuspend();
+    lockQueue_.SetSynchronous(false);
+    PowerEventRecorder::GetInstance().Flush();
 }
 
 bool SystemSuspendController::Hibernate()
@@ -194,12 +227,20 @@ bool SystemSuspendController::Hibernate()
         return false;
     }
 #ifdef HAS_HIVIEWDFX_HISYSEVENT_PART
-    HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "DO_HIBERNATE",
-        HiviewDFX::HiSysEvent::EventType::BEHAVIOR);
-    HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "HIBERNATE_STATISTIC",
-        HiviewDFX::HiSysEvent::EventType::STATISTIC, "DO_HIBERNATE", static_cast<int8_t>(true));
+    PowerEventRecorder::GetInstance().Defer([] {
+        HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "DO_HIBERNATE",
+            HiviewDFX::HiSysEvent::EventType::BEHAVIOR);
+        HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "HIBERNATE_STATISTIC",
+            HiviewDFX::HiSysEvent::EventType::STATISTIC, "DO_HIBERNATE", static_cast<int8_t>(true));
+    });
 #endif
+    lockQueue_.SetSynchronous(true);
+    size_t failedNum = lockQueue_.GetFailedHoldCount();
+    if (failedNum != 0) {
+        POWER_HILOGW(COMP_SVC, "%{public}zu running locks not held by hdi before hibernate", failedNum);
+    }
     int32_t ret = powerInterface->Hibernate();
+    lockQueue_.SetSynchronous(false);
     if (ret != HDF_SUCCESS) {
         POWER_HILOGE(COMP_SVC, "SystemSuspendController hibernate failed.");
         return false;
@@ -220,6 +261,24 @@ OHOS::HDI::Power::V1_2::RunningLockInfo SystemSuspendController::FillRunningLock
 }
 
 int32_t SystemSuspendController::AcquireRunningLock(const RunningLockParam& param)
+{
+    if (GetPowerInterface() == nullptr) {
+        POWER_HILOGE(COMP_SVC, "The hdf interface is null");
+        return RUNNINGLOCK_FAILURE;
+    }
+    return lockQueue_.Hold(param);
+}
+
+int32_t SystemSuspendController::ReleaseRunningLock(const RunningLockParam& param)
+{
+    if (GetPowerInterface() == nullptr) {
+        POWER_HILOGE(COMP_SVC, "The hdf interface is null");
+        return RUNNINGLOCK_FAILURE;
+    }
+    return lockQueue_.Unhold(param);
+}
+
+int32_t SystemSuspendController::HoldRunningLockHdi(const RunningLockParam& param)
 {
     sptr<V1_3::IPowerInterface> powerInterface = GetPowerInterface();
     int32_t status = RUNNINGLOCK_FAILURE;
@@ -233,7 +292,7 @@ int32_t SystemSuspendController::AcquireRunningLock(const RunningLockParam& para
     return status;
 }
 
-int32_t SystemSuspendController::ReleaseRunningLock(const RunningLockParam& param)
+int32_t SystemSuspendController::UnholdRunningLockHdi(const RunningLockParam& param)
 {
     sptr<V1_3::IPowerInterface> powerInterface = GetPowerInterface();
     int32_t status = RUNNINGLOCK_FAILURE;
@@ -254,6 +313,8 @@ void SystemSuspendController::Dump(std::string& info)
         POWER_HILOGE(COMP_SVC, "The hdf interface is null");
         return;
     }
+    // the dump shows the locks the HDI holds, let it see the pending ones
+    lockQueue_.Drain();
     powerInterface->PowerDump(info);
 }
 
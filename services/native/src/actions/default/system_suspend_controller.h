@@ -18,10 +18,12 @@
 
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include <singleton.h>
 
 #include "actions/running_lock_action_info.h"
+#include "hdi_running_lock_queue.h"
 #include "hdi_service_status_listener.h"
 #include "suspend/irunning_lock_hub.h"
 #include "suspend/isuspend_controller.h"
@@ -35,6 +37,8 @@ using namespace OHOS::HDI::Power;
 class SystemSuspendController : public DelayedRefSingleton<SystemSuspendController> {
 public:
     void Suspend(const std::function<void()>& onSuspend, const std::function<void()>& onWakeup, bool force);
+    // resolve the HDI interface and apply pending lock commands while the suspend callbacks run
+    void PrepareSuspend();
     void Wakeup();
     bool Hibernate();
     int32_t AcquireRunningLock(const RunningLockParam& param);
@@ -67,6 +71,8 @@ private:
     };
     OHOS::HDI::Power::V1_2::RunningLockInfo FillRunningLockInfo(const RunningLockParam& param);
     sptr<V1_3::IPowerInterface> GetPowerInterface();
+    int32_t HoldRunningLockHdi(const RunningLockParam& param);
+    int32_t UnholdRunningLockHdi(const RunningLockParam& param);
     ffrt::mutex mutex_;
     ffrt::mutex interfaceMutex_;
     std::shared_ptr<Suspend::ISuspendController> sc_;
@@ -76,6 +82,8 @@ private:
     sptr<HdiServiceStatusListener::IServStatListener> hdiServStatListener_ { nullptr };
     std::atomic<bool> allowSleepTask_ {false};
     FFRTQueue queue_ {"power_system_suspend_controller"};
+    HdiRunningLockQueue lockQueue_ {[this](const RunningLockParam& param) { return HoldRunningLockHdi(param); },
+        [this](const RunningLockParam& param) { return UnholdRunningLockHdi(param); }};
 };
 } // namespace PowerMgr
 } // namespace OHOS
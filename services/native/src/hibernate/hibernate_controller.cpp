@@ -14,13 +14,27 @@
  */
 
 #include "hibernate_controller.h"
+#include <cinttypes>
 #include <datetime_ex.h>
+#include "parameters.h"
 #include "power_log.h"
 #include "power_common.h"
 #include "system_suspend_controller.h"
 
 namespace OHOS {
 namespace PowerMgr {
+namespace {
+const std::string RECLAIM_STEPS_PARAM = "const.power.hibernate_reclaim_steps";
+const std::string RECLAIM_TARGET_PARAM = "const.power.hibernate_reclaim_target_kb";
+const std::string RECLAIM_TIMEOUT_PARAM = "const.power.hibernate_reclaim_timeout_ms";
+const std::string RECLAIM_MEMCG_PATH_PARAM = "const.power.hibernate_memcg_reclaim_path";
+const std::string MEMORY_PRESSURE_PARAM = "powermgr.hibernate.memory_pressure";
+const std::string DEFAULT_RECLAIM_STEPS = "drop_caches,compact,memcg_reclaim";
+const std::string DEFAULT_RECLAIM_MEMCG_PATH = "/dev/memcg/memory.reclaim";
+constexpr uint32_t DEFAULT_RECLAIM_TIMEOUT_MS = 2000;
+constexpr uint32_t MAX_RECLAIM_TIMEOUT_MS = 30000;
+} // namespace
+
 HibernateController::HibernateController()
 {
     deathRecipient_ = new HibernateDeathRecipient(*this);
@@ -28,6 +42,9 @@ HibernateController::HibernateController()
 
 HibernateStatus HibernateController::Hibernate(bool clearMemory)
 {
+    if (clearMemory) {
+        FinishMemoryReclaim();
+    }
     if (SystemSuspendController::GetInstance().Hibernate()) {
         return HibernateStatus::HIBERNATE_SUCCESS;
     }
@@ -147,6 +164,52 @@ void HibernateController::TriggerCallbacks(const CallbackContainerType& callback
     }
 }
 
+HibernateReclaimConfig HibernateController::LoadReclaimConfig()
+{
+    HibernateReclaimConfig config;
+    config.steps = HibernateMemoryReclaimer::ParseSteps(
+        system::GetParameter(RECLAIM_STEPS_PARAM, DEFAULT_RECLAIM_STEPS));
+    config.targetKb = system::GetIntParameter<int64_t>(RECLAIM_TARGET_PARAM, 0);
+    config.finishTimeoutMs =
+        system::GetUintParameter<uint32_t>(RECLAIM_TIMEOUT_PARAM, DEFAULT_RECLAIM_TIMEOUT_MS, MAX_RECLAIM_TIMEOUT_MS);
+    config.maxDurationMs = MAX_RECLAIM_TIMEOUT_MS;
+    config.memcgReclaimPath = system::GetParameter(RECLAIM_MEMCG_PATH_PARAM, DEFAULT_RECLAIM_MEMCG_PATH);
+    return config;
+}
+
+void HibernateController::SetMemoryPressureHint(bool critical)
+{
+    if (!system::SetParameter(MEMORY_PRESSURE_PARAM, critical ? "critical" : "none")) {
+        POWER_HILOGW(FEATURE_SUSPEND, "set parameter %{public}s failed", MEMORY_PRESSURE_PARAM.c_str());
+    }
+}
+
+void HibernateController::StartMemoryReclaim()
+{
+    HibernateReclaimConfig config = LoadReclaimConfig();
+    if (config.steps.empty()) {
+        POWER_HILOGI(FEATURE_SUSPEND, "Hibernate memory reclaim disabled");
+        return;
+    }
+    SetMemoryPressureHint(true);
+    reclaimer_.Start(config);
+}
+
+void HibernateController::StopMemoryReclaim()
+{
+    reclaimer_.Stop();
+    SetMemoryPressureHint(false);
+}
+
+void HibernateController::FinishMemoryReclaim()
+{
+    HibernateReclaimReport report = reclaimer_.Finish();
+    SetMemoryPressureHint(false);
+    POWER_HILOGI(FEATURE_SUSPEND, "Hibernate memory reclaim: reclaimed=%{public}" PRId64
+        "KB, targetMet=%{public}d, steps=%{public}zu, failed=%{public}u", report.reclaimedKb, report.targetMet,
+        report.steps.size(), report.failedSteps);
+}
+
 void HibernateController::PreHibernate()
 {
     std::lock_guard<std::mutex> lock(mutex_);
@@ -154,10 +217,14 @@ void HibernateController::PreHibernate()
     TriggerCallbacks(highPriorityCallbacks_, true);
     TriggerCallbacks(defaultPriorityCallbacks_, true);
     TriggerCallbacks(lowPriorityCallbacks_, true);
+    // memcg reclaim waits for the callbacks, the rest of the reclaim overlaps with them
+    reclaimer_.OnCallbacksDone();
 }
 
 void HibernateController::PostHibernate(bool hibernateResult)
 {
+    // after a failed prepare the reclaim is still running
+    StopMemoryReclaim();
     std::lock_guard<std::mutex> lock(mutex_);
     if (!prepared_) {
         POWER_HILOGE(FEATURE_SUSPEND, "No need to run OnSyncWakeup");
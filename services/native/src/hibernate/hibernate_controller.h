@@ -24,6 +24,7 @@
 #include "power_common.h"
 #include "hibernate/isync_hibernate_callback.h"
 #include "hibernate/hibernate_callback_priority.h"
+#include "hibernate_memory_reclaimer.h"
 
 namespace OHOS {
 namespace PowerMgr {
@@ -37,10 +38,15 @@ public:
     HibernateController();
     virtual ~HibernateController() = default;
 
+    // with clearMemory, waits for the memory reclaim before the image is written
     virtual HibernateStatus Hibernate(bool clearMemory);
     virtual void RegisterSyncHibernateCallback(const sptr<ISyncHibernateCallback>& cb,
         HibernateCallbackPriority priority);
     virtual void UnregisterSyncHibernateCallback(const sptr<ISyncHibernateCallback>& cb);
+    // runs alongside PreHibernate, the sync callbacks see the memory pressure hint while it runs
+    virtual void StartMemoryReclaim();
+    // stops the reclaim and clears the memory pressure hint, for the paths that skip PostHibernate
+    virtual void StopMemoryReclaim();
     virtual void PreHibernate();
     virtual void PostHibernate(bool hibernateResult = false);
 
@@ -68,6 +74,9 @@ private:
     void RemoveCallbackPidUid(const sptr<ISyncHibernateCallback>& cb);
     void TriggerCallbacks(const CallbackContainerType& callbacks, bool isPreHibernate,
         bool hibernateResult = false);
+    static HibernateReclaimConfig LoadReclaimConfig();
+    static void SetMemoryPressureHint(bool critical);
+    void FinishMemoryReclaim();
 
     bool prepared_ {false};
     std::mutex mutex_;
@@ -76,6 +85,7 @@ private:
     CallbackContainerType defaultPriorityCallbacks_; // guard by mutex_
     CallbackContainerType lowPriorityCallbacks_; // guard by mutex_
     std::map<sptr<ISyncHibernateCallback>, std::pair<int32_t, int32_t>> cachedRegister_; // guard by mutex_
+    HibernateMemoryReclaimer reclaimer_;
 };
 } // namespace PowerMgr
 } // namespace OHOS
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hibernate_memory_reclaimer.h"
+
+#include <cinttypes>
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+
+#include <datetime_ex.h>
+
+#include "parameters.h"
+#include "power_log.h"
+#include "syspara/parameter.h"
+
+namespace OHOS {
+namespace PowerMgr {
+namespace {
+const std::string MEMINFO_PATH = "/proc/meminfo";
+const std::string MEMINFO_FREE_KEY = "MemFree:";
+const std::string MEMINFO_TOTAL_KEY = "MemTotal:";
+} // namespace
+
+HibernateMemoryReclaimer::HibernateMemoryReclaimer(const std::string& rootDir, const StepRunner& runStep)
+    : rootDir_(rootDir), runStep_(runStep)
+{
+    if (runStep_ != nullptr) {
+        return;
+    }
+    runStep_ = [this](const std::string& step, int64_t amountKb) { return RunInitStep(step, amountKb); };
+    // init sets STEP_DONE once the job of a step ran
+    int32_t ret = WatchParameter(STEP_PARAM, OnStepParamChanged, this);
+    watching_ = ret == 0;
+    if (!watching_) {
+        POWER_HILOGW(FEATURE_SUSPEND, "watch %{public}s failed, ret=%{public}d", STEP_PARAM, ret);
+    }
+}
+
+HibernateMemoryReclaimer::~HibernateMemoryReclaimer()
+{
+    Stop();
+    if (watching_) {
+        RemoveParameterWatcher(STEP_PARAM, OnStepParamChanged, this);
+    }
+}
+
+void HibernateMemoryReclaimer::OnStepParamChanged(const char* key, const char* value, void* context)
+{
+    if (context == nullptr) {
+        return;
+    }
+    auto reclaimer = static_cast<HibernateMemoryReclaimer*>(context);
+    {
+        std::lock_guard<ffrt::mutex> lock(reclaimer->mutex_);
+        reclaimer->stepChanged_ = true;
+    }
+    reclaimer->cv_.notify_all();
+}
+
+std::vector<std::string> HibernateMemoryReclaimer::ParseSteps(const std::string& steps)
+{
+    std::vector<std::string> result;
+    std::stringstream stream(steps);
+    std::string step;
+    while (std::getline(stream, step, ',')) {
+        if (step == STEP_DROP_CACHES || step == STEP_COMPACT || step == STEP_MEMCG_RECLAIM) {
+            result.push_back(step);
+        } else if (!step.empty()) {
+            POWER_HILOGW(FEATURE_SUSPEND, "Unknown hibernate reclaim step: %{public}s", step.c_str());
+        }
+    }
+    return result;
+}
+
+void HibernateMemoryReclaimer::Start(const HibernateReclaimConfig& config)
+{
+    Stop();
+    int64_t baseKb = ReadFreeKb();
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        stopping_ = false;
+        callbacksDone_ = false;
+        done_ = false;
+        finishTimeoutMs_ = config.finishTimeoutMs;
+        report_ = {};
+    }
+    POWER_HILOGI(FEATURE_SUSPEND, "Hibernate reclaim start, free=%{public}" PRId64 "KB, target=%{public}" PRId64
+        "KB", baseKb, config.targetKb);
+    int64_t deadlineMs = GetTickCount() + config.maxDurationMs;
+    FFRTUtils::SubmitQueueTasks({[this, config, baseKb, deadlineMs]() { Run(config, baseKb, deadlineMs); }}, queue_);
+}
+
+void HibernateMemoryReclaimer::OnCallbacksDone()
+{
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        callbacksDone_ = true;
+    }
+    cv_.notify_all();
+}
+
+HibernateReclaimReport HibernateMemoryReclaimer::Finish()
+{
+    OnCallbacksDone();
+    uint32_t waitMs = 0;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        waitMs = finishTimeoutMs_;
+    }
+    return Join(waitMs);
+}
+
+void HibernateMemoryReclaimer::Stop()
+{
+    Join(0);
+}
+
+bool HibernateMemoryReclaimer::IsRunning()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return !done_;
+}
+
+HibernateReclaimReport HibernateMemoryReclaimer::Join(uint32_t waitMs)
+{
+    std::unique_lock<ffrt::mutex> lock(mutex_);
+    cv_.wait_for(lock, std::chrono::milliseconds(waitMs), [this]() { return done_; });
+    stopping_ = true;
+    cv_.notify_all();
+    // every wait of the task ends on stopping_, only a step that is being run is finished
+    cv_.wait(lock, [this]() { return done_; });
+    return report_;
+}
+
+void HibernateMemoryReclaimer::Run(const HibernateReclaimConfig& config, int64_t baseKb, int64_t deadlineMs)
+{
+    bool targetMet = RunPass(config.steps, config, baseKb, deadlineMs);
+    std::vector<std::string> repeated;
+    for (const auto& step : config.steps) {
+        if (step == STEP_DROP_CACHES || step == STEP_MEMCG_RECLAIM) {
+            repeated.push_back(step);
+        }
+    }
+    while (!targetMet && config.targetKb > 0 && !repeated.empty()) {
+        {
+            std::unique_lock<ffrt::mutex> lock(mutex_);
+            if (cv_.wait_for(lock, std::chrono::milliseconds(PASS_INTERVAL_MS), [this]() { return stopping_; })) {
+                break;
+            }
+        }
+        if (GetTickCount() >= deadlineMs) {
+            break;
+        }
+        targetMet = RunPass(repeated, config, baseKb, deadlineMs);
+    }
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        report_.targetMet = targetMet;
+        done_ = true;
+        POWER_HILOGI(FEATURE_SUSPEND, "Hibernate reclaim end, reclaimed=%{public}" PRId64 "KB, targetMet=%{public}d, "
+            "failedSteps=%{public}u", report_.reclaimedKb, targetMet, report_.failedSteps);
+    }
+    cv_.notify_all();
+}
+
+bool HibernateMemoryReclaimer::RunPass(
+    const std::vector<std::string>& steps, const HibernateReclaimConfig& config, int64_t baseKb, int64_t deadlineMs)
+{
+    for (const auto& step : steps) {
+        if (step == STEP_MEMCG_RECLAIM && !WaitForCallbacks(deadlineMs)) {
+            return false;
+        }
+        if (IsStopping()) {
+            return false;
+        }
+        int64_t beforeKb = ReadFreeKb();
+        int64_t start = GetTickCount();
+        bool ret = RunStep(step, config, beforeKb - baseKb);
+        int64_t afterKb = ReadFreeKb();
+        HibernateReclaimStep result {step, GetTickCount() - start, afterKb - beforeKb, ret};
+        POWER_HILOGI(FEATURE_SUSPEND, "Hibernate reclaim %{public}s ret=%{public}d, cost=%{public}" PRId64
+            "ms, reclaimed=%{public}" PRId64 "KB", step.c_str(), ret, result.costMs, result.reclaimedKb);
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        report_.steps.push_back(result);
+        report_.failedSteps += ret ? 0 : 1;
+        report_.reclaimedKb = afterKb - baseKb;
+        if (config.targetKb > 0 && report_.reclaimedKb >= config.targetKb) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool HibernateMemoryReclaimer::RunStep(const std::string& step, const HibernateReclaimConfig& config,
+    int64_t reclaimedKb)
+{
+    if (step != STEP_MEMCG_RECLAIM) {
+        return runStep_(step, 0);
+    }
+    if (config.memcgReclaimPath.empty() || access((rootDir_ + config.memcgReclaimPath).c_str(), F_OK) != 0) {
+        POWER_HILOGW(FEATURE_SUSPEND, "Hibernate reclaim %{public}s skipped, no %{public}s", step.c_str(),
+            config.memcgReclaimPath.c_str());
+        return false;
+    }
+    // what is left of the target, without one all the memory the kernel is able to free
+    int64_t amountKb = config.targetKb > 0 ? config.targetKb - reclaimedKb : ReadMeminfoKb(MEMINFO_TOTAL_KEY);
+    if (amountKb <= 0) {
+        return true;
+    }
+    return runStep_(step, amountKb);
+}
+
+bool HibernateMemoryReclaimer::RunInitStep(const std::string& name, int64_t amountKb)
+{
+    if (amountKb > 0 && !system::SetParameter(AMOUNT_PARAM, std::to_string(amountKb) + "K")) {
+        POWER_HILOGW(FEATURE_SUSPEND, "set parameter %{public}s failed", AMOUNT_PARAM);
+        return false;
+    }
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        stepChanged_ = false;
+    }
+    if (!system::SetParameter(STEP_PARAM, name)) {
+        POWER_HILOGW(FEATURE_SUSPEND, "set parameter %{public}s failed", STEP_PARAM);
+        return false;
+    }
+    int64_t deadline = GetTickCount() + STEP_TIMEOUT_MS;
+    std::unique_lock<ffrt::mutex> lock(mutex_);
+    while (!stopping_) {
+        // the watcher also fires for the step name written above, so the value is read again
+        if (stepChanged_) {
+            stepChanged_ = false;
+            if (system::GetParameter(STEP_PARAM, "") == STEP_DONE) {
+                return true;
+            }
+        }
+        int64_t waitMs = deadline - GetTickCount();
+        if (waitMs <= 0) {
+            break;
+        }
+        cv_.wait_for(lock, std::chrono::milliseconds(waitMs), [this]() { return stepChanged_ || stopping_; });
+    }
+    POWER_HILOGW(FEATURE_SUSPEND, "Hibernate reclaim %{public}s not done by init", name.c_str());
+    return false;
+}
+
+int64_t HibernateMemoryReclaimer::ReadFreeKb() const
+{
+    return ReadMeminfoKb(MEMINFO_FREE_KEY);
+}
+
+int64_t HibernateMemoryReclaimer::ReadMeminfoKb(const std::string& key) const
+{
+    std::ifstream meminfo(rootDir_ + MEMINFO_PATH);
+    std::string line;
+    while (std::getline(meminfo, line)) {
+        std::istringstream fields(line);
+        std::string name;
+        int64_t value = 0;
+        if ((fields >> name >> value) && name == key) {
+            return value;
+        }
+    }
+    return 0;
+}
+
+bool HibernateMemoryReclaimer::WaitForCallbacks(int64_t deadlineMs)
+{
+    std::unique_lock<ffrt::mutex> lock(mutex_);
+    int64_t waitMs = deadlineMs - GetTickCount();
+    if (waitMs > 0) {
+        cv_.wait_for(lock, std::chrono::milliseconds(waitMs), [this]() { return callbacksDone_ || stopping_; });
+    }
+    return callbacksDone_ && !stopping_;
+}
+
+bool HibernateMemoryReclaimer::IsStopping()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return stopping_;
+}
+} // namespace PowerMgr
+} // namespace OHOS
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_POWER_MANAGER_HIBERNATE_MEMORY_RECLAIMER_H
+#define POWERMGR_POWER_MANAGER_HIBERNATE_MEMORY_RECLAIMER_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "ffrt_utils.h"
+
+namespace OHOS {
+namespace PowerMgr {
+struct HibernateReclaimConfig {
+    // steps run in this order on the first pass, see HibernateMemoryReclaimer::STEP_*
+    std::vector<std::string> steps;
+    // stop as soon as MemFree grew by this much, 0 runs every step once
+    int64_t targetKb {0};
+    // how long Finish waits for the target once the sync callbacks are done
+    uint32_t finishTimeoutMs {2000};
+    // the reclaim never runs longer than this, even if Finish is never called
+    uint32_t maxDurationMs {30000};
+    // memory.reclaim of the root memory cgroup, memcg reclaim fails when it does not exist
+    std::string memcgReclaimPath;
+};
+
+struct HibernateReclaimStep {
+    std::string name;
+    int64_t costMs {0};
+    int64_t reclaimedKb {0};
+    bool succeeded {false};
+};
+
+struct HibernateReclaimReport {
+    int64_t reclaimedKb {0};
+    bool targetMet {false};
+    uint32_t failedSteps {0};
+    std::vector<HibernateReclaimStep> steps;
+};
+
+/**
+ * Frees memory before the hibernate image is written: the page cache is dropped, memory compacted and
+ * the pages of every process reclaimed through the root memory cgroup. The knobs are root only, so the
+ * steps are run by init, see the powermgr.hibernate.reclaim jobs in powermgr.cfg, and MemFree is read
+ * from rootDir/proc/meminfo around each of them. The reclaim runs on an ffrt queue while the sync
+ * hibernate callbacks are called, memcg reclaim waits for them to return so that they do not fault
+ * their pages back in. Without a target each step runs once. With one, page cache and memcg reclaim
+ * are repeated, to catch the memory released by the callbacks and the services that stop, until
+ * MemFree grew by the target.
+ */
+class HibernateMemoryReclaimer {
+public:
+    static constexpr const char* STEP_DROP_CACHES = "drop_caches";
+    static constexpr const char* STEP_COMPACT = "compact";
+    static constexpr const char* STEP_MEMCG_RECLAIM = "memcg_reclaim";
+    static constexpr const char* STEP_PARAM = "powermgr.hibernate.reclaim";
+    // what memcg reclaim writes to memory.reclaim, "<kb>K"
+    static constexpr const char* AMOUNT_PARAM = "powermgr.hibernate.reclaim_amount";
+    static constexpr const char* STEP_DONE = "done";
+    static constexpr uint32_t PASS_INTERVAL_MS = 200;
+    static constexpr uint32_t STEP_TIMEOUT_MS = 5000;
+
+    // runs one step, memcg reclaim frees amountKb, true when it succeeded
+    using StepRunner = std::function<bool(const std::string& step, int64_t amountKb)>;
+
+    // without a runner the steps are handed to init through STEP_PARAM
+    explicit HibernateMemoryReclaimer(const std::string& rootDir = "", const StepRunner& runStep = nullptr);
+    ~HibernateMemoryReclaimer();
+
+    // "drop_caches,compact" to the steps it names, unknown ones are skipped
+    static std::vector<std::string> ParseSteps(const std::string& steps);
+
+    void Start(const HibernateReclaimConfig& config);
+    // lets memcg reclaim run, to call once the sync callbacks returned
+    void OnCallbacksDone();
+    // waits until the reclaim is done or finishTimeoutMs passed, then stops it
+    HibernateReclaimReport Finish();
+    // stops at once, a step run by init is not waited for, the report is dropped
+    void Stop();
+    bool IsRunning();
+    int64_t ReadFreeKb() const;
+
+private:
+    static void OnStepParamChanged(const char* key, const char* value, void* context);
+    void Run(const HibernateReclaimConfig& config, int64_t baseKb, int64_t deadlineMs);
+    // true when the target is met
+    bool RunPass(const std::vector<std::string>& steps, const HibernateReclaimConfig& config, int64_t baseKb,
+        int64_t deadlineMs);
+    bool RunStep(const std::string& step, const HibernateReclaimConfig& config, int64_t reclaimedKb);
+    bool RunInitStep(const std::string& name, int64_t amountKb);
+    bool WaitForCallbacks(int64_t deadlineMs);
+    bool IsStopping();
+    int64_t ReadMeminfoKb(const std::string& key) const;
+    HibernateReclaimReport Join(uint32_t waitMs);
+
+    std::string rootDir_;
+    StepRunner runStep_;
+    bool watching_ {false};
+    ffrt::mutex mutex_;
+    ffrt::condition_variable cv_;
+    bool stopping_ {false}; // guard by mutex_
+    bool callbacksDone_ {false}; // guard by mutex_
+    bool stepChanged_ {false}; // guard by mutex_
+    bool done_ {true}; // guard by mutex_
+    uint32_t finishTimeoutMs_ {0}; // guard by mutex_
+    HibernateReclaimReport report_; // guard by mutex_
+    // declared last, destroyed first, so that the running task never outlives the members
+    FFRTQueue queue_ {"power_hibernate_reclaim"};
+};
+} // namespace PowerMgr
+} // namespace OHOS
+
+#endif // POWERMGR_POWER_MANAGER_HIBERNATE_MEMORY_RECLAIMER_H
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "power_event_recorder.h"
+
+namespace OHOS {
+namespace PowerMgr {
+PowerEventRecorder& PowerEventRecorder::GetInstance()
+{
+    static PowerEventRecorder* instance = new PowerEventRecorder(
+        [](const std::vector<FFRTTask>& tasks, uint32_t delayMs) {
+            static FFRTQueue queue("power_event_recorder");
+            if (delayMs == 0) {
+                FFRTUtils::SubmitQueueTasks(tasks, queue);
+                return;
+            }
+            for (auto task : tasks) {
+                FFRTUtils::SubmitDelayTask(task, delayMs, queue);
+            }
+        });
+    return *instance;
+}
+
+PowerEventRecorder::PowerEventRecorder(const Submitter& submit) : submit_(submit)
+{
+}
+
+void PowerEventRecorder::Record(const FFRTTask& write)
+{
+    bool startTimer = false;
+    bool full = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        events_.push_back(write);
+        startTimer = OnPendingLocked();
+        full = events_.size() >= MAX_PENDING_EVENT_NUM;
+    }
+    if (full) {
+        Flush();
+    } else if (startTimer) {
+        StartTimer();
+    }
+}
+
+void PowerEventRecorder::Defer(const FFRTTask& write)
+{
+    bool full = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        events_.push_back(write);
+        full = events_.size() >= MAX_PENDING_EVENT_NUM;
+    }
+    // no flush for a long time, do not keep growing
+    if (full) {
+        Flush();
+    }
+}
+
+bool PowerEventRecorder::OnPendingLocked()
+{
+    if (timerStarted_) {
+        return false;
+    }
+    timerStarted_ = true;
+    return true;
+}
+
+void PowerEventRecorder::StartTimer()
+{
+    submit_({[this]() { Flush(); }}, FLUSH_DELAY_MS);
+}
+
+void PowerEventRecorder::Flush()
+{
+    std::vector<FFRTTask> tasks = TakePending();
+    if (tasks.empty()) {
+        return;
+    }
+    submit_(tasks, 0);
+}
+
+std::vector<FFRTTask> PowerEventRecorder::TakePending()
+{
+    std::vector<FFRTTask> tasks;
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks.swap(events_);
+    timerStarted_ = false;
+    return tasks;
+}
+
+size_t PowerEventRecorder::GetPendingCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return events_.size();
+}
+} // namespace PowerMgr
+} // namespace OHOS
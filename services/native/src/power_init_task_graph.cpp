@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "power_init_task_graph.h"
+
+#include <chrono>
+#include <cinttypes>
+
+#include "ffrt_utils.h"
+#include "power_log.h"
+
+namespace OHOS {
+namespace PowerMgr {
+int64_t PowerInitTaskGraph::GetNowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int32_t PowerInitTaskGraph::FindStep(const std::string& name) const
+{
+    for (size_t index = 0; index < steps_.size(); index++) {
+        if (steps_[index]->name == name) {
+            return static_cast<int32_t>(index);
+        }
+    }
+    return -1;
+}
+
+bool PowerInitTaskGraph::AddStep(const std::string& name, const std::vector<std::string>& deps, const StepFunc& func)
+{
+    std::lock_guard lock(mutex_);
+    if (func == nullptr || FindStep(name) >= 0) {
+        POWER_HILOGE(COMP_SVC, "[%{public}s] invalid init step %{public}s", name_.c_str(), name.c_str());
+        return false;
+    }
+    auto step = std::make_unique<Step>();
+    step->name = name;
+    step->func = func;
+    for (const auto& dep : deps) {
+        int32_t index = FindStep(dep);
+        if (index < 0) {
+            // dependencies must be declared first, which also keeps the graph acyclic
+            POWER_HILOGE(COMP_SVC, "[%{public}s] step %{public}s depends on unknown step %{public}s",
+                name_.c_str(), name.c_str(), dep.c_str());
+            return false;
+        }
+        step->deps.push_back(static_cast<size_t>(index));
+    }
+    steps_.push_back(std::move(step));
+    return true;
+}
+
+void PowerInitTaskGraph::RunStep(Step& step)
+{
+    int64_t startUs = GetNowUs();
+    bool ret = step.func();
+    int64_t costUs = GetNowUs() - startUs;
+    {
+        std::lock_guard lock(mutex_);
+        step.startUs = startUs - beginUs_;
+        step.costUs = costUs;
+        step.executed = true;
+        step.succeed = ret;
+    }
+    POWER_HILOGI(COMP_SVC, "[%{public}s] step %{public}s done, ret=%{public}d, cost=%{public}" PRId64 "us",
+        name_.c_str(), step.name.c_str(), ret, costUs);
+}
+
+bool PowerInitTaskGraph::Run(bool parallel)
+{
+    std::vector<Step*> steps;
+    {
+        std::lock_guard lock(mutex_);
+        parallel_ = parallel;
+        beginUs_ = GetNowUs();
+        for (auto& step : steps_) {
+            step->executed = false;
+            step->succeed = false;
+            steps.push_back(step.get());
+        }
+    }
+    if (parallel) {
+        // steps are stored in topological order, submit order satisfies FFRT dependency rules
+        for (Step* step : steps) {
+            std::vector<ffrt::dependence> inDeps;
+            for (size_t dep : step->deps) {
+                inDeps.emplace_back(static_cast<const void*>(steps[dep]));
+            }
+            std::vector<ffrt::dependence> outDeps { static_cast<const void*>(step) };
+            ffrt::submit([this, step]() { RunStep(*step); }, inDeps, outDeps,
+                ffrt::task_attr().name(step->name.c_str()));
+        }
+        ffrt::wait();
+    } else {
+        for (Step* step : steps) {
+            RunStep(*step);
+        }
+    }
+    totalCostUs_ = GetNowUs() - beginUs_;
+    bool ret = true;
+    std::lock_guard lock(mutex_);
+    for (const auto& step : steps_) {
+        ret = ret && step->succeed;
+    }
+    POWER_HILOGI(COMP_SVC, "[%{public}s] %{public}zu steps done, parallel=%{public}d, total=%{public}" PRId64 "us",
+        name_.c_str(), steps_.size(), parallel, totalCostUs_.load());
+    return ret;
+}
+
+bool PowerInitTaskGraph::IsStepSucceed(const std::string& name) const
+{
+    std::lock_guard lock(mutex_);
+    int32_t index = FindStep(name);
+    return index >= 0 && steps_[index]->succeed;
+}
+
+size_t PowerInitTaskGraph::GetStepCount() const
+{
+    std::lock_guard lock(mutex_);
+    return steps_.size();
+}
+
+void PowerInitTaskGraph::DumpInfo(std::string& result) const
+{
+    std::lock_guard lock(mutex_);
+    result.append("INIT GRAPH: ").append(name_)
+        .append(" parallel=").append(parallel_ ? "true" : "false")
+        .append(" total=").append(std::to_string(totalCostUs_.load())).append("us\n");
+    for (const auto& step : steps_) {
+        result.append("  ").append(step->name)
+            .append(" start=").append(std::to_string(step->startUs)).append("us")
+            .append(" cost=").append(std::to_string(step->costUs)).append("us")
+            .append(" state=").append(!step->executed ? "pending" : (step->succeed ? "ok" : "failed"));
+        if (!step->deps.empty()) {
+            result.append(" deps=");
+            for (size_t index = 0; index < step->deps.size(); index++) {
+                result.append(index == 0 ? "" : ",").append(steps_[step->deps[index]]->name);
+            }
+        }
+        result.append("\n");
+    }
+}
+} // namespace PowerMgr
+} // namespace OHOS
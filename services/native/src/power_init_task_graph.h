@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_POWER_INIT_TASK_GRAPH_H
+#define POWERMGR_POWER_INIT_TASK_GRAPH_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Init steps of the power service, each declaring the steps it depends on.
+ * Steps without a dependency path between them are run concurrently on FFRT,
+ * and the wall time of every step is recorded for hidumper.
+ */
+class PowerInitTaskGraph {
+public:
+    using StepFunc = std::function<bool()>;
+
+    explicit PowerInitTaskGraph(const std::string& name) : name_(name) {}
+    ~PowerInitTaskGraph() = default;
+
+    /**
+     * Add an init step. Every dependency must have been added before.
+     *
+     * @return false if the name is duplicated or a dependency is unknown.
+     */
+    bool AddStep(const std::string& name, const std::vector<std::string>& deps, const StepFunc& func);
+    /**
+     * Run all steps, blocking until every step has finished.
+     *
+     * @param parallel run independent steps concurrently, otherwise in declaration order.
+     * @return false if any step failed.
+     */
+    bool Run(bool parallel = true);
+    bool IsStepSucceed(const std::string& name) const;
+    size_t GetStepCount() const;
+    int64_t GetTotalCostUs() const
+    {
+        return totalCostUs_;
+    }
+    void DumpInfo(std::string& result) const;
+
+private:
+    struct Step {
+        std::string name;
+        std::vector<size_t> deps;
+        StepFunc func;
+        int64_t startUs {0};
+        int64_t costUs {0};
+        bool executed {false};
+        bool succeed {false};
+    };
+    static int64_t GetNowUs();
+    void RunStep(Step& step);
+    int32_t FindStep(const std::string& name) const;
+
+    std::string name_;
+    mutable std::mutex mutex_;
+    // steps are only appended before Run, their addresses are used as FFRT data dependencies
+    std::vector<std::unique_ptr<Step>> steps_;
+    int64_t beginUs_ {0};
+    std::atomic<int64_t> totalCostUs_ {0};
+    bool parallel_ {true};
+};
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWERMGR_POWER_INIT_TASK_GRAPH_H
@@ -28,6 +28,9 @@ const std::string ARGS_DIALOG = "-d";
 const std::string ARGS_REG_KEY = "-k";
 const std::string ARGS_On = "-t";
 const std::string ARGS_Off = "-f";
+const std::string ARGS_INIT = "-i";
+const std::string ARGS_SUSPEND = "-p";
+const std::string ARGS_SHUTDOWN = "-o";
 }
 
 bool PowerMgrDumper::Dump(const std::vector<std::string>& args, std::string& result)
@@ -58,6 +61,26 @@ bool PowerMgrDumper::Dump(const std::vector<std::string>& args, std::string& res
                 continue;
             }
             stateMachine->DumpInfo(result);
+        } else if (*it == ARGS_INIT) {
+            pms->DumpInitInfo(result);
+        } else if (*it == ARGS_SUSPEND) {
+            auto suspendController = pms->GetSuspendController();
+            if (suspendController == nullptr) {
+                continue;
+            }
+            suspendController->DumpSuspendEntry(result);
+#ifdef POWER_MANAGER_WAKEUP_ACTION
+            auto wakeupActionController = pms->GetWakeupActionController();
+            if (wakeupActionController != nullptr) {
+                wakeupActionController->DumpInfo(result);
+            }
+#endif
+        } else if (*it == ARGS_SHUTDOWN) {
+            auto shutdownController = pms->GetShutdownController();
+            if (shutdownController == nullptr) {
+                continue;
+            }
+            shutdownController->DumpInfo(result);
         } else if (*it == ARGS_ALL) {
             result.clear();
             auto stateMachine = pms->GetPowerStateMachine();
@@ -106,6 +129,9 @@ void PowerMgrDumper::ShowUsage(std::string& result)
         .append("    -h: show this help.\n")
         .append("    -r: show the information of runninglock.\n")
         .append("    -s: show the information of power state machine.\n")
+        .append("    -i: show the cost of power service init steps.\n")
+        .append("    -p: show the cost of recent suspend cycles and dark wakeups.\n")
+        .append("    -o: show the phase cost of the last shutdown or reboot.\n")
         .append("    -d: show power off dialog.\n")
         .append("    -k: subscribe long press powerkey event.\n")
         .append("    -t: keep screen on.\n")
@@ -37,20 +37,24 @@
 #include "ability_connect_callback_stub.h"
 #include "ability_manager_client.h"
 #include "ffrt_utils.h"
-#include <multi_invoker_helper/multi_invoker_helper.h>
 #include "permission.h"
 #include "power_ext_intf_wrapper.h"
 #include "power_common.h"
+#include "power_init_task_graph.h"
+#include "power_profile_loader.h"
+#include "power_utils.h"
+#include <power_vote/power_vote.h>
 #include "power_mgr_dumper.h"
-#include "power_vibrator.h"
 #include "power_xcollie.h"
 #include "setting_helper.h"
 #include "running_lock_timer_handler.h"
 #include "sysparam.h"
+#include "sysparam_cache.h"
 #include "system_suspend_controller.h"
 #include "xcollie/watchdog.h"
 #include "errors.h"
 #include "parameters.h"
+#include "power_log_budget.h"
 #ifdef POWER_LID_FOLD_ENABLE
 #include "display_manager_lite.h"
 #endif
@@ -60,8 +64,8 @@
 #ifdef POWER_MANAGER_ENABLE_CHARGING_TYPE_SETTING
 #include "battery_srv_client.h"
 #endif
-#ifdef POWER_MANAGER_ENABLE_SUSPEND_WITH_TAG
 #include "syspara/parameter.h"
+#ifdef POWER_MANAGER_ENABLE_SUSPEND_WITH_TAG
 #include <chrono>
 #include <condition_variable>
 #include <mutex>
@@ -86,9 +90,6 @@ const char* POWER_PLUGIN_AUTORUN_PATH = "/system/lib/powerplugin/autorun";
 #endif
 const std::string POWERMGR_SERVICE_NAME = "PowerMgrService";
 const std::string REASON_POWER_KEY = "power_key";
-const std::string POWER_VIBRATOR_CONFIG_FILE = "etc/power_config/power_vibrator.json";
-const std::string VENDOR_POWER_VIBRATOR_CONFIG_FILE = "/vendor/etc/power_config/power_vibrator.json";
-const std::string SYSTEM_POWER_VIBRATOR_CONFIG_FILE = "/system/etc/power_config/power_vibrator.json";
 static const char* POWER_MANAGER_EXT_PATH = "libpower_manager_ext.z.so";
 constexpr int32_t WAKEUP_LOCK_TIMEOUT_MS = 5000;
 constexpr int32_t SET_SUSPEND_TAG_TIMEOUT_MS = 40000; // ULSR_SYNC_CALLBACK_TIMEOUT_MS + 10000
@@ -97,25 +98,6 @@ constexpr int32_t SET_SUSPEND_TAG_TIMEOUT_MS = 40000; // ULSR_SYNC_CALLBACK_TIME
 constexpr int32_t ULSR_TIMER_TIMEOUT_MS = 60000;
 constexpr int32_t ULSR_TIMER_EXPIRED_TIMEOUT_MS = 40000; // ULSR_SYNC_CALLBACK_TIMEOUT_MS + 10000
 const std::string ULSR_RESULT_PARAM = "persist.hdi_power.ulsr_result";
-constexpr int32_t ULSR_RESULT_WAIT_TIMEOUT_MS = 2000; // Maximum waiting time for the ULSR result to be ready
-constexpr int32_t ERR_PARAM_WATCHER_REPEAT_ADD = 110;
-// Global context for ULSR parameter watcher
-static std::mutex g_ulsrResultMutex;
-static std::condition_variable g_ulsrResultCv;
-static bool g_ulsrResultReady = false;
-static std::atomic_bool g_ulsrResultWaitTaskStart = false;
-// C-style callback for WatchParameter
-static void UlsrParamChangeCallback(const char* key, const char* value, void* context)
-{
-    POWER_HILOGI(FEATURE_WAKEUP, "UlsrParamChangeCallback, value: %{public}s", value);
-    if (value == nullptr || value[0] == '\0') {
-        POWER_HILOGI(FEATURE_WAKEUP, "UlsrParamChangeCallback, value is nullptr or empty, still not ready!");
-        return; // Ignore empty value changes
-    }
-    std::lock_guard lock(g_ulsrResultMutex);
-    g_ulsrResultReady = true;
-    g_ulsrResultCv.notify_all();
-}
 #endif
 constexpr int32_t COLLABORATION_REMOTE_DEVICE_ID = 0xAAAAAAFF;
 constexpr int32_t INPUT_TASK_TIMEOUT = 50000;
@@ -129,6 +111,13 @@ bool g_isPickUpOpen = false;
 #endif
 constexpr int32_t API19 = 19;
 
+void OnLogBudgetChanged(const char* key, const char* value, void* context)
+{
+    if (!PowerLogBudgetConfig::GetInstance().Apply(value)) {
+        POWER_HILOGW(COMP_SVC, "invalid log budget: %{public}s", value == nullptr ? "" : value);
+    }
+}
+
 uint64_t NormalizeDisplayId(uint64_t displayId)
 {
 #ifdef POWER_MANAGER_LOCK_SUPPORT_MULTI_SCREEN
@@ -179,6 +168,7 @@ void PowerMgrService::OnStart()
     AddSystemAbilityListener(MSDP_MOTION_SERVICE_ID);
 #endif
     AddSystemAbilityListener(COMMON_EVENT_SERVICE_ID);
+    AddSystemAbilityListener(APP_MGR_SERVICE_ID);
 #ifndef FUZZ_TEST
     SystemSuspendController::GetInstance().RegisterHdiStatusListener();
     PowerExtIntfWrapper::Instance().Init();
@@ -202,34 +192,71 @@ bool PowerMgrService::Init()
     if (!runningLockMgr_) {
         runningLockMgr_ = std::make_shared<RunningLockMgr>(pms);
     }
-    if (!runningLockMgr_->Init()) {
-        POWER_HILOGE(COMP_SVC, "Running lock init fail");
-        return false;
-    }
     if (!shutdownController_) {
         shutdownController_ = std::make_shared<ShutdownController>();
     }
-    if (!PowerStateMachineInit()) {
-        POWER_HILOGE(COMP_SVC, "Power state machine init fail");
-    }
-    if (!screenOffPreController_) {
-        screenOffPreController_ = std::make_shared<ScreenOffPreController>(powerStateMachine_);
-        screenOffPreController_->Init();
-    }
-    isDuringCallStateEnable_ = system::GetBoolParameter("const.power.during_call_state_enable", false);
+    auto graph = std::make_shared<PowerInitTaskGraph>("OnStart");
+    graph->AddStep("RunningLockMgr", {}, [this]() { return runningLockMgr_->Init(); });
+    graph->AddStep("PowerStateMachine", {}, [this]() { return PowerStateMachineInit(); });
+    graph->AddStep("ScreenOffPreController", {"PowerStateMachine"}, [this]() {
+        if (!screenOffPreController_) {
+            screenOffPreController_ = std::make_shared<ScreenOffPreController>(powerStateMachine_);
+            screenOffPreController_->Init();
+        }
+        return true;
+    });
+    graph->AddStep("ConstParameters", {}, [this]() {
+        isDuringCallStateEnable_ = system::GetBoolParameter("const.power.during_call_state_enable", false);
 #ifdef POWER_LID_FOLD_ENABLE
-    foldScreenFlag_ = system::GetParameter("const.window.foldscreen.type", "") != "";
+        foldScreenFlag_ = system::GetParameter("const.window.foldscreen.type", "") != "";
 #endif
-    isLidCheckEnable_ = system::GetBoolParameter("const.power.enable_lid_check", false);
+        isLidCheckEnable_ = system::GetBoolParameter("const.power.enable_lid_check", false);
 #ifdef POWER_MANAGER_POWER_ENABLE_S4
-    isHibernateEnable_ = system::GetBoolParameter("const.power.enable_s4", true);
+        isHibernateEnable_ = system::GetBoolParameter("const.power.enable_s4", true);
 #endif
-    isExternalScreenWakeup_ = system::GetBoolParameter("const.power.external_screen_wakeup", false);
+        isExternalScreenWakeup_ = system::GetBoolParameter("const.power.external_screen_wakeup", false);
+        return true;
+    });
+    graph->AddStep("LogBudget", {}, []() {
+        std::string budget = system::GetParameter(PowerLogBudgetConfig::PARAM_KEY, "");
+        if (!budget.empty()) {
+            OnLogBudgetChanged(PowerLogBudgetConfig::PARAM_KEY, budget.c_str(), nullptr);
+        }
+        int32_t ret = WatchParameter(PowerLogBudgetConfig::PARAM_KEY, OnLogBudgetChanged, nullptr);
+        POWER_HILOGI(COMP_SVC, "log budget watcher add ret: %{public}d", ret);
+        return true;
+    });
+    graph->Run(IsParallelInitEnable());
+    startInitGraph_ = graph;
+    if (!graph->IsStepSucceed("RunningLockMgr")) {
+        POWER_HILOGE(COMP_SVC, "Running lock init fail");
+        return false;
+    }
+    if (!graph->IsStepSucceed("PowerStateMachine")) {
+        POWER_HILOGE(COMP_SVC, "Power state machine init fail");
+    }
     POWER_HILOGI(COMP_SVC, "powermgr service init success, duringCallStateEnable: %{public}d",\
         isDuringCallStateEnable_);
     return true;
 }
 
+bool PowerMgrService::IsParallelInitEnable()
+{
+    return system::GetBoolParameter("const.power.parallel_init_enable", false);
+}
+
+void PowerMgrService::DumpInitInfo(std::string& result)
+{
+    if (startInitGraph_ != nullptr) {
+        startInitGraph_->DumpInfo(result);
+    }
+    // published by the boot completed callback while a dump may be running
+    std::shared_ptr<PowerInitTaskGraph> bootInitGraph = std::atomic_load(&bootInitGraph_);
+    if (bootInitGraph != nullptr) {
+        bootInitGraph->DumpInfo(result);
+    }
+}
+
 void PowerMgrService::RegisterBootCompletedCallback()
 {
     POWER_HILOGI(COMP_SVC, "plan to RegisterBootCompletedCallback.");
@@ -246,38 +273,111 @@ void PowerMgrService::RegisterBootCompletedCallback()
             POWER_HILOGE(COMP_SVC, "get PowerMgrService fail");
             return;
         }
-        auto powerStateMachine = power->GetPowerStateMachine();
+        std::shared_ptr<PowerInitTaskGraph> bootInitGraph = power->CreateBootCompletedInitGraph();
+        std::atomic_store(&power->bootInitGraph_, bootInitGraph);
+        bootInitGraph->Run(IsParallelInitEnable());
+        isBootCompleted_ = true;
+    };
+    SysParam::RegisterBootCompletedCallbackForPowerSa(g_bootCompletedCallback);
+}
+
+std::shared_ptr<PowerInitTaskGraph> PowerMgrService::CreateBootCompletedInitGraph()
+{
+    auto graph = std::make_shared<PowerInitTaskGraph>("BootCompleted");
+    // update setting user id before get setting values
+    graph->AddStep("SettingUserId", {}, []() {
 #ifdef POWER_PICKUP_ENABLE
         SettingHelper::CopyDataForUpdateScene();
 #endif
-        SettingHelper::UpdateCurrentUserId(); // update setting user id before get setting values
+        SettingHelper::UpdateCurrentUserId();
+        return true;
+    });
+    std::vector<std::string> displayOffTimeDeps {"SettingUserId"};
 #ifdef POWER_MANAGER_ENABLE_CHARGING_TYPE_SETTING
-        power->PowerConnectStatusInit();
-        power->UpdateSettingInvalidDisplayOffTime(); // update setting value if invalid before register
+    graph->AddStep("PowerConnectStatus", {"SettingUserId"}, [this]() {
+        PowerConnectStatusInit();
+        UpdateSettingInvalidDisplayOffTime(); // update setting value if invalid before register
+        return true;
+    });
+    displayOffTimeDeps.push_back("PowerConnectStatus");
 #endif
-        powerStateMachine->RegisterDisplayOffTimeObserver();
-        powerStateMachine->InitState();
+    graph->AddStep("DisplayOffTimeObserver", displayOffTimeDeps, [this]() {
+        powerStateMachine_->RegisterDisplayOffTimeObserver();
+        return true;
+    });
+    graph->AddStep("InitState", {"DisplayOffTimeObserver"}, [this]() {
+        powerStateMachine_->InitState();
+        return true;
+    });
+    graph->AddStep("AodSwitchObserver", {"SettingUserId"}, []() {
         SettingHelper::RegisterAodSwitchObserver();
+        return true;
+    });
+    // the long press of the power key is subscribed before the controllers subscribe the key themselves
+    std::vector<std::string> inputDeps {"InitState"};
 #ifdef POWER_MANAGER_POWER_DIALOG
-        power->GetShutdownDialog().LoadDialogConfig();
-        power->GetShutdownDialog().KeyMonitorInit();
-#endif
-        power->SwitchSubscriberInit();
-        power->InputMonitorInit();
-        power->SuspendControllerInit();
-        power->WakeupControllerInit();
-        power->SubscribeCommonEvent();
+    graph->AddStep("ShutdownDialog", {"InitState"}, [this]() {
+        shutdownDialog_.LoadDialogConfig();
+        shutdownDialog_.KeyMonitorInit();
+        return true;
+    });
+    inputDeps.push_back("ShutdownDialog");
+#endif
+    // profiles are parsed once here, the controllers below take the published snapshot
+    std::vector<std::string> profileDeps {"SettingUserId"};
+#ifdef POWER_MANAGER_ENABLE_CHARGING_TYPE_SETTING
+    profileDeps.push_back("PowerConnectStatus");
+#endif
+    graph->AddStep("ProfileLoader", profileDeps, []() {
+        PowerProfileLoader::GetInstance().Load();
+        return true;
+    });
+    graph->AddStep("SwitchSubscriber", {"InitState"}, [this]() {
+        SwitchSubscriberInit();
+        return true;
+    });
+    graph->AddStep("InputMonitor", inputDeps, [this]() {
+        InputMonitorInit();
+        return true;
+    });
+    std::vector<std::string> controllerDeps = inputDeps;
+    controllerDeps.push_back("ProfileLoader");
+    graph->AddStep("SuspendController", controllerDeps, [this]() {
+        SuspendControllerInit();
+        return true;
+    });
+    graph->AddStep("WakeupController", controllerDeps, [this]() {
+        WakeupControllerInit();
+        return true;
+    });
+    // a user switch re-registers the setting observers of the controllers
+    graph->AddStep("CommonEvent", {"SuspendController", "WakeupController"}, [this]() {
+        SubscribeCommonEvent();
+        return true;
+    });
 #ifdef POWER_MANAGER_WAKEUP_ACTION
-        power->WakeupActionControllerInit();
+    graph->AddStep("WakeupActionController", {"InitState", "ProfileLoader"}, [this]() {
+        WakeupActionControllerInit();
+        return true;
+    });
 #endif
+    // external screen listener must be registered after SuspendControllerInit and WakeupControllerInit
+    graph->AddStep("ExternalAbility", {"SuspendController", "WakeupController"}, []() {
         PowerExternalAbilityInit();
-        power->KeepScreenOnInit();
+        return true;
+    });
+    // the keep on lock is created last, as it was before the steps were split
+    graph->AddStep("KeepScreenOn", {"ExternalAbility"}, [this]() {
+        KeepScreenOnInit();
+        return true;
+    });
 #ifdef POWER_MANAGER_SCREEN_SAVER
-        power->ScreenSaverInit();
+    graph->AddStep("ScreenSaver", {"InitState"}, [this]() {
+        ScreenSaverInit();
+        return true;
+    });
 #endif
-        isBootCompleted_ = true;
-    };
-    SysParam::RegisterBootCompletedCallbackForPowerSa(g_bootCompletedCallback);
+    return graph;
 }
 
 void PowerMgrService::PowerExternalAbilityInit()
@@ -293,7 +393,6 @@ void PowerMgrService::PowerExternalAbilityInit()
     power->RegisterExternalScreenListener();
     power->ExternalScreenInit();
 #endif
-    power->VibratorInit();
 #ifdef POWER_DOUBLECLICK_ENABLE
     power->RegisterSettingWakeupDoubleClickObservers();
 #endif
@@ -357,7 +456,8 @@ void PowerMgrService::DuringCallSettingUpdateFunc(const std::string &key)
 
 bool PowerMgrService::IsDeveloperMode()
 {
-    return OHOS::system::GetBoolParameter("const.security.developermode.state", true);
+    static BoolSysParam developerModeParam("const.security.developermode.state", true);
+    return developerModeParam.Get();
 }
 
 void PowerMgrService::KeepScreenOnInit()
@@ -913,6 +1013,9 @@ void PowerMgrService::OnRemoveSystemAbility(int32_t systemAbilityId, const std::
         POWER_HILOGI(COMP_SVC, "get DISPLAY_MANAGER_SERVICE_SA_ID crash in PowerService.");
         displayManagerServiceCrash_ = true;
     }
+    if (systemAbilityId == APP_MGR_SERVICE_ID) {
+        PowerUtils::StopForegroundAppTracker();
+    }
 }
 
 void PowerMgrService::OnAddSystemAbility(int32_t systemAbilityId, const std::string& deviceId)
@@ -971,6 +1074,12 @@ void PowerMgrService::OnAddSystemAbilityInner(int32_t systemAbilityId, [[maybe_u
         this->GetPowerModeModule().SubscribeCommonEvent();
         return;
     }
+    if (systemAbilityId == APP_MGR_SERVICE_ID) {
+        // falls back to querying AppMgr on every call if this fails
+        bool ret = PowerUtils::StartForegroundAppTracker();
+        POWER_HILOGI(COMP_SVC, "start foreground app tracker, ret=%{public}d", ret);
+        return;
+    }
 }
 
 #ifdef MSDP_MOVEMENT_ENABLE
@@ -2112,49 +2221,13 @@ void PowerMgrService::TriggerUlsrWakeupCallbackWithResult()
         return;
     }
     powerStateMachine_->CancelDelayTimer(PowerStateMachine::CHECK_ULSR_SYNC_CALLBACK_TIMEOUT_MSG);
-    // Atomic CAS: only the first caller wins, others return early
-    bool expected = false;
-    if (!g_ulsrResultWaitTaskStart.compare_exchange_strong(expected, true)) {
-        POWER_HILOGW(FEATURE_WAKEUP, "TriggerUlsrWakeupCallbackWithResult, wait for ulsr result task already started!");
-        return;
-    }
+    std::lock_guard lock(ulsrMutex_);
     if (ulsrCallbackHolder_ == nullptr) {
         POWER_HILOGW(FEATURE_WAKEUP, "TriggerUlsrWakeupCallbackWithResult, ulsrCallbackHolder null, skip");
-        g_ulsrResultWaitTaskStart = false;
         return;
     }
-    // Anti-re-entry check: UlsrCallbackStage MUST be STAGE_ENTER when submitting the ffrt task
-    if (ulsrCallbackHolder_->GetCallbackState() != UlsrCallbackStage::STAGE_ENTER) {
-        POWER_HILOGW(FEATURE_WAKEUP, "TriggerUlsrWakeupCallbackWithResult, ulsr callback state != STAGE_ENTER, skip");
-        g_ulsrResultWaitTaskStart = false;
-        return;
-    }
-    // Wait + read + trigger run in an ffrt task to avoid blocking the caller
-    FFRTUtils::SubmitTask([this]() { WaitAndTriggerUlsrWakeup(); });
-}
-
-void PowerMgrService::WaitAndTriggerUlsrWakeup()
-{
-    g_ulsrResultWaitTaskStart = true;
-    // Wait (max 2s) for the ULSR result to be written if result is empty
-    if (OHOS::system::GetParameter(ULSR_RESULT_PARAM, "").empty()) {
-        POWER_HILOGI(FEATURE_WAKEUP, "WaitAndTriggerUlsrWakeup, ulsr result not ready, add parameter watcher");
-        std::unique_lock<std::mutex> lock(g_ulsrResultMutex);
-        g_ulsrResultReady = false;
-        int32_t ret = WatchParameter(ULSR_RESULT_PARAM.c_str(), UlsrParamChangeCallback, nullptr);
-        POWER_HILOGI(FEATURE_WAKEUP, "WaitAndTriggerUlsrWakeup, watcher add ret: %{public}d", ret);
-        if (ret == 0 || ret == ERR_PARAM_WATCHER_REPEAT_ADD) { // ERR_REPEAT_ADD is non-fatal, callback still works
-            g_ulsrResultCv.wait_for(lock, std::chrono::milliseconds(ULSR_RESULT_WAIT_TIMEOUT_MS),
-                []() { return g_ulsrResultReady; });
-            ret = RemoveParameterWatcher(ULSR_RESULT_PARAM.c_str(), UlsrParamChangeCallback, nullptr);
-            POWER_HILOGI(FEATURE_WAKEUP, "WaitAndTriggerUlsrWakeup, watcher remove ret: %{public}d", ret);
-        }
-        POWER_HILOGI(FEATURE_WAKEUP, "WaitAndTriggerUlsrWakeup, ulsr result is ready or wait timeout");
-    }
-    bool ulsrResult = IsUlsrSucceed();
-    POWER_HILOGI(FEATURE_WAKEUP, "WaitAndTriggerUlsrWakeup, ulsr result: %{public}d", ulsrResult);
-    TriggerUlsrWakeupCallback(ulsrResult);
-    g_ulsrResultWaitTaskStart = false;
+    // returns at once, the callbacks are notified from the holder's queue once the result is known
+    ulsrCallbackHolder_->WaitUlsrResult([this](bool ulsrResult) { TriggerUlsrWakeupCallback(ulsrResult); });
 }
 
 bool PowerMgrService::IsUlsrSucceed()
@@ -2437,9 +2510,7 @@ bool PowerMgrService::IsPowerConnected()
 
 void PowerMgrService::VibratorInit()
 {
-    std::shared_ptr<PowerVibrator> vibrator = PowerVibrator::GetInstance();
-    vibrator->LoadConfig(POWER_VIBRATOR_CONFIG_FILE,
-        VENDOR_POWER_VIBRATOR_CONFIG_FILE, SYSTEM_POWER_VIBRATOR_CONFIG_FILE);
+    PowerProfileLoader::LoadVibratorConfig();
 }
 
 PowerErrors PowerMgrService::IsStandby(bool& isStandby)
@@ -2532,20 +2603,20 @@ PowerErrors PowerMgrService::LockScreenAfterTimingOutWithAppid(
 PowerErrors PowerMgrService::LockScreenAfterTimingOut(
     bool enabledLockScreen, bool checkLock, bool sendScreenOffEvent, const sptr<IRemoteObject>& token, pid_t appid)
 {
-    constexpr std::bitset<MAX_PARAM_NUMBER> defaultParams = 0b101;
+    constexpr PowerVote::VoteBits defaultParams = PowerVote::ToBits(true, false, true);
     constexpr size_t paramNumber = 3;
     constexpr size_t firtParamPos = 2;   // index of enabledLockScreen
     constexpr size_t secondParamPos = 1; // index of checkLock
     constexpr size_t thirdParamPos = 0;  // index of sendScreenOffEvent
-    static sptr<MultiInvokerHelper> multiInvokerhelper = sptr<MultiInvokerHelper>::MakeSptr(
-        paramNumber, defaultParams, [this](const std::bitset<MAX_PARAM_NUMBER>& input) {
+    static sptr<PowerVote> lockScreenVote = sptr<PowerVote>::MakeSptr(
+        "LockScreenAfterTimingOut", paramNumber, defaultParams, [this](PowerVote::VoteBits input) {
             auto stateMachine = powerStateMachine_;
-            if (!powerStateMachine_) {
+            if (!stateMachine) {
                 POWER_HILOGE(COMP_SVC, "%{public}s: powerstatemachine is nullptr", __func__);
                 return;
             }
-            powerStateMachine_->LockScreenAfterTimingOut(
-                input[firtParamPos], input[secondParamPos], input[thirdParamPos]);
+            stateMachine->LockScreenAfterTimingOut(PowerVote::TestBit(input, firtParamPos),
+                PowerVote::TestBit(input, secondParamPos), PowerVote::TestBit(input, thirdParamPos));
         });
     if (!Permission::IsSystem()) {
         return PowerErrors::ERR_SYSTEM_API_DENIED;
@@ -2554,9 +2625,7 @@ PowerErrors PowerMgrService::LockScreenAfterTimingOut(
     POWER_HILOGI(COMP_SVC,
         "LockScreenAfterTimingOut called, pid: %{public}d, input parameters: %{public}d, %{public}d, %{public}d",
         callingPid, enabledLockScreen, checkLock, sendScreenOffEvent);
-    std::bitset<MAX_PARAM_NUMBER> input =
-        MultiInvokerHelper::ToBitset(enabledLockScreen, checkLock, sendScreenOffEvent);
-    multiInvokerhelper->Set(token, callingPid, appid, input);
+    lockScreenVote->Set(token, callingPid, appid, PowerVote::ToBits(enabledLockScreen, checkLock, sendScreenOffEvent));
     return PowerErrors::ERR_OK;
 }
 
@@ -2634,7 +2703,8 @@ void PowerMgrService::ExternalScreenInit()
         return;
     }
 
-    bool isDesktopPc = system::GetIntParameter("const.product.has_buildin_screen", 1) == 0;
+    static IntSysParam buildinScreenParam("const.product.has_buildin_screen", 1);
+    bool isDesktopPc = buildinScreenParam.Get() == 0;
     POWER_HILOGI(COMP_SVC, "Number of current physical screen is %{public}u, isDesktopPc is %{public}d",
         static_cast<uint32_t>(screenIds.size()), isDesktopPc);
     if ((!isDesktopPc && screenIds.size() <= 1) ||  // at least one main screen in laptop pc
@@ -2947,6 +3017,7 @@ void PowerCommonEventSubscriber::OnPowerConnectStatusChanged(PowerConnectStatus
         return;
     }
     suspendController->UpdateSuspendSources();
+    suspendController->UpdateSuspendPolicy();
 
     auto stateMachine = power->GetPowerStateMachine();
     if (stateMachine == nullptr) {
@@ -2976,6 +3047,9 @@ void PowerCommonEventSubscriber::OnReceiveEvent(const OHOS::EventFwk::CommonEven
     if (action == OHOS::EventFwk::CommonEventSupport::COMMON_EVENT_USER_SWITCHED) {
         pms->UnregisterAllSettingObserver();    // unregister old user observer
         SettingHelper::UpdateCurrentUserId();   // update user Id
+        // the controllers are initialized again from the snapshot, it must hold the new user's sources
+        PowerProfileLoader::GetInstance().ReloadWakeupSources();
+        PowerProfileLoader::GetInstance().ReloadSuspendSources();
         pms->RegisterAllSettingObserver();      // register new user observer
 #ifdef POWER_MANAGER_SCREEN_SAVER
     if (screenSaverController != nullptr) {
@@ -3212,5 +3286,63 @@ PowerErrors PowerMgrService::UnRegisterRunningLockChangedCallback(
 #endif
     return PowerErrors::ERR_OK;
 }
+
+bool PowerMgrService::RestoreCallback(const RestoreCallbackEntry& entry)
+{
+    const sptr<IRemoteObject>& obj = entry.callback;
+    switch (entry.type) {
+        case RestoreCallbackType::POWER_STATE:
+            return RegisterPowerStateCallback(iface_cast<IPowerStateCallback>(obj), entry.param != 0);
+        case RestoreCallbackType::SYNC_SLEEP:
+            return RegisterSyncSleepCallback(
+                iface_cast<ISyncSleepCallback>(obj), static_cast<SleepPriority>(entry.param));
+        case RestoreCallbackType::SYNC_HIBERNATE:
+            return RegisterSyncHibernateCallback(
+                iface_cast<ISyncHibernateCallback>(obj), static_cast<HibernateCallbackPriority>(entry.param));
+        case RestoreCallbackType::SUSPEND_TAKEOVER:
+            return RegisterSuspendTakeoverCallback(
+                iface_cast<ITakeOverSuspendCallback>(obj), static_cast<TakeOverSuspendPriority>(entry.param));
+        case RestoreCallbackType::POWER_MODE:
+            return RegisterPowerModeCallback(iface_cast<IPowerModeCallback>(obj));
+        case RestoreCallbackType::SCREEN_OFF_PRE:
+            return RegisterScreenStateCallback(entry.param, iface_cast<IScreenOffPreCallback>(obj));
+        case RestoreCallbackType::RUNNING_LOCK:
+            return RegisterRunningLockCallback(iface_cast<IPowerRunninglockCallback>(obj));
+        case RestoreCallbackType::ULSR:
+            return RegisterUlsrCallback(iface_cast<IUlsrCallback>(obj), static_cast<UlsrPriority>(entry.param)) ==
+                PowerErrors::ERR_OK;
+        case RestoreCallbackType::ASYNC_SHUTDOWN:
+            return RegisterAsyncShutdownCallback(iface_cast<IAsyncShutdownCallback>(obj),
+                static_cast<ShutdownPriority>(entry.param)) == PowerErrors::ERR_OK;
+        case RestoreCallbackType::RUNNING_LOCK_CHANGED:
+            return RegisterRunningLockChangedCallback(iface_cast<IRunningLockChangedCallback>(obj),
+                entry.displayId) == PowerErrors::ERR_OK;
+        default:
+            return false;
+    }
+}
+
+PowerErrors PowerMgrService::RestoreSession(const PowerRestoreSession& session)
+{
+    pid_t pid = IPCSkeleton::GetCallingPid();
+    auto uid = IPCSkeleton::GetCallingUid();
+    // every entry goes through the same checks as its own interface, a session grants nothing extra
+    uint32_t failedNum = 0;
+    for (const auto& entry : session.locks) {
+        if (CreateRunningLock(entry.token, entry.info) != PowerErrors::ERR_OK) {
+            failedNum++;
+        }
+    }
+    for (const auto& entry : session.callbacks) {
+        if (!RestoreCallback(entry)) {
+            failedNum++;
+        }
+    }
+    POWER_HILOGI(COMP_SVC, "RestoreSession pid: %{public}d, uid: %{public}d, locks: %{public}zu, "
+        "callbacks: %{public}zu, failed: %{public}u", pid, uid, session.locks.size(), session.callbacks.size(),
+        failedNum);
+    // the entries that did restore stay, the client recreates what is missing through the single interfaces
+    return failedNum == 0 ? PowerErrors::ERR_OK : PowerErrors::ERR_FAILURE;
+}
 } // namespace PowerMgr
 } // namespace OHOS
\ No newline at end of file
@@ -303,7 +303,10 @@ int32_t PowerMgrServiceAdapter::ResetRunningLocksIpc()
 int32_t PowerMgrServiceAdapter::RegisterPowerStateCallbackIpc(const sptr<IPowerStateCallback>& callback, bool isSync)
 {
     PowerXCollie powerXCollie("PowerMgrServiceAdapter::RegisterPowerStateCallback", false);
-    RegisterPowerStateCallback(callback, isSync);
+    // a refused registration is reported, the client must not wait for changes that never come
+    if (!RegisterPowerStateCallback(callback, isSync)) {
+        return INIT_VALUE;
+    }
     return ERR_OK;
 }
 
@@ -349,7 +352,9 @@ int32_t PowerMgrServiceAdapter::UnRegisterSyncHibernateCallbackIpc(const sptr<IS
 int32_t PowerMgrServiceAdapter::RegisterPowerModeCallbackIpc(const sptr<IPowerModeCallback>& callback)
 {
     PowerXCollie powerXCollie("PowerMgrServiceAdapter::RegisterPowerModeCallback", false);
-    RegisterPowerModeCallback(callback);
+    if (!RegisterPowerModeCallback(callback)) {
+        return INIT_VALUE;
+    }
     return ERR_OK;
 }
 
@@ -622,5 +627,12 @@ int32_t PowerMgrServiceAdapter::SetPowerConfigIpc(
     powerError = static_cast<int32_t>(SetPowerConfig(sceneName, configVal));
     return ERR_OK;
 }
+
+int32_t PowerMgrServiceAdapter::RestoreSessionIpc(const PowerRestoreSession& session, int32_t& powerError)
+{
+    PowerXCollie powerXCollie("PowerMgrServiceAdapter::RestoreSession", false);
+    powerError = static_cast<int32_t>(RestoreSession(session));
+    return ERR_OK;
+}
 } // namespace PowerMgr
 } // namespace OHOS
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "power_profile_loader.h"
+
+#include <cinttypes>
+
+#include "ffrt_utils.h"
+#include "power_log.h"
+#include "power_mgr_service.h"
+#include "power_save_mode.h"
+#include "power_vibrator.h"
+#include "setting_helper.h"
+#include "suspend_source_parser.h"
+#include "wakeup_source_parser.h"
+#ifdef POWER_MANAGER_WAKEUP_ACTION
+#include "wakeup_action_source_parser.h"
+#endif
+
+namespace OHOS {
+namespace PowerMgr {
+namespace {
+const std::string POWER_VIBRATOR_CONFIG_FILE = "etc/power_config/power_vibrator.json";
+const std::string VENDOR_POWER_VIBRATOR_CONFIG_FILE = "/vendor/etc/power_config/power_vibrator.json";
+const std::string SYSTEM_POWER_VIBRATOR_CONFIG_FILE = "/system/etc/power_config/power_vibrator.json";
+} // namespace
+
+PowerProfileLoader& PowerProfileLoader::GetInstance()
+{
+    static PowerProfileLoader instance;
+    return instance;
+}
+
+void PowerProfileLoader::LoadVibratorConfig()
+{
+    std::shared_ptr<PowerVibrator> vibrator = PowerVibrator::GetInstance();
+    vibrator->LoadConfig(POWER_VIBRATOR_CONFIG_FILE, VENDOR_POWER_VIBRATOR_CONFIG_FILE,
+        SYSTEM_POWER_VIBRATOR_CONFIG_FILE);
+}
+
+void PowerProfileLoader::Load()
+{
+    SettingHelper::ProfileSettings settings;
+    SettingHelper::GetProfileSettings(settings);
+    std::shared_ptr<WakeupSources> wakeupSources;
+    std::shared_ptr<SuspendSources> suspendSources;
+    ffrt::submit([&settings, &wakeupSources]() {
+        wakeupSources = WakeupSourceParser::ParseSourcesBySetting(settings.wakeupSources);
+    }, {}, {}, ffrt::task_attr().name("ProfileWakeup"));
+    ffrt::submit([&settings, &suspendSources]() {
+#ifdef POWER_MANAGER_ENABLE_CHARGING_TYPE_SETTING
+        suspendSources = SuspendSourceParser::ParseSourcesBySetting(
+            settings.acSuspendSources, settings.dcSuspendSources);
+#else
+        suspendSources = SuspendSourceParser::ParseSourcesBySetting(settings.suspendSources);
+#endif
+    }, {}, {}, ffrt::task_attr().name("ProfileSuspend"));
+#ifdef POWER_MANAGER_WAKEUP_ACTION
+    std::shared_ptr<WakeupActionSources> wakeupActionSources;
+    ffrt::submit([&wakeupActionSources]() {
+        wakeupActionSources = WakeupActionSourceParser::ParseSources();
+    }, {}, {}, ffrt::task_attr().name("ProfileWakeupAction"));
+#endif
+    // power_mode_config.xml is parsed when PowerSaveMode is created
+    ffrt::submit([]() { DelayedSpSingleton<PowerSaveMode>::GetInstance(); }, {}, {},
+        ffrt::task_attr().name("ProfilePowerMode"));
+    ffrt::submit([]() { LoadVibratorConfig(); }, {}, {}, ffrt::task_attr().name("ProfileVibrator"));
+    ffrt::wait();
+
+    Publish([&](PowerProfileSnapshot& snapshot) {
+        snapshot.wakeupSources = wakeupSources;
+        snapshot.suspendSources = suspendSources;
+#ifdef POWER_MANAGER_WAKEUP_ACTION
+        snapshot.wakeupActionSources = wakeupActionSources;
+#endif
+    });
+}
+
+std::shared_ptr<const PowerProfileSnapshot> PowerProfileLoader::GetSnapshot() const
+{
+    return std::atomic_load(&snapshot_);
+}
+
+void PowerProfileLoader::Publish(const std::function<void(PowerProfileSnapshot&)>& update)
+{
+    std::lock_guard lock(publishMutex_);
+    auto current = std::atomic_load(&snapshot_);
+    auto next = current != nullptr ? std::make_shared<PowerProfileSnapshot>(*current) :
+        std::make_shared<PowerProfileSnapshot>();
+    update(*next);
+    next->version++;
+    std::atomic_store(&snapshot_, std::shared_ptr<const PowerProfileSnapshot>(next));
+    POWER_HILOGI(COMP_SVC, "power profile snapshot published, version=%{public}" PRIu64, next->version);
+}
+
+std::shared_ptr<WakeupSources> PowerProfileLoader::GetWakeupSources()
+{
+    auto snapshot = GetSnapshot();
+    if (snapshot != nullptr && snapshot->wakeupSources != nullptr) {
+        return snapshot->wakeupSources;
+    }
+    std::shared_ptr<WakeupSources> sources = WakeupSourceParser::ParseSources();
+    Publish([&sources](PowerProfileSnapshot& next) { next.wakeupSources = sources; });
+    return sources;
+}
+
+std::shared_ptr<SuspendSources> PowerProfileLoader::GetSuspendSources()
+{
+    auto snapshot = GetSnapshot();
+    if (snapshot != nullptr && snapshot->suspendSources != nullptr) {
+        return snapshot->suspendSources;
+    }
+    std::shared_ptr<SuspendSources> sources = SuspendSourceParser::ParseSources();
+    Publish([&sources](PowerProfileSnapshot& next) { next.suspendSources = sources; });
+    return sources;
+}
+
+#ifdef POWER_MANAGER_WAKEUP_ACTION
+std::shared_ptr<WakeupActionSources> PowerProfileLoader::GetWakeupActionSources()
+{
+    auto snapshot = GetSnapshot();
+    if (snapshot != nullptr && snapshot->wakeupActionSources != nullptr) {
+        return snapshot->wakeupActionSources;
+    }
+    std::shared_ptr<WakeupActionSources> sources = WakeupActionSourceParser::ParseSources();
+    Publish([&sources](PowerProfileSnapshot& next) { next.wakeupActionSources = sources; });
+    return sources;
+}
+#endif
+
+std::shared_ptr<WakeupSources> PowerProfileLoader::ReloadWakeupSources()
+{
+    std::string jsonStr = SettingHelper::GetSettingWakeupSources();
+    std::shared_ptr<WakeupSources> sources = WakeupSourceParser::ParseSources(jsonStr);
+    if (sources->GetParseErrorFlag()) {
+        POWER_HILOGI(FEATURE_WAKEUP, "Parse failed, call GetWakeupSourcesByConfig again");
+        sources = WakeupSourceParser::ParseSources(WakeupSourceParser::GetWakeupSourcesByConfig());
+    }
+    Publish([&sources](PowerProfileSnapshot& next) { next.wakeupSources = sources; });
+    return sources;
+}
+
+std::shared_ptr<SuspendSources> PowerProfileLoader::ReloadSuspendSources()
+{
+    std::string jsonStr;
+#ifdef POWER_MANAGER_ENABLE_CHARGING_TYPE_SETTING
+    auto pms = DelayedSpSingleton<PowerMgrService>::GetInstance();
+    if (pms == nullptr) {
+        POWER_HILOGE(COMP_SVC, "get PowerMgrService fail");
+        return nullptr;
+    }
+    if (pms->IsPowerConnected()) {
+        jsonStr = SettingHelper::GetSettingAcSuspendSources();
+    } else {
+        jsonStr = SettingHelper::GetSettingDcSuspendSources();
+    }
+#else
+    jsonStr = SettingHelper::GetSettingSuspendSources();
+#endif
+    std::shared_ptr<SuspendSources> sources = SuspendSourceParser::ParseSources(jsonStr);
+    if (sources->GetParseErrorFlag()) {
+        POWER_HILOGI(FEATURE_SUSPEND, "Parse failed, call GetSuspendSourcesByConfig again");
+        jsonStr = SuspendSourceParser::GetSuspendSourcesByConfig();
+        sources = SuspendSourceParser::ParseSources(jsonStr);
+    }
+    if (sources == nullptr) {
+        POWER_HILOGE(COMP_SVC, "get SuspendSources fail");
+        return nullptr;
+    }
+    Publish([&sources](PowerProfileSnapshot& next) { next.suspendSources = sources; });
+    return sources;
+}
+} // namespace PowerMgr
+} // namespace OHOS
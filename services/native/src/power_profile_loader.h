@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_POWER_PROFILE_LOADER_H
+#define POWERMGR_POWER_PROFILE_LOADER_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "suspend_sources.h"
+#include "wakeup_sources.h"
+#ifdef POWER_MANAGER_WAKEUP_ACTION
+#include "wakeup_action_sources.h"
+#endif
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Parsed profiles handed to the controllers. A snapshot is never modified
+ * after it is published, a reload publishes a new one.
+ */
+struct PowerProfileSnapshot {
+    uint64_t version {0};
+    std::shared_ptr<WakeupSources> wakeupSources;
+    std::shared_ptr<SuspendSources> suspendSources;
+#ifdef POWER_MANAGER_WAKEUP_ACTION
+    std::shared_ptr<WakeupActionSources> wakeupActionSources;
+#endif
+};
+
+/**
+ * Loads the json and xml profiles of the power service.
+ * The setting overrides are fetched with a single batched query and the
+ * profile files are parsed concurrently on FFRT.
+ */
+class PowerProfileLoader {
+public:
+    static PowerProfileLoader& GetInstance();
+    /**
+     * Parse all profiles and publish the snapshot, blocking until done.
+     */
+    void Load();
+    std::shared_ptr<const PowerProfileSnapshot> GetSnapshot() const;
+    /**
+     * Sources of the published snapshot, parsed on demand if Load has not run.
+     */
+    std::shared_ptr<WakeupSources> GetWakeupSources();
+    std::shared_ptr<SuspendSources> GetSuspendSources();
+#ifdef POWER_MANAGER_WAKEUP_ACTION
+    std::shared_ptr<WakeupActionSources> GetWakeupActionSources();
+#endif
+    /**
+     * Re-read the setting override after it changed and publish a new snapshot.
+     */
+    std::shared_ptr<WakeupSources> ReloadWakeupSources();
+    std::shared_ptr<SuspendSources> ReloadSuspendSources();
+    static void LoadVibratorConfig();
+
+private:
+    PowerProfileLoader() = default;
+    ~PowerProfileLoader() = default;
+    void Publish(const std::function<void(PowerProfileSnapshot&)>& update);
+
+    // serializes writers, readers only load the snapshot pointer
+    std::mutex publishMutex_;
+    std::shared_ptr<const PowerProfileSnapshot> snapshot_ {nullptr};
+};
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWERMGR_POWER_PROFILE_LOADER_H
@@ -29,12 +29,15 @@
 #ifdef HAS_HIVIEWDFX_HITRACE_PART
 #include "hitrace_meter.h"
 #endif
+#include "power_clock.h"
+#include "power_event_recorder.h"
 #include "power_mode_policy.h"
 #include "power_mgr_factory.h"
 #include "power_mgr_service.h"
 #include "power_utils.h"
 #include "setting_helper.h"
 #include "system_suspend_controller.h"
+#include "sysparam_cache.h"
 #ifdef POWER_MANAGER_POWER_ENABLE_S4
 #include "os_account_manager.h"
 #include "parameters.h"
@@ -64,7 +67,6 @@ const std::string POWERMGR_STOPSERVICE = "persist.powermgr.stopservice";
 constexpr uint32_t PRE_BRIGHT_AUTH_TIMER_DELAY_MS = 3000;
 #ifdef POWER_MANAGER_POWER_ENABLE_S4
 constexpr uint32_t PREPARE_HIBERNATE_INACTIVE_DELAY_US = 1500000;
-constexpr uint32_t POST_HIBERNATE_CLEARMEM_DELAY_US = 2000000;
 constexpr uint32_t HIBERNATE_DELAY_MS = 3500;
 constexpr int32_t PREPARE_HIBERNATE_TIMEOUT_MS = 30000;
 static int64_t g_preHibernateStart = 0;
@@ -84,7 +86,7 @@ PowerStateMachine::PowerStateMachine(const wptr<PowerMgrService>& pms, const std
     POWER_HILOGD(FEATURE_POWER_STATE, "Instance start");
     // NOTICE Need get screen state when device startup,
     // rightnow we set screen is on as default
-    mDeviceState_.screenState.lastOnTime = GetTickCount();
+    mDeviceState_.screenState.lastOnTime = PowerClock::GetTickCount();
     mDeviceState_.screenState.lastOffTime = 0;
     mDeviceState_.lastWakeupEventTime = 0;
     mDeviceState_.lastRefreshActivityTime = 0;
@@ -133,6 +135,8 @@ bool PowerStateMachine::Init()
     }
     activeTimeBeforeLongTimeDim_ =
         static_cast<int64_t>(system::GetIntParameter("const.power.active_time_before_long_time_dim", -1));
+    // the clients coalesce RefreshActivity with the interval the service throttles it with
+    system::SetParameter(REFRESH_ACTIVITY_INTERVAL_PARAM, std::to_string(MIN_TIME_MS_BETWEEN_USERACTIVITIES));
     POWER_HILOGD(FEATURE_POWER_STATE, "Init success");
     return true;
 }
@@ -353,7 +357,7 @@ void PowerStateMachine::EmplaceAwake()
             HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "SCREEN_ON",
                 HiviewDFX::HiSysEvent::EventType::BEHAVIOR, "REASON", PowerUtils::GetReasonTypeString(reason).c_str());
 #endif
-            mDeviceState_.screenState.lastOnTime = GetTickCount();
+            mDeviceState_.screenState.lastOnTime = PowerClock::GetTickCount();
             auto targetState = DisplayState::DISPLAY_ON;
             if (reason == StateChangeReason::STATE_CHANGE_REASON_PRE_BRIGHT_AUTH_FAIL_SCREEN_OFF) {
                 if (isDozeEnabled_) {
@@ -405,7 +409,7 @@ void PowerStateMachine::EmplaceInactive()
                 HiviewDFX::HiSysEvent::EventType::BEHAVIOR, "PNAMEID", "PowerManager", "PVERSIONID", "1.0",
                 "REASON", PowerUtils::GetReasonTypeString(reason).c_str());
 #endif
-            mDeviceState_.screenState.lastOffTime = GetTickCount();
+            mDeviceState_.screenState.lastOffTime = PowerClock::GetTickCount();
             DisplayState state = DisplayState::DISPLAY_OFF;
             if (reason != StateChangeReason::STATE_CHANGE_REASON_SWITCH_SENSORHUB
                 && isDozeEnabled_.load(std::memory_order_relaxed)) {
@@ -430,7 +434,7 @@ void PowerStateMachine::EmplaceStandBy()
     controllerMap_.emplace(PowerState::STAND_BY,
         std::make_shared<StateController>(PowerState::STAND_BY, shared_from_this(), [this](StateChangeReason reason) {
             POWER_HILOGI(FEATURE_POWER_STATE, "StateController_STAND_BY lambda start");
-            mDeviceState_.screenState.lastOffTime = GetTickCount();
+            mDeviceState_.screenState.lastOffTime = PowerClock::GetTickCount();
             // Subsequent added functions
             return TransitResult::SUCCESS;
         }));
@@ -441,7 +445,7 @@ void PowerStateMachine::EmplaceDoze()
     controllerMap_.emplace(PowerState::DOZE,
         std::make_shared<StateController>(PowerState::DOZE, shared_from_this(), [this](StateChangeReason reason) {
             POWER_HILOGI(FEATURE_POWER_STATE, "StateController_DOZE lambda start");
-            mDeviceState_.screenState.lastOffTime = GetTickCount();
+            mDeviceState_.screenState.lastOffTime = PowerClock::GetTickCount();
             // Subsequent added functions
             return TransitResult::SUCCESS;
         }));
@@ -783,7 +787,7 @@ void PowerStateMachine::RefreshActivityInner(
 #ifndef POWER_MANAGER_ENABLE_SCREEN_DECOUPLING
             stateAction_->RefreshActivity(callTimeMs, type,
                 needChangeBacklight ? REFRESH_ACTIVITY_NEED_CHANGE_LIGHTS : REFRESH_ACTIVITY_NO_CHANGE_LIGHTS);
-            mDeviceState_.screenState.lastOnTime = GetTickCount();
+            mDeviceState_.screenState.lastOnTime = PowerClock::GetTickCount();
 #endif
         }
         if (GetState() == PowerState::DIM || IsSettingState(PowerState::DIM)) {
@@ -803,7 +807,12 @@ void PowerStateMachine::RefreshActivityInner(
 bool PowerStateMachine::CheckRefreshTime()
 {
     // The minimum refreshactivity interval is 100ms!!
-    int64_t now = GetTickCount();
+    int64_t now = PowerClock::GetTickCount();
+    // the first refresh after a state change is never throttled, the clients forward it as well
+    if (refreshThrottleReset_.exchange(false)) {
+        mDeviceState_.lastRefreshActivityTime = now;
+        return false;
+    }
     if ((mDeviceState_.lastRefreshActivityTime + MIN_TIME_MS_BETWEEN_USERACTIVITIES) > now) {
         return true;
     }
@@ -910,7 +919,7 @@ bool PowerStateMachine::PrepareHibernate(bool clearMemory)
         POWER_HILOGE(FEATURE_POWER_STATE, "failed to set state to inactive.");
     }
 
-    g_preHibernateStart = GetTickCount();
+    g_preHibernateStart = PowerClock::GetTickCount();
     if (clearMemory) {
         auto hookMgr = GetPowerHookMgr();
         HookMgrExecute(hookMgr, static_cast<int32_t>(PowerHookStage::POWER_PRE_SWITCH_ACCOUNT), nullptr, nullptr);
@@ -928,7 +937,11 @@ bool PowerStateMachine::PrepareHibernate(bool clearMemory)
             return false;
         }
         HookMgrExecute(hookMgr, static_cast<int32_t>(PowerHookStage::POWER_POST_SWITCH_ACCOUNT), nullptr, nullptr);
+        // overlaps with the sync callbacks, finished by HibernateController::Hibernate once it met its target
+        hibernateController->StartMemoryReclaim();
     }
+    // written while the hibernate callbacks run, the hibernate call does not wait for it
+    PowerEventRecorder::GetInstance().Flush();
     hibernateController->PreHibernate();
     POWER_HILOGI(FEATURE_SUSPEND, "Hibernate sync callback end.");
 
@@ -940,9 +953,6 @@ bool PowerStateMachine::PrepareHibernate(bool clearMemory)
 #endif
         ret = false;
     }
-    if (ret && clearMemory) {
-        usleep(POST_HIBERNATE_CLEARMEM_DELAY_US);
-    }
     return ret;
 }
 
@@ -973,7 +983,7 @@ bool PowerStateMachine::PrepareHibernateWithTimeout(bool clearMemory)
 
 uint32_t PowerStateMachine::GetPreHibernateDelay()
 {
-    int64_t preHibernateEnd = GetTickCount();
+    int64_t preHibernateEnd = PowerClock::GetTickCount();
     uint32_t preHibernateDelay = static_cast<uint32_t>(preHibernateEnd - g_preHibernateStart);
     preHibernateDelay = preHibernateDelay > HIBERNATE_DELAY_MS ? 0 : HIBERNATE_DELAY_MS - preHibernateDelay;
     POWER_HILOGI(FEATURE_SUSPEND, "preHibernateDelay = %{public}u", preHibernateDelay);
@@ -988,7 +998,7 @@ void PowerStateMachine::RestoreHibernate(bool clearMemory, HibernateStatus statu
     hibernating_ = false;
 
     if (notify) {
-        notify->PublishExitHibernateEvent(GetTickCount(), clearMemory);
+        notify->PublishExitHibernateEvent(PowerClock::GetTickCount(), clearMemory);
     }
 
     if (!SetState(PowerState::AWAKE, StateChangeReason::STATE_CHANGE_REASON_SYSTEM, true)) {
@@ -1014,11 +1024,14 @@ void PowerStateMachine::RollbackHibernate(
     hibernating_ = false;
     if (needShutdown) {
         // Ready to shutdown, so no need to publish common event and run PostHibernate
+        if (pms->GetHibernateController() != nullptr) {
+            pms->GetHibernateController()->StopMemoryReclaim();
+        }
         pms->ShutDownDevice("HibernateFail");
         return;
     }
     if (pms->GetPowerMgrNotify() != nullptr) {
-        pms->GetPowerMgrNotify()->PublishExitHibernateEvent(GetTickCount(), clearMemory);
+        pms->GetPowerMgrNotify()->PublishExitHibernateEvent(PowerClock::GetTickCount(), clearMemory);
     }
     if (pms->GetHibernateController() != nullptr) {
         pms->GetHibernateController()->PostHibernate(false);
@@ -1068,7 +1081,7 @@ bool PowerStateMachine::HibernateInner(bool clearMemory, const std::string& reas
     hibernating_ = true;
     PowerState originalState = GetState();
     bool needShutdown = clearMemory || reason == "LowCapacity";
-    notify->PublishEnterHibernateEvent(GetTickCount(), clearMemory);
+    notify->PublishEnterHibernateEvent(PowerClock::GetTickCount(), clearMemory);
 
     bool ret = PrepareHibernateWithTimeout(clearMemory);
     if (!ret) {
@@ -1163,9 +1176,9 @@ void PowerStateMachine::ReceiveScreenEvent(bool isScreenOn)
     std::lock_guard lock(mutex_);
     auto prestate = mDeviceState_.screenState.state;
     if (isScreenOn) {
-        mDeviceState_.screenState.lastOnTime = GetTickCount();
+        mDeviceState_.screenState.lastOnTime = PowerClock::GetTickCount();
     } else {
-        mDeviceState_.screenState.lastOffTime = GetTickCount();
+        mDeviceState_.screenState.lastOffTime = PowerClock::GetTickCount();
     }
     if (prestate != mDeviceState_.screenState.state) {
         NotifyPowerStateChanged(isScreenOn ? PowerState::AWAKE : PowerState::INACTIVE);
@@ -1240,8 +1253,23 @@ void PowerStateMachine::EnableMock(IDeviceStateAction* mockAction)
     stateAction_ = std::move(mock);
 }
 
+void PowerStateMachine::PublishStateSerial()
+{
+    ++stateSerial_;
+    // a task that has not run yet publishes the latest serial, paramservice is not called on the transition
+    if (serialPublishPending_.exchange(true)) {
+        return;
+    }
+    FFRTUtils::SubmitQueueTasks({[this]() {
+        serialPublishPending_.store(false);
+        system::SetParameter(POWER_STATE_SERIAL_PARAM, std::to_string(stateSerial_.load()));
+    }}, serialQueue_);
+}
+
 void PowerStateMachine::NotifyPowerStateChanged(PowerState state, StateChangeReason reason)
 {
+    refreshThrottleReset_.store(true);
+    PublishStateSerial();
     if (GetState() == PowerState::INACTIVE &&
         !enabledScreenOffEvent_.load(std::memory_order_relaxed) &&
         reason == StateChangeReason::STATE_CHANGE_REASON_TIMEOUT_NO_SCREEN_LOCK) {
@@ -1251,11 +1279,13 @@ void PowerStateMachine::NotifyPowerStateChanged(PowerState state, StateChangeRea
     POWER_HILOGD(
         FEATURE_POWER_STATE, "state=%{public}u, listeners.size=%{public}zu", state, syncPowerStateListeners_.size());
 #ifdef HAS_HIVIEWDFX_HISYSEVENT_PART
-    HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "STATE", HiviewDFX::HiSysEvent::EventType::STATISTIC, "STATE",
-        static_cast<uint32_t>(state));
+    PowerEventRecorder::GetInstance().Record([state]() {
+        HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "STATE", HiviewDFX::HiSysEvent::EventType::STATISTIC,
+            "STATE", static_cast<uint32_t>(state));
+    });
 #endif
     std::lock_guard lock(mutex_);
-    int64_t now = GetTickCount();
+    int64_t now = PowerClock::GetTickCount();
     // Send Notification event
     SendEventToPowerMgrNotify(state, now, PowerUtils::GetReasonTypeString(reason));
     uint32_t ffrtId = ffrt::this_task::get_id();
@@ -1388,6 +1418,12 @@ void PowerStateMachine::HandleProximityClose()
     }
     bool ret = SetState(PowerState::INACTIVE, StateChangeReason::STATE_CHANGE_REASON_PROXIMITY, true);
     if (ret) {
+#ifdef HAS_SENSORS_SENSOR_PART
+        auto runningLockMgr = pms->GetRunningLockMgr();
+        if (runningLockMgr != nullptr) {
+            runningLockMgr->OnProximityScreenOff();
+        }
+#endif
         suspendController->StartSleepTimer(SuspendDeviceType::SUSPEND_DEVICE_REASON_APPLICATION,
             static_cast<uint32_t>(SuspendAction::ACTION_AUTO_SUSPEND), 0);
     }
@@ -1550,7 +1586,7 @@ void PowerStateMachine::PublishRefreshEvent()
 
 void PowerStateMachine::ResetScreenOffPreTimeForSwing(int64_t displayOffTime)
 {
-    int64_t now = GetTickCount();
+    int64_t now = PowerClock::GetTickCount();
     int64_t nextTimeOut = now + displayOffTime - this->GetDimTime(displayOffTime);
     POWER_HILOGD(FEATURE_SCREEN_OFF_PRE,
         "now=%{public}lld,displayOffTime=%{public}lld,nextTimeOut=%{public}lld",
@@ -1736,6 +1772,26 @@ bool PowerStateMachine::SetDozeMode(DisplayState state)
 }
 
 #ifdef POWER_MANAGER_ENABLE_EXTERNAL_SCREEN_MANAGEMENT
+// asked on every screen and lid transition, the parameters are cached instead of looked up each time
+bool PowerStateMachine::IsOnlySecondDisplayModeSupported() const
+{
+    static IntSysParam displayModeParam("const.product.support_display_mode", 0);
+    return (displayModeParam.Get() & DISPLAY_MODE_ONLY_SECOND_SCREEN) > 0;
+}
+
+bool PowerStateMachine::IsLidEventUsed()
+{
+    static IntSysParam lidTypeParam("const.power.lid_type_for_only_external_screen", 0);
+    return lidTypeParam.Get() == 1;
+}
+
+bool PowerStateMachine::Is2In1PadMode()
+{
+    static BoolSysParam pcModeSwitchParam("const.window.support_window_pcmode_switch", false);
+    static BoolSysParam pcModeParam("persist.sceneboard.ispcmode", false);
+    return pcModeSwitchParam.Get() && !pcModeParam.Get();
+}
+
 bool PowerStateMachine::IsLidOrSwitchOpen()
 {
     if (IsLidEventUsed()) {
@@ -1990,7 +2046,7 @@ PowerStateMachine::ScreenChangeCheck::ScreenChangeCheck(PowerState state, StateC
 
     pid_ = getpid();
     uid_ = static_cast<pid_t>(getuid());
-    int64_t submitTime = GetTickCount();
+    int64_t submitTime = PowerClock::GetTickCount();
 
     FFRTTask task = [checker = (*this), submitTime]() {
         checker.ReportSysEvent("TIMEOUT: timer started at " + std::to_string(submitTime));
@@ -2024,7 +2080,7 @@ void PowerStateMachine::ScreenChangeCheck::ReportSysEvent(const std::string& msg
         eventName, PowerUtils::GetReasonTypeString(reason_).c_str(), msg.c_str(), pid_, uid_);
 
     static int64_t lastReportTime = -1;
-    int64_t now = GetTickCount();
+    int64_t now = PowerClock::GetTickCount();
     int64_t nextReportTime = lastReportTime + SCREEN_CHANGE_REPORT_INTERVAL_MS;
     if (nextReportTime > SCREEN_CHANGE_REPORT_INTERVAL_MS && now < nextReportTime) {
         POWER_HILOGD(FEATURE_POWER_STATE, "Will skip report for another %{public}s ms",
@@ -2112,8 +2168,8 @@ bool PowerStateMachine::HandlePreBrightState(PowerState targetState, StateChange
                     PRE_BRIGHT_AUTH_TIMER_DELAY_MS);
                 const std::string detail = "pre_bright_auth_fail_screen_off";
                 const std::string pkgName = "pre_bright_auth_time";
-                HandlePreBrightWakeUp(GetTickCount(), WakeupDeviceType::WAKEUP_DEVICE_PRE_BRIGHT_AUTH_FAIL_SCREEN_OFF,
-                    detail, pkgName, true);
+                HandlePreBrightWakeUp(PowerClock::GetTickCount(),
+                    WakeupDeviceType::WAKEUP_DEVICE_PRE_BRIGHT_AUTH_FAIL_SCREEN_OFF, detail, pkgName, true);
             };
             if (curState == PowerStateMachine::PRE_BRIGHT_STARTED) {
                 POWER_HILOGI(FEATURE_WAKEUP, "Cancel pre-bright-auth timer, rason=%{public}s",
@@ -2192,7 +2248,7 @@ bool PowerStateMachine::IsTimeoutReason(StateChangeReason reason) const
 bool PowerStateMachine::SetState(PowerState state, StateChangeReason reason, bool force)
 {
 #ifdef HAS_HIVIEWDFX_HISYSEVENT_PART
-    int32_t beginTimeMs = GetTickCount();
+    int32_t beginTimeMs = PowerClock::GetTickCount();
 #endif
     uint32_t ffrtId = ffrt::this_task::get_id();
     POWER_HILOGD(FEATURE_POWER_STATE, "state=%{public}s, reason=%{public}s, force=%{public}d, ffrtId=%{public}u",
@@ -2238,9 +2294,10 @@ bool PowerStateMachine::SetState(PowerState state, StateChangeReason reason, boo
         wakeupController->RegisterMonitor(GetState());
     }
     const auto& [powerkeyPressCacheId, powerkeyReleaseCacheId] = GetPowerKeySubscriberCacheIds();
-    POWER_HILOGW(FEATURE_POWER_STATE,"[UL_POWER] StateController::TransitTo %{public}s ret: %{public}d, ffrtId="
-        "%{public}u, reason=%{public}s, kp=%{public}d, kr=%{public}d", PowerUtils::GetPowerStateString(state).c_str(),
-        ret, ffrtId, PowerUtils::GetReasonTypeString(reason).c_str(), powerkeyPressCacheId, powerkeyReleaseCacheId);
+    POWER_HILOGW_LIMITED(FEATURE_POWER_STATE, "[UL_POWER] StateController::TransitTo %{public}s ret: %{public}d, "
+        "ffrtId=%{public}u, reason=%{public}s, kp=%{public}d, kr=%{public}d",
+        PowerUtils::GetPowerStateString(state).c_str(), ret, ffrtId, PowerUtils::GetReasonTypeString(reason).c_str(),
+        powerkeyPressCacheId, powerkeyReleaseCacheId);
     RestoreSettingStateFlag();
     WriteHiSysEvent(ret, reason, beginTimeMs, state);
     return (ret == TransitResult::SUCCESS || ret == TransitResult::ALREADY_IN_STATE);
@@ -2254,26 +2311,31 @@ void PowerStateMachine::WriteHiSysEvent(TransitResult ret, StateChangeReason rea
     constexpr int32_t SETSTATE_OFF_TIMEOUT_MS = 1000;
     constexpr int32_t pid = 0;
     constexpr int32_t uid = 0;
+    std::string reasonStr = PowerUtils::GetReasonTypeString(reason);
     if (IsTransitFailed(ret)) {
         POWER_HILOGI(FEATURE_POWER_STATE, "screen state transit result=%{public}d", ret);
-        HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "SCREEN_STATE_TRANSIT_FAILED",
-            HiviewDFX::HiSysEvent::EventType::FAULT, "TRANSIT_RESULT", static_cast<int32_t>(ret),
-            "REASON", PowerUtils::GetReasonTypeString(reason).c_str());
+        PowerEventRecorder::GetInstance().Record([ret, reasonStr]() {
+            HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "SCREEN_STATE_TRANSIT_FAILED",
+                HiviewDFX::HiSysEvent::EventType::FAULT, "TRANSIT_RESULT", static_cast<int32_t>(ret),
+                "REASON", reasonStr.c_str());
+        });
+    }
+    int32_t costMs = PowerClock::GetTickCount() - beginTimeMs;
+    int32_t timeoutType = -1;
+    if (costMs > SETSTATE_ON_TIMEOUT_MS && state == PowerState::AWAKE) {
+        POWER_HILOGI(FEATURE_POWER_STATE, "set state on timeout=%{public}d", costMs);
+        timeoutType = static_cast<int32_t>(InterfaceTimeoutType::INTERFACE_TIMEOUT_TYPE_SETSTATE_ON);
+    } else if ((costMs > SETSTATE_ON_TIMEOUT_MS) && (costMs < SETSTATE_OFF_TIMEOUT_MS) &&
+        (state == PowerState::INACTIVE)) {
+        POWER_HILOGI(FEATURE_POWER_STATE, "set state off timeout=%{public}d", costMs);
+        timeoutType = static_cast<int32_t>(InterfaceTimeoutType::INTERFACE_TIMEOUT_TYPE_SETSTATE_OFF);
     }
-    int32_t endTimeMs = GetTickCount();
-    if (endTimeMs - beginTimeMs > SETSTATE_ON_TIMEOUT_MS && state == PowerState::AWAKE) {
-        POWER_HILOGI(FEATURE_POWER_STATE, "set state on timeout=%{public}d", (endTimeMs - beginTimeMs));
-        HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "INTERFACE_CONSUMING_TIMEOUT",
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR, "PID", pid, "UID", uid, "TYPE",
-            static_cast<int32_t>(InterfaceTimeoutType::INTERFACE_TIMEOUT_TYPE_SETSTATE_ON),
-            "REASON", PowerUtils::GetReasonTypeString(reason).c_str(), "TIME", (endTimeMs - beginTimeMs));
-    } else if ((endTimeMs - beginTimeMs > SETSTATE_ON_TIMEOUT_MS) &&
-        (endTimeMs - beginTimeMs < SETSTATE_OFF_TIMEOUT_MS) && (state == PowerState::INACTIVE)) {
-        POWER_HILOGI(FEATURE_POWER_STATE, "set state off timeout=%{public}d", (endTimeMs - beginTimeMs));
-        HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "INTERFACE_CONSUMING_TIMEOUT",
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR, "PID", pid, "UID", uid, "TYPE",
-            static_cast<int32_t>(InterfaceTimeoutType::INTERFACE_TIMEOUT_TYPE_SETSTATE_OFF),
-            "REASON", PowerUtils::GetReasonTypeString(reason).c_str(), "TIME", (endTimeMs - beginTimeMs));
+    if (timeoutType >= 0) {
+        PowerEventRecorder::GetInstance().Record([pid = pid, uid = uid, timeoutType, reasonStr, costMs]() {
+            HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "INTERFACE_CONSUMING_TIMEOUT",
+                HiviewDFX::HiSysEvent::EventType::BEHAVIOR, "PID", pid, "UID", uid, "TYPE", timeoutType,
+                "REASON", reasonStr.c_str(), "TIME", costMs);
+        });
     }
 #endif
 }
@@ -2666,7 +2728,7 @@ TransitResult PowerStateMachine::StateController::TransitTo(StateChangeReason re
     if (ret == TransitResult::SUCCESS) {
         bool needNotify = NeedNotify(owner->currentState_);
         lastReason_ = reason;
-        lastTime_ = GetTickCount();
+        lastTime_ = PowerClock::GetTickCount();
         owner->currentState_ = GetState();
         if (needNotify) {
             owner->NotifyPowerStateChanged(owner->currentState_, reason);
@@ -2783,7 +2845,7 @@ void PowerStateMachine::StateController::RecordFailure(
 {
     failFrom_ = from;
     failTrigger_ = trigger;
-    failTime_ = GetTickCount();
+    failTime_ = PowerClock::GetTickCount();
     failReason_ = GetTransitResultString(failReason);
     std::string message = "State Transit Failed from ";
     message.append(PowerUtils::GetPowerStateString(failFrom_))
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "power_vote.h"
+
+#include <bitset>
+#include <power_log.h>
+
+namespace OHOS::PowerMgr {
+namespace {
+std::string BitsToString(PowerVote::VoteBits bits, size_t bitCount)
+{
+    std::string str = std::bitset<PowerVote::MAX_BITS>(bits).to_string();
+    return str.substr(PowerVote::MAX_BITS - bitCount);
+}
+} // namespace
+
+PowerVote::VoteBits PowerVote::Invoker::SetValue(size_t bitCount, pid_t key, VoteBits input)
+{
+    const auto iter = entries.find(key);
+    VoteBits previous = (iter == entries.end() ? 0 : iter->second);
+    VoteBits changed = previous ^ input;
+    for (size_t index = 0; index < bitCount; index++) {
+        if (!TestBit(changed, index)) {
+            continue;
+        }
+        uint32_t count = TestBit(input, index) ? ++sum[index] : --sum[index];
+        result = count != 0 ? (result | (1U << index)) : (result & ~(1U << index));
+    }
+    if (input != 0) {
+        entries[key] = input;
+    } else if (iter != entries.end()) {
+        entries.erase(iter);
+    }
+    return result;
+}
+
+PowerVote::VoteBits PowerVote::Apply(VoteBits previous, VoteBits current)
+{
+    VoteBits changed = previous ^ current;
+    VoteBits flipped = 0;
+    for (size_t index = 0; index < bitCount_; index++) {
+        if (!TestBit(changed, index)) {
+            continue;
+        }
+        // only the 0 <-> 1 transitions of a counter change the aggregate
+        if (TestBit(current, index)) {
+            if (counters_[index].fetch_add(1, std::memory_order_acq_rel) == 0) {
+                flipped |= (1U << index);
+            }
+        } else if (counters_[index].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            flipped |= (1U << index);
+        }
+    }
+    if (flipped != 0) {
+        result_.fetch_xor(flipped, std::memory_order_acq_rel);
+    }
+    return flipped;
+}
+
+void PowerVote::SetInner(
+    uint64_t invokerId, const sptr<IRemoteObject>& remoteObj, pid_t pid, pid_t key, VoteBits input)
+{
+    VoteBits deltaInput = (input ^ defaultParam_) & ((1U << bitCount_) - 1);
+    std::lock_guard lock(mutex_);
+    auto [iter, inserted] = invokers_.try_emplace(invokerId);
+    if (inserted) {
+        iter->second.remoteObj = remoteObj;
+        iter->second.pid = pid;
+    }
+    VoteBits previous = iter->second.result;
+    VoteBits result = iter->second.SetValue(bitCount_, key, deltaInput);
+    VoteBits flipped = Apply(previous, result);
+    POWER_HILOGI(FEATURE_POWER_STATE, "[%{public}s] invoker %{public}d previous: %{public}s, result: %{public}s",
+        name_.c_str(), pid, BitsToString(previous, bitCount_).c_str(), BitsToString(result, bitCount_).c_str());
+    if (remoteObj != nullptr) {
+        if (previous == 0 && result != 0) {
+            // implicitly cast this to IRemoteObject::DeathRecipient.
+            // Thus the instance should only be created by using MakeSptr.
+            remoteObj->AddDeathRecipient(this);
+        } else if (previous != 0 && result == 0) {
+            remoteObj->RemoveDeathRecipient(this);
+        }
+    }
+    if (result == 0) {
+        invokers_.erase(iter);
+    }
+    OnChange(flipped);
+}
+
+void PowerVote::Set(const sptr<IRemoteObject>& remoteObj, pid_t invokerPid, pid_t appid, VoteBits input)
+{
+    if (!remoteObj) {
+        POWER_HILOGE(FEATURE_POWER_STATE, "[%{public}s] remoteObj is nullptr", name_.c_str());
+        return;
+    }
+    pid_t key = appid != -1 ? appid : invokerPid;
+    SetInner(GetInvokerId(remoteObj), remoteObj, invokerPid, key, input);
+}
+
+void PowerVote::SetLocal(uint64_t invokerId, VoteBits input)
+{
+    if (invokerId > LOCAL_INVOKER_ID_MAX) {
+        POWER_HILOGE(FEATURE_POWER_STATE, "[%{public}s] invalid local invoker %{public}" PRIu64,
+            name_.c_str(), invokerId);
+        return;
+    }
+    SetInner(invokerId, nullptr, 0, 0, input);
+}
+
+bool PowerVote::RemoveInvoker(uint64_t invokerId)
+{
+    std::lock_guard lock(mutex_);
+    const auto iter = invokers_.find(invokerId);
+    if (iter == invokers_.cend()) {
+        return false;
+    }
+    VoteBits flipped = Apply(iter->second.result, 0);
+    invokers_.erase(iter);
+    OnChange(flipped);
+    return true;
+}
+
+void PowerVote::OnChange(VoteBits flipped)
+{
+    if (flipped == 0) {
+        POWER_HILOGD(FEATURE_POWER_STATE, "[%{public}s] result not changed", name_.c_str());
+        return;
+    }
+    std::string dumpStr = DumpInner();
+    POWER_HILOGI(FEATURE_POWER_STATE, "[%{public}s] result changed, current invokers: %{public}s",
+        name_.c_str(), dumpStr.c_str());
+    if (onChange_) {
+        onChange_(GetResult());
+    } else {
+        POWER_HILOGE(FEATURE_POWER_STATE, "callback is null, the server internal values are not updated");
+    }
+}
+
+std::string PowerVote::DumpInner() const
+{
+    std::string ret = "sums:[";
+    // print sums in reverse order to match the bits appearance
+    for (size_t index = bitCount_; index > 0; index--) {
+        ret += std::to_string(counters_[index - 1].load(std::memory_order_relaxed));
+        ret += (index > 1) ? ", " : "] ";
+    }
+    for (auto iter = invokers_.cbegin(); iter != invokers_.cend(); iter++) {
+        ret += std::to_string(iter->second.pid) + ": {";
+        for (auto entry = iter->second.entries.cbegin(); entry != iter->second.entries.cend(); entry++) {
+            ret += (entry == iter->second.entries.cbegin() ? "" : ", ") + std::to_string(entry->first) + ": " +
+                BitsToString(entry->second, bitCount_);
+        }
+        ret += std::next(iter) != invokers_.cend() ? "}, " : "}";
+    }
+    return ret;
+}
+
+std::string PowerVote::Dump()
+{
+    std::lock_guard lock(mutex_);
+    return name_ + " result:" + BitsToString(GetResult(), bitCount_) + " " + DumpInner();
+}
+
+void PowerVote::OnRemoteDied(const wptr<IRemoteObject>& object)
+{
+    auto strongRef = object.promote();
+    if (!strongRef) {
+        POWER_HILOGW(FEATURE_POWER_STATE, "remote died, but IRemoteObject invalid");
+        return;
+    }
+    if (!RemoveInvoker(GetInvokerId(strongRef))) {
+        POWER_HILOGW(FEATURE_POWER_STATE, "remote died, but the invoker to be removed does not exist");
+    }
+    strongRef->RemoveDeathRecipient(this);
+}
+} // namespace OHOS::PowerMgr
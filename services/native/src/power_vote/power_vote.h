@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_POWERMGR_POWER_VOTE_HEADER
+#define OHOS_POWERMGR_POWER_VOTE_HEADER
+
+#include <array>
+#include <atomic>
+#include <cinttypes>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+#include <iremote_object.h>
+#include <refbase.h>
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Aggregates boolean votes of many invokers. Each bit of the result is set when at least one
+ * invoker votes against its default value. Every bit keeps an atomic counter of the invokers
+ * voting for it, so a vote update costs O(bits) and reading the result never takes the lock.
+ */
+class PowerVote : public IRemoteObject::DeathRecipient {
+public:
+    using VoteBits = uint32_t;
+    using ChangeFunc = std::function<void(VoteBits result)>;
+    static constexpr size_t MAX_BITS = 8;
+    static constexpr VoteBits ALL_BITS = (1U << MAX_BITS) - 1;
+
+    // pack booleans into bits, the first argument becomes the most significant bit
+    template <class... Args> static constexpr VoteBits ToBits(Args... args)
+    {
+        static_assert(sizeof...(Args) <= MAX_BITS, "too many parameters");
+        static_assert((... && std::is_same_v<std::remove_cv_t<std::remove_reference_t<Args>>, bool>),
+            "each of the parameters needs to be boolean");
+        VoteBits bits = 0;
+        ((bits = (bits << 1) | static_cast<VoteBits>(args)), ...);
+        return bits;
+    }
+
+    static constexpr bool TestBit(VoteBits bits, size_t pos)
+    {
+        return ((bits >> pos) & 1U) != 0;
+    }
+
+    // invokers without a remote object (settings, dumper...) pick a fixed id from this range
+    static constexpr uint64_t LOCAL_INVOKER_ID_MAX = 0xFF;
+    static uint64_t GetInvokerId(const sptr<IRemoteObject>& remoteObj)
+    {
+        return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(remoteObj.GetRefPtr()));
+    }
+
+    /**
+     * Set the vote of key (appid or pid) on behalf of the invoker. Bits equal to the defaults withdraw the vote.
+     * The death recipient is added while the invoker holds any vote.
+     */
+    void Set(const sptr<IRemoteObject>& remoteObj, pid_t invokerPid, pid_t appid, VoteBits input);
+    // vote of a local invoker, which is never removed by remote death
+    void SetLocal(uint64_t invokerId, VoteBits input);
+    bool RemoveInvoker(uint64_t invokerId);
+    VoteBits GetResult() const
+    {
+        return result_.load(std::memory_order_acquire) ^ defaultParam_;
+    }
+    std::string Dump();
+    void OnRemoteDied(const wptr<IRemoteObject>& object) override;
+
+private:
+    // only allow construction from sptr. Since the this-pointer needs to be passed to function
+    // accepting sptr, stack object going out of scope would make that sptr invalid.
+    friend sptr<PowerVote>;
+    PowerVote(const std::string& name, size_t bitCount, VoteBits defaults, const ChangeFunc& onChange)
+        : name_(name),
+          bitCount_(bitCount > MAX_BITS ? MAX_BITS : bitCount),
+          defaultParam_(defaults & ((1U << bitCount_) - 1)),
+          onChange_(onChange)
+    {
+    }
+
+    struct Invoker {
+        wptr<IRemoteObject> remoteObj;
+        pid_t pid {0};
+        std::array<uint32_t, MAX_BITS> sum {};
+        std::unordered_map<pid_t, VoteBits> entries;
+        VoteBits result {0};
+        // returns the invoker level result after updating the entry of key
+        VoteBits SetValue(size_t bitCount, pid_t key, VoteBits input);
+    };
+
+    void SetInner(uint64_t invokerId, const sptr<IRemoteObject>& remoteObj, pid_t pid, pid_t key, VoteBits input);
+    // apply the change of one invoker to the counters, returns the bits of the aggregate that flipped
+    VoteBits Apply(VoteBits previous, VoteBits current);
+    void OnChange(VoteBits flipped);
+    std::string DumpInner() const;
+
+    const std::string name_;
+    const size_t bitCount_;
+    const VoteBits defaultParam_;
+    ChangeFunc onChange_;
+    std::array<std::atomic<uint32_t>, MAX_BITS> counters_ {};
+    std::atomic<VoteBits> result_ {0};
+    // serializes the invoker table and the callback, readers only touch the atomics
+    std::mutex mutex_;
+    std::unordered_map<uint64_t, Invoker> invokers_;
+};
+} // namespace PowerMgr
+} // namespace OHOS
+
+#endif
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "proximity_event_pipeline.h"
+
+#include <algorithm>
+
+#include "power_log.h"
+
+namespace OHOS {
+namespace PowerMgr {
+bool ProximityEventPipeline::Post(uint32_t status, int64_t timeUs)
+{
+    if (lastPosted_.exchange(status, std::memory_order_relaxed) == status) {
+        return false;
+    }
+    posted_.fetch_add(1, std::memory_order_relaxed);
+    Edge edge {status, timeUs};
+    // once an edge overflowed the later ones go there too, otherwise they would overtake it
+    if (overflowStatus_.load(std::memory_order_acquire) != STATUS_NONE || !Push(edge)) {
+        overflowTimeUs_.store(timeUs, std::memory_order_relaxed);
+        if (overflowStatus_.exchange(status, std::memory_order_acq_rel) != STATUS_NONE) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    ScheduleDrain();
+    return true;
+}
+
+bool ProximityEventPipeline::Push(const Edge& edge)
+{
+    uint32_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) >= QUEUE_CAPACITY) {
+        return false;
+    }
+    ring_[tail % QUEUE_CAPACITY] = edge;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+bool ProximityEventPipeline::Pop(Edge& edge)
+{
+    uint32_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire)) {
+        return false;
+    }
+    edge = ring_[head % QUEUE_CAPACITY];
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+void ProximityEventPipeline::ScheduleDrain()
+{
+    if (drainScheduled_.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    FFRTUtils::SubmitQueueTasks({[this]() { Drain(); }}, queue_);
+}
+
+size_t ProximityEventPipeline::Drain()
+{
+    // edges posted from now on schedule another drain
+    drainScheduled_.store(false, std::memory_order_release);
+    size_t count = 0;
+    Edge edge;
+    while (Pop(edge)) {
+        Apply(edge);
+        count++;
+    }
+    uint32_t status = overflowStatus_.exchange(STATUS_NONE, std::memory_order_acq_rel);
+    if (status != STATUS_NONE) {
+        Apply({status, overflowTimeUs_.load(std::memory_order_relaxed)});
+        count++;
+    }
+    return count;
+}
+
+void ProximityEventPipeline::Apply(const Edge& edge)
+{
+    int64_t queueUs = std::max<int64_t>(GetNowUs() - edge.timeUs, 0);
+    {
+        std::lock_guard<std::mutex> lock(statsMutex_);
+        stats_.applied++;
+        stats_.lastQueueUs = queueUs;
+        stats_.maxQueueUs = std::max(stats_.maxQueueUs, queueUs);
+    }
+    closeEdgeUs_.store(edge.status == closeStatus_ ? edge.timeUs : 0, std::memory_order_relaxed);
+    if (handler_ != nullptr) {
+        handler_(edge.status);
+    }
+}
+
+void ProximityEventPipeline::RecordScreenOff(int64_t nowUs)
+{
+    int64_t closeEdgeUs = closeEdgeUs_.exchange(0, std::memory_order_relaxed);
+    if (closeEdgeUs == 0) {
+        return;
+    }
+    int64_t latencyUs = std::max<int64_t>(nowUs - closeEdgeUs, 0);
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    stats_.screenOffNum++;
+    stats_.lastScreenOffUs = latencyUs;
+    stats_.maxScreenOffUs = std::max(stats_.maxScreenOffUs, latencyUs);
+}
+
+ProximityEventPipeline::Stats ProximityEventPipeline::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    Stats stats = stats_;
+    stats.posted = posted_.load(std::memory_order_relaxed);
+    stats.dropped = dropped_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void ProximityEventPipeline::DumpInfo(std::string& result) const
+{
+    Stats stats = GetStats();
+    result.append("  ProximityPipeline: posted=").append(std::to_string(stats.posted))
+        .append(" dropped=").append(std::to_string(stats.dropped))
+        .append(" applied=").append(std::to_string(stats.applied))
+        .append(" queueUs(last/max)=").append(std::to_string(stats.lastQueueUs))
+        .append("/").append(std::to_string(stats.maxQueueUs))
+        .append(" screenOff=").append(std::to_string(stats.screenOffNum))
+        .append(" closeToScreenOffUs(last/max)=").append(std::to_string(stats.lastScreenOffUs))
+        .append("/").append(std::to_string(stats.maxScreenOffUs))
+        .append("\n");
+}
+} // namespace PowerMgr
+} // namespace OHOS
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_PROXIMITY_EVENT_PIPELINE_H
+#define POWERMGR_PROXIMITY_EVENT_PIPELINE_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+
+#include "ffrt_utils.h"
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Moves proximity edges off the sensor callback thread. The sensor thread drops repeated samples and
+ * pushes the edges into a single producer single consumer ring, the handler runs on a dedicated ffrt
+ * queue, so a busy state machine never holds up sensor delivery.
+ */
+class ProximityEventPipeline {
+public:
+    using Handler = std::function<void(uint32_t status)>;
+    struct Stats {
+        uint64_t posted {0};
+        uint64_t dropped {0};
+        uint64_t applied {0};
+        int64_t lastQueueUs {0};
+        int64_t maxQueueUs {0};
+        uint64_t screenOffNum {0};
+        int64_t lastScreenOffUs {0};
+        int64_t maxScreenOffUs {0};
+    };
+    static constexpr uint32_t QUEUE_CAPACITY = 16;
+    static constexpr uint32_t STATUS_NONE = UINT32_MAX;
+
+    static int64_t GetNowUs()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    explicit ProximityEventPipeline(Handler handler, uint32_t closeStatus)
+        : handler_(std::move(handler)), closeStatus_(closeStatus) {}
+    ~ProximityEventPipeline() = default;
+
+    // sensor thread only, false if the status repeats the last posted one
+    bool Post(uint32_t status, int64_t timeUs);
+    // the sensor was disabled, the first sample after enabling is an edge again
+    void Reset()
+    {
+        lastPosted_.store(STATUS_NONE, std::memory_order_relaxed);
+    }
+    // apply the queued edges in order, runs on the pipeline queue
+    size_t Drain();
+    // the screen went off because of the last close edge
+    void RecordScreenOff(int64_t nowUs);
+    Stats GetStats() const;
+    void DumpInfo(std::string& result) const;
+
+private:
+    struct Edge {
+        uint32_t status {STATUS_NONE};
+        int64_t timeUs {0};
+    };
+    bool Push(const Edge& edge);
+    bool Pop(Edge& edge);
+    void Apply(const Edge& edge);
+    void ScheduleDrain();
+
+    Handler handler_;
+    const uint32_t closeStatus_;
+    std::array<Edge, QUEUE_CAPACITY> ring_;
+    std::atomic<uint32_t> head_ {0};
+    std::atomic<uint32_t> tail_ {0};
+    std::atomic<uint32_t> lastPosted_ {STATUS_NONE};
+    // newest edge that did not fit into the ring, applied after the ring is drained
+    std::atomic<uint32_t> overflowStatus_ {STATUS_NONE};
+    std::atomic<int64_t> overflowTimeUs_ {0};
+    std::atomic<bool> drainScheduled_ {false};
+    std::atomic<int64_t> closeEdgeUs_ {0};
+    std::atomic<uint64_t> posted_ {0};
+    std::atomic<uint64_t> dropped_ {0};
+    mutable std::mutex statsMutex_;
+    Stats stats_;
+    FFRTQueue queue_ {"power_proximity_pipeline"};
+};
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWERMGR_PROXIMITY_EVENT_PIPELINE_H
@@ -39,6 +39,7 @@ void RunningLockCallbackManager::Register(
     }
     callbacks_.emplace(callback, std::make_tuple(pid, uid, displayId));
 #ifdef POWER_MANAGER_LOCK_SUPPORT_MULTI_SCREEN
+    UpdateRegisteredDisplay(displayId, true);
     POWER_HILOGI(FEATURE_RUNNING_LOCK, "runningLockChangedCallbacks_.size:%{public}zu, D=%{public}" PRIu64,
         callbacks_.size(), displayId);
 #else
@@ -62,6 +63,9 @@ void RunningLockCallbackManager::UnRegister(const sptr<IRemoteObject>& callback,
                 FEATURE_RUNNING_LOCK, "UnRegisterRunningLockChangedCallback size:%{public}zu", callbacks_.size() - 1);
 #endif
             callbacks_.erase(it);
+#ifdef POWER_MANAGER_LOCK_SUPPORT_MULTI_SCREEN
+            UpdateRegisteredDisplay(displayId, false);
+#endif
             return;
         }
     }
@@ -82,6 +86,7 @@ void RunningLockCallbackManager::RemoveAll(const sptr<IRemoteObject>& callback)
     for (auto it = range.first; it != range.second; ++it) {
         POWER_HILOGI(FEATURE_RUNNING_LOCK, "RemoveAllRunningLockChangedCallbacks D=%{public}" PRIu64,
             std::get<CALLBACK_TUPLE_INDEX_DISPLAY_ID>(it->second));
+        UpdateRegisteredDisplay(std::get<CALLBACK_TUPLE_INDEX_DISPLAY_ID>(it->second), false);
     }
 #endif
     callbacks_.erase(range.first, range.second);
@@ -153,14 +158,16 @@ void RunningLockCallbackManager::NotifyScreenRunningLockChanged(RunningLockChang
 }
 
 #ifdef POWER_MANAGER_LOCK_SUPPORT_MULTI_SCREEN
-std::set<uint64_t> RunningLockCallbackManager::GetRegisteredDisplayIds()
+void RunningLockCallbackManager::UpdateRegisteredDisplay(uint64_t displayId, bool add)
 {
-    std::set<uint64_t> displayIds;
-    for (const auto& callbackPair : callbacks_) {
-        uint64_t callbackDisplayId = std::get<CALLBACK_TUPLE_INDEX_DISPLAY_ID>(callbackPair.second);
-        displayIds.insert(callbackDisplayId);
+    if (add) {
+        registeredDisplayRefs_[displayId]++;
+        return;
+    }
+    auto it = registeredDisplayRefs_.find(displayId);
+    if (it != registeredDisplayRefs_.end() && --it->second == 0) {
+        registeredDisplayRefs_.erase(it);
     }
-    return displayIds;
 }
 
 uint32_t RunningLockCallbackManager::GetScreenLockCountInternal(uint64_t displayId)
@@ -212,16 +219,16 @@ void RunningLockCallbackManager::HandleScreenLockNotify(bool active, uint64_t di
 {
     POWER_HILOGI(FEATURE_RUNNING_LOCK, "HandleScreenLockNotify active=%{public}d, D=%{public}" PRIu64,
         static_cast<int32_t>(active), displayId);
-    std::set<uint64_t> registeredDisplayIds;
     std::vector<std::pair<RunningLockChangeState, uint64_t>> notifications;
     {
         std::scoped_lock lock(mutex_, countMutex_);
-        registeredDisplayIds = GetRegisteredDisplayIds();
         UpdateScreenLockCount(active, displayId);
+        // a lock of one display only moves the count of that display, one of all displays moves each of them
         if (displayId == RUNNINGLOCK_DISPLAY_ID_ALL) {
-            registeredDisplayIds.erase(RUNNINGLOCK_DISPLAY_ID_ALL);
-            for (auto regDisplayId : registeredDisplayIds) {
-                CollectNotifications(active, regDisplayId, notifications);
+            for (const auto& displayRef : registeredDisplayRefs_) {
+                if (displayRef.first != RUNNINGLOCK_DISPLAY_ID_ALL) {
+                    CollectNotifications(active, displayRef.first, notifications);
+                }
             }
         }
         CollectNotifications(active, displayId, notifications);
@@ -58,12 +58,14 @@ private:
     ffrt::mutex mutex_;
 
 #ifdef POWER_MANAGER_LOCK_SUPPORT_MULTI_SCREEN
-    std::set<uint64_t> GetRegisteredDisplayIds();
+    void UpdateRegisteredDisplay(uint64_t displayId, bool add);
     uint32_t GetScreenLockCountInternal(uint64_t displayId);
     void UpdateScreenLockCount(bool active, uint64_t displayId);
     void CollectNotifications(
         bool active, uint64_t displayId, std::vector<std::pair<RunningLockChangeState, uint64_t>>& notifications);
 
+    // callbacks registered per display, kept with callbacks_ so an edge does not scan every callback
+    std::map<uint64_t, uint32_t> registeredDisplayRefs_;
     std::map<uint64_t, uint32_t> screenLockCountPerDisplayId_;
     ffrt::mutex countMutex_;
 #endif
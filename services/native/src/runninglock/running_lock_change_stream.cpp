@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "running_lock_change_stream.h"
+
+#include <algorithm>
+
+#include "power_log.h"
+
+namespace OHOS {
+namespace PowerMgr {
+void RunningLockChangeStream::SetObserver(const sptr<IPowerRunninglockCallback>& observer)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    observer_ = observer;
+    ResetLocked();
+    if (observer_ != nullptr && ring_.empty()) {
+        ring_.resize(RING_CAPACITY);
+    }
+}
+
+bool RunningLockChangeStream::HasObserver()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return observer_ != nullptr;
+}
+
+void RunningLockChangeStream::Push(RunningLockChangeRecord&& record)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (observer_ == nullptr) {
+        return;
+    }
+    if (size_ >= RING_CAPACITY) {
+        dropped_++;
+        totalDropped_++;
+        return;
+    }
+    ring_[(head_ + size_) % RING_CAPACITY] = std::move(record);
+    size_++;
+    if (size_ % BATCH_SIZE == 0) {
+        ScheduleFlush(0);
+    } else if (!timerPending_) {
+        timerPending_ = true;
+        ScheduleFlush(FLUSH_DELAY_MS);
+    }
+}
+
+void RunningLockChangeStream::ScheduleFlush(uint32_t delayMs)
+{
+    FFRTTask task = [this]() { Flush(); };
+    if (delayMs == 0) {
+        queue_.submit(task);
+        return;
+    }
+    FFRTUtils::SubmitDelayTask(task, delayMs, queue_);
+}
+
+void RunningLockChangeStream::Flush()
+{
+    // one flush at a time, so that batches reach the observer in the order they were taken
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+    while (true) {
+        sptr<IPowerRunninglockCallback> observer;
+        std::vector<RunningLockChangeRecord> batch;
+        uint32_t dropped = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            timerPending_ = false;
+            if (observer_ == nullptr || (size_ == 0 && dropped_ == 0)) {
+                return;
+            }
+            uint32_t count = std::min(size_, BATCH_SIZE);
+            batch.reserve(count);
+            for (uint32_t index = 0; index < count; index++) {
+                batch.push_back(std::move(ring_[head_]));
+                head_ = (head_ + 1) % RING_CAPACITY;
+            }
+            size_ -= count;
+            observer = observer_;
+            dropped = dropped_;
+            dropped_ = 0;
+        }
+        if (dropped > 0) {
+            POWER_HILOGW(FEATURE_RUNNING_LOCK, "running lock changes dropped=%{public}u", dropped);
+        }
+        observer->HandleRunningLockChanges(batch, dropped);
+    }
+}
+
+uint32_t RunningLockChangeStream::GetPendingCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_;
+}
+
+uint64_t RunningLockChangeStream::GetDroppedCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return totalDropped_;
+}
+
+void RunningLockChangeStream::ResetLocked()
+{
+    for (uint32_t index = 0; index < size_; index++) {
+        ring_[(head_ + index) % RING_CAPACITY] = RunningLockChangeRecord();
+    }
+    head_ = 0;
+    size_ = 0;
+    dropped_ = 0;
+}
+} // namespace PowerMgr
+} // namespace OHOS
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_RUNNING_LOCK_CHANGE_STREAM_H
+#define POWERMGR_RUNNING_LOCK_CHANGE_STREAM_H
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "ffrt_utils.h"
+#include "ipower_runninglock_callback.h"
+#include "running_lock_change_record.h"
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Buffers running lock changes for the registered observer and delivers them in batches, either
+ * when BATCH_SIZE records are pending or FLUSH_DELAY_MS after the first pending one. When the
+ * observer falls behind the ring fills up, new records are dropped and counted, and the count
+ * goes out with the next batch.
+ */
+class RunningLockChangeStream {
+public:
+    static constexpr uint32_t RING_CAPACITY = 1024;
+    static constexpr uint32_t BATCH_SIZE = 256;
+    static constexpr uint32_t FLUSH_DELAY_MS = 100;
+
+    static RunningLockChangeStream& GetInstance()
+    {
+        static RunningLockChangeStream stream;
+        return stream;
+    }
+
+    // pending records of the previous observer are discarded
+    void SetObserver(const sptr<IPowerRunninglockCallback>& observer);
+    bool HasObserver();
+    void Push(RunningLockChangeRecord&& record);
+    void Flush();
+    uint32_t GetPendingCount();
+    uint64_t GetDroppedCount();
+
+private:
+    RunningLockChangeStream() = default;
+    ~RunningLockChangeStream() = default;
+    void ScheduleFlush(uint32_t delayMs);
+    void ResetLocked();
+
+    std::mutex flushMutex_;
+    std::mutex mutex_;
+    sptr<IPowerRunninglockCallback> observer_;
+    std::vector<RunningLockChangeRecord> ring_;
+    uint32_t head_ {0};
+    uint32_t size_ {0};
+    uint32_t dropped_ {0};
+    uint64_t totalDropped_ {0};
+    bool timerPending_ {false};
+    FFRTQueue queue_ {"running_lock_change_stream"};
+};
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWERMGR_RUNNING_LOCK_CHANGE_STREAM_H
@@ -25,10 +25,12 @@
 #ifdef HAS_HIVIEWDFX_HITRACE_PART
 #include "hitrace_meter.h"
 #endif
+#include "power_event_recorder.h"
 #include "power_log.h"
 #include "power_mgr_factory.h"
 #include "power_mgr_service.h"
 #include "power_utils.h"
+#include "running_lock_change_stream.h"
 #include "system_suspend_controller.h"
 #include "power_hookmgr.h"
 #include "parameters.h"
@@ -40,7 +42,6 @@ namespace PowerMgr {
 namespace {
 const string TASK_RUNNINGLOCK_FORCEUNLOCK = "RunningLock_ForceUnLock";
 constexpr int32_t VALID_PID_LIMIT = 1;
-sptr<IPowerRunninglockCallback> g_runningLockCallback = nullptr;
 const string FOREGROUND_APP_LIST = "const.power.prox_dly_off_fg_apps";
 #ifdef HAS_SENSORS_SENSOR_PART
 constexpr uint32_t FOREGROUND_INCALL_DELAY_TIME_MS = 300;
@@ -234,6 +235,8 @@ bool RunningLockMgr::InitProximityController()
 void RunningLockMgr::InitLocksTypeProximity()
 {
     InitProximityController();
+    proximityPipeline_ = std::make_shared<ProximityEventPipeline>(
+        [this](uint32_t status) { SetProximity(status); }, IProximityController::PROXIMITY_CLOSE);
     lockCounters_.emplace(RunningLockType::RUNNINGLOCK_PROXIMITY_SCREEN_CONTROL,
         std::make_shared<LockCounter>(RunningLockType::RUNNINGLOCK_PROXIMITY_SCREEN_CONTROL,
             [this](bool active, [[maybe_unused]] RunningLockParam runningLockParam) -> int32_t {
@@ -267,6 +270,7 @@ void RunningLockMgr::InitLocksTypeProximity()
                 FFRTUtils::SubmitTask(task);
                 proximityController_->Disable();
                 proximityController_->Clear();
+                proximityPipeline_->Reset();
             }
             return RUNNINGLOCK_SUCCESS;
         })
@@ -427,22 +431,16 @@ bool RunningLockMgr::NeedNotify(RunningLockType type)
 
 void RunningLockMgr::UpdateUnSceneLockLists(RunningLockParam& singleLockParam, bool fill)
 {
-    std::lock_guard<ffrt::mutex> lock(screenLockListsMutex_);
-    auto iterator = unSceneLockLists_.find(std::to_string(singleLockParam.lockid));
+    std::string lockId = std::to_string(singleLockParam.lockid);
     if (fill) {
-        if (iterator == unSceneLockLists_.end()) {
+        if (screenLockIndex_.Add(lockId, FillAppRunningLockInfo(singleLockParam))) {
             POWER_HILOGD(FEATURE_RUNNING_LOCK, "Add non-scene lock information from lists");
-            RunningLockInfo unSceneAppLockInfo = FillAppRunningLockInfo(singleLockParam);
-            unSceneLockLists_.insert(
-                std::pair<std::string, RunningLockInfo>(std::to_string(singleLockParam.lockid), unSceneAppLockInfo));
         }
         return;
     }
-    if (iterator != unSceneLockLists_.end()) {
+    if (screenLockIndex_.Remove(lockId)) {
         POWER_HILOGD(FEATURE_RUNNING_LOCK, "Remove non-scene lock information from lists");
-        unSceneLockLists_.erase(iterator);
     }
-    return;
 }
 
 RunningLockInfo RunningLockMgr::FillAppRunningLockInfo(const RunningLockParam& info)
@@ -647,44 +645,36 @@ void RunningLockMgr::WriteHiSysEvent(std::shared_ptr<RunningLockInner>& lockInne
     int32_t beginTimeMs = lockInner->GetBeginTime();
     if (endTimeMs - beginTimeMs > APP_HOLD_RUNNINGLOCK_TIMEOUT) {
         POWER_HILOGI(FEATURE_RUNNING_LOCK, "app hold runninglock timeout=%{public}d", (endTimeMs - beginTimeMs));
-        HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "APP_HOLD_RUNNINGLOCK_TIMEOUT",
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR, "PID", lockInner->GetPid(), "UID", lockInner->GetUid(),
-            "TYPE", static_cast<int32_t>(lockInner->GetParam().type), "NAME", lockInner->GetParam().name);
+        PowerEventRecorder::GetInstance().Record([pid = lockInner->GetPid(), uid = lockInner->GetUid(),
+            type = static_cast<int32_t>(lockInner->GetParam().type), name = lockInner->GetParam().name]() {
+            HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "APP_HOLD_RUNNINGLOCK_TIMEOUT",
+                HiviewDFX::HiSysEvent::EventType::BEHAVIOR, "PID", pid, "UID", uid, "TYPE", type, "NAME", name);
+        });
     }
 #endif
 }
 
 void RunningLockMgr::RegisterRunningLockCallback(const sptr<IPowerRunninglockCallback>& callback)
 {
-    if (g_runningLockCallback != nullptr) {
-        UnRegisterRunningLockCallback(callback);
-    }
-    g_runningLockCallback = callback;
+    RunningLockChangeStream::GetInstance().SetObserver(callback);
     POWER_HILOGI(FEATURE_RUNNING_LOCK, "RegisterRunningLockCallback success");
 }
 
 void RunningLockMgr::UnRegisterRunningLockCallback(const sptr<IPowerRunninglockCallback>& callback)
 {
-    g_runningLockCallback = nullptr;
+    RunningLockChangeStream::GetInstance().SetObserver(nullptr);
     POWER_HILOGI(FEATURE_RUNNING_LOCK, "UnRegisterRunningLockCallback success");
 }
 
 void RunningLockMgr::QueryRunningLockLists(std::map<std::string, RunningLockInfo>& runningLockLists, uint64_t displayId)
 {
-    std::lock_guard<ffrt::mutex> lock(screenLockListsMutex_);
 #ifdef POWER_MANAGER_LOCK_SUPPORT_MULTI_SCREEN
-    for (auto& iter : unSceneLockLists_) {
-        if (iter.second.displayId == displayId || iter.second.displayId == RUNNINGLOCK_DISPLAY_ID_ALL) {
-            runningLockLists.insert(std::pair<std::string, RunningLockInfo>(iter.first, iter.second));
-        }
-    }
-    POWER_HILOGI(FEATURE_RUNNING_LOCK, "QueryRunningLockLists D=%{public}" PRIu64 ", size:%{public}zu", displayId,
-        runningLockLists.size());
+    screenLockIndex_.Query(runningLockLists, displayId);
+    POWER_HILOGI_LIMITED(FEATURE_RUNNING_LOCK, "QueryRunningLockLists D=%{public}" PRIu64 ", size:%{public}zu",
+        displayId, runningLockLists.size());
 #else
-    for (auto& iter : unSceneLockLists_) {
-        runningLockLists.insert(std::pair<std::string, RunningLockInfo>(iter.first, iter.second));
-    }
-    POWER_HILOGI(FEATURE_RUNNING_LOCK, "QueryRunningLockLists size:%{public}zu", runningLockLists.size());
+    screenLockIndex_.QueryAll(runningLockLists);
+    POWER_HILOGI_LIMITED(FEATURE_RUNNING_LOCK, "QueryRunningLockLists size:%{public}zu", runningLockLists.size());
 #endif
 }
 
@@ -713,10 +703,7 @@ uint32_t RunningLockMgr::GetValidRunningLockNum(RunningLockType type, uint64_t d
 {
 #ifdef POWER_MANAGER_LOCK_SUPPORT_MULTI_SCREEN
     if (type == RunningLockType::RUNNINGLOCK_SCREEN) {
-        std::lock_guard<ffrt::mutex> lock(screenLockListsMutex_);
-        return std::count_if(unSceneLockLists_.begin(), unSceneLockLists_.end(), [displayId](const auto& pair) {
-            return pair.second.displayId == displayId || pair.second.displayId == RUNNINGLOCK_DISPLAY_ID_ALL;
-        });
+        return screenLockIndex_.GetCount(displayId);
     }
 #endif
     auto iterator = lockCounters_.find(type);
@@ -740,33 +727,29 @@ bool RunningLockMgr::ExistValidRunningLock()
     return false;
 }
 
-void RunningLockMgr::NotifyRunningLockChanged(const RunningLockParam& lockInnerParam, const std::string &tag,
-    const std::string &logTag)
+void RunningLockMgr::NotifyRunningLockChanged(const RunningLockParam& lockInnerParam, RunningLockChangeAction action)
 {
-    uint64_t lockid = lockInnerParam.lockid;
-    int32_t pid = lockInnerParam.pid;
-    int32_t uid = lockInnerParam.uid;
-    int32_t type = static_cast <int32_t>(lockInnerParam.type);
-    auto pos = lockInnerParam.name.rfind('_');
-    string name = lockInnerParam.name.substr(0, pos);
-    string bundleName = lockInnerParam.bundleName;
-    auto now = std::chrono::system_clock::now();
-    auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
-    std::string message;
-    message.append("LOCKID=").append(std::to_string(lockid))
-            .append(" PID=").append(std::to_string(pid))
-            .append(" UID=").append(std::to_string(uid))
-            .append(" TYPE=").append(std::to_string(type))
-            .append(" NAME=").append(name)
-            .append(" BUNDLENAME=").append(bundleName)
-            .append(" TAG=").append(tag)
-            .append(" TIMESTAMP=").append(std::to_string(timestamp));
+    static constexpr const char* LOG_TAGS[] = {"AD", "RE", "UP"};
+    int32_t type = static_cast<int32_t>(lockInnerParam.type);
     // runninglock message
-    POWER_HILOGI(COMP_LOCK, "P=%{public}dU=%{public}dT=%{public}dN=%{public}sB=%{public}sTA=%{public}s",
-        pid, uid, type, lockInnerParam.name.c_str(), bundleName.c_str(), logTag.c_str());
-    if (g_runningLockCallback != nullptr) {
-        g_runningLockCallback->HandleRunningLockMessage(message);
+    POWER_HILOGI_LIMITED(COMP_LOCK, "P=%{public}dU=%{public}dT=%{public}dN=%{public}sB=%{public}sTA=%{public}s",
+        lockInnerParam.pid, lockInnerParam.uid, type, lockInnerParam.name.c_str(), lockInnerParam.bundleName.c_str(),
+        action < RunningLockChangeAction::BUTT ? LOG_TAGS[static_cast<uint32_t>(action)] : "");
+    auto& stream = RunningLockChangeStream::GetInstance();
+    if (!stream.HasObserver()) {
+        return;
     }
+    RunningLockChangeRecord record;
+    record.lockid = lockInnerParam.lockid;
+    record.pid = lockInnerParam.pid;
+    record.uid = lockInnerParam.uid;
+    record.type = type;
+    record.action = action;
+    auto now = std::chrono::system_clock::now();
+    record.timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
+    record.name.assign(lockInnerParam.name, 0, lockInnerParam.name.rfind('_'));
+    record.bundleName = lockInnerParam.bundleName;
+    stream.Push(std::move(record));
 }
 
 uint64_t RunningLockMgr::TransformLockid(const sptr<IRemoteObject>& remoteObj)
@@ -897,6 +880,9 @@ void RunningLockMgr::DumpInfo(std::string& result)
 
     result.append("Dump Proxy List: \n");
     result.append(runninglockProxy_->DumpProxyInfo());
+#ifdef POWER_MANAGER_LOCK_SUPPORT_MULTI_SCREEN
+    screenLockIndex_.DumpInfo(result);
+#endif
 #ifdef HAS_SENSORS_SENSOR_PART
     result.append("Peripherals Info: \n")
             .append("  Proximity: ")
@@ -905,6 +891,9 @@ void RunningLockMgr::DumpInfo(std::string& result)
             .append(" Status=")
             .append(ToString(proximityController_->GetStatus()))
             .append("\n");
+    if (proximityPipeline_ != nullptr) {
+        proximityPipeline_->DumpInfo(result);
+    }
 #endif
 }
 
@@ -933,7 +922,7 @@ int32_t RunningLockMgr::LockCounter::Increase(const RunningLockParam& lockInnerP
         }
     }
     if (result == RUNNINGLOCK_SUCCESS && NeedNotify(lockInnerParam.type)) {
-        NotifyRunningLockChanged(lockInnerParam, "DUBAI_TAG_RUNNINGLOCK_ADD", "AD");
+        NotifyRunningLockChanged(lockInnerParam, RunningLockChangeAction::ADD);
     }
     return result;
 }
@@ -949,7 +938,7 @@ int32_t RunningLockMgr::LockCounter::Decrease(const RunningLockParam& lockInnerP
         }
     }
     if (result == RUNNINGLOCK_SUCCESS && NeedNotify(lockInnerParam.type)) {
-        NotifyRunningLockChanged(lockInnerParam, "DUBAI_TAG_RUNNINGLOCK_REMOVE", "RE");
+        NotifyRunningLockChanged(lockInnerParam, RunningLockChangeAction::REMOVE);
     }
     return result;
 }
@@ -986,9 +975,9 @@ void RunningLockMgr::ProximityController::RecordSensorCallback(SensorEvent *even
 
     POWER_HILOGI(FEATURE_RUNNING_LOCK, "SensorD=%{public}d", distance);
     if (distance == PROXIMITY_CLOSE_SCALAR) {
-        runningLock->SetProximity(IProximityController::PROXIMITY_CLOSE);
+        runningLock->PostProximity(IProximityController::PROXIMITY_CLOSE);
     } else if (distance == PROXIMITY_AWAY_SCALAR) {
-        runningLock->SetProximity(IProximityController::PROXIMITY_AWAY);
+        runningLock->PostProximity(IProximityController::PROXIMITY_AWAY);
     }
 }
 
@@ -1036,8 +1025,10 @@ void RunningLockMgr::ProximityController::OnAway()
 
 bool RunningLockMgr::IsVoiceAppForeground()
 {
-    std::string foregroundApp = OHOS::system::GetParameter(FOREGROUND_APP_LIST, "");
-    if (PowerUtils::IsForegroundApplication(PowerUtils::Split(foregroundApp, ';'))) {
+    // a const parameter, split once
+    static const std::set<std::string> voiceApps =
+        PowerUtils::Split(OHOS::system::GetParameter(FOREGROUND_APP_LIST, ""), ';');
+    if (PowerUtils::IsForegroundApplication(voiceApps)) {
         POWER_HILOGI(FEATURE_RUNNING_LOCK, "The voice app is in foreground");
         return true;
     }
@@ -1137,6 +1128,22 @@ void RunningLockMgr::SetProximity(uint32_t status)
     }
 }
 
+void RunningLockMgr::PostProximity(uint32_t status)
+{
+    if (proximityPipeline_ == nullptr) {
+        SetProximity(status);
+        return;
+    }
+    proximityPipeline_->Post(status, ProximityEventPipeline::GetNowUs());
+}
+
+void RunningLockMgr::OnProximityScreenOff()
+{
+    if (proximityPipeline_ != nullptr) {
+        proximityPipeline_->RecordScreenOff(ProximityEventPipeline::GetNowUs());
+    }
+}
+
 bool RunningLockMgr::IsExistAudioStream(pid_t uid)
 {
     return runninglockProxy_->IsExistAudioStream(uid);
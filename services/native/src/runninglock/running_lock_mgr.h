@@ -28,6 +28,7 @@
 #include "running_lock_proxy.h"
 #include "running_lock_token_stub.h"
 #include "running_lock_info.h"
+#include "screen_lock_index.h"
 #include "ipower_runninglock_callback.h"
 #ifdef POWER_MANAGER_ENABLE_MONITOR_RUNNING_LOCK_CHANGE
 #include "irunning_lock_changed_callback.h"
@@ -35,6 +36,7 @@
 #endif
 #ifdef HAS_SENSORS_SENSOR_PART
 #include "proximity_controller_base.h"
+#include "proximity_event_pipeline.h"
 #endif
 #include "ffrt_utils.h"
 
@@ -81,8 +83,7 @@ public:
     {
         return runningLocks_;
     }
-    static void NotifyRunningLockChanged(const RunningLockParam& lockInnerParam,
-        const std::string &tag, const std::string &logTag);
+    static void NotifyRunningLockChanged(const RunningLockParam& lockInnerParam, RunningLockChangeAction action);
     bool ProxyRunningLock(bool isProxied, pid_t pid, pid_t uid);
     void ProxyRunningLocks(bool isProxied, const std::vector<std::pair<pid_t, pid_t>>& processInfos);
     void LockInnerByProxy(const sptr<IRemoteObject>& remoteObj, std::shared_ptr<RunningLockInner>& lockInner);
@@ -92,6 +93,9 @@ public:
     static constexpr uint32_t CHECK_TIMEOUT_INTERVAL_MS = 60 * 1000;
 #ifdef HAS_SENSORS_SENSOR_PART
     void SetProximity(uint32_t status);
+    // sensor thread, the status is applied later on the proximity pipeline
+    void PostProximity(uint32_t status);
+    void OnProximityScreenOff();
     bool IsProximityClose();
 #endif
     void DumpInfo(std::string& result);
@@ -177,7 +181,6 @@ private:
 
     const wptr<PowerMgrService> pms_;
     ffrt::mutex mutex_;
-    ffrt::mutex screenLockListsMutex_;
     RunningLockMap runningLocks_;
     std::map<RunningLockType, std::shared_ptr<LockCounter>> lockCounters_;
 #ifdef POWER_MANAGER_ENABLE_MONITOR_RUNNING_LOCK_CHANGE
@@ -187,9 +190,14 @@ private:
     std::shared_ptr<RunningLockProxy> runninglockProxy_;
     sptr<IRemoteObject::DeathRecipient> runningLockDeathRecipient_;
     std::shared_ptr<IRunningLockAction> runningLockAction_;
-    std::map<std::string, RunningLockInfo> unSceneLockLists_;
+    // the enabled screen locks, indexed by display
+    ScreenLockIndex screenLockIndex_;
     std::shared_ptr<FFRTTimer> ffrtTimer_ {nullptr};
     std::shared_ptr<EventFwk::CommonEventSubscriber> subscriberPtr_ {nullptr};
+#ifdef HAS_SENSORS_SENSOR_PART
+    // destroyed first, its queued edges call back into this object
+    std::shared_ptr<ProximityEventPipeline> proximityPipeline_ {nullptr};
+#endif
 };
 
 #ifdef POWER_MANAGER_ENABLE_FORCE_SLEEP_BROADCAST
@@ -144,15 +144,15 @@ void RunningLockProxy::ProxyInner(const sptr<IRemoteObject>& remoteObj,
     lockInner->SetBundleName(bundleNames);
     switch (event) {
         case RunningLockEvent::RUNNINGLOCK_UPDATE:
-            rlmgr->NotifyRunningLockChanged(lockInner->GetParam(), "DUBAI_TAG_RUNNINGLOCK_UPDATE", "UP");
+            rlmgr->NotifyRunningLockChanged(lockInner->GetParam(), RunningLockChangeAction::UPDATE);
             break;
         case RunningLockEvent::RUNNINGLOCK_PROXY:
-            rlmgr->NotifyRunningLockChanged(lockInner->GetParam(), "DUBAI_TAG_RUNNINGLOCK_UPDATE", "UP");
+            rlmgr->NotifyRunningLockChanged(lockInner->GetParam(), RunningLockChangeAction::UPDATE);
             rlmgr->UnlockInnerByProxy(remoteObj, lockInner);
             break;
         case RunningLockEvent::RUNNINGLOCK_UNPROXY:
             rlmgr->LockInnerByProxy(remoteObj, lockInner);
-            rlmgr->NotifyRunningLockChanged(lockInner->GetParam(), "DUBAI_TAG_RUNNINGLOCK_UPDATE", "UP");
+            rlmgr->NotifyRunningLockChanged(lockInner->GetParam(), RunningLockChangeAction::UPDATE);
             break;
         default:
             break;
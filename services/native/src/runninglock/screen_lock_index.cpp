@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "screen_lock_index.h"
+
+#include "actions/running_lock_action_info.h"
+
+namespace OHOS {
+namespace PowerMgr {
+bool ScreenLockIndex::Add(const std::string& lockId, const RunningLockInfo& info)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (!displayByLock_.emplace(lockId, info.displayId).second) {
+        return false;
+    }
+    locksByDisplay_[info.displayId].emplace(lockId, info);
+    return true;
+}
+
+bool ScreenLockIndex::Remove(const std::string& lockId)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto lockIter = displayByLock_.find(lockId);
+    if (lockIter == displayByLock_.end()) {
+        return false;
+    }
+    auto bucketIter = locksByDisplay_.find(lockIter->second);
+    if (bucketIter != locksByDisplay_.end()) {
+        bucketIter->second.erase(lockId);
+        if (bucketIter->second.empty()) {
+            locksByDisplay_.erase(bucketIter);
+        }
+    }
+    displayByLock_.erase(lockIter);
+    return true;
+}
+
+uint32_t ScreenLockIndex::GetCountInner(uint64_t displayId) const
+{
+    auto iter = locksByDisplay_.find(displayId);
+    uint32_t count = (iter == locksByDisplay_.end()) ? 0 : static_cast<uint32_t>(iter->second.size());
+    if (displayId != RUNNINGLOCK_DISPLAY_ID_ALL) {
+        auto allIter = locksByDisplay_.find(RUNNINGLOCK_DISPLAY_ID_ALL);
+        count += (allIter == locksByDisplay_.end()) ? 0 : static_cast<uint32_t>(allIter->second.size());
+    }
+    return count;
+}
+
+uint32_t ScreenLockIndex::GetCount(uint64_t displayId)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return GetCountInner(displayId);
+}
+
+uint32_t ScreenLockIndex::GetTotalCount()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return static_cast<uint32_t>(displayByLock_.size());
+}
+
+void ScreenLockIndex::Query(std::map<std::string, RunningLockInfo>& lockLists, uint64_t displayId)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto iter = locksByDisplay_.find(displayId);
+    if (iter != locksByDisplay_.end()) {
+        lockLists.insert(iter->second.begin(), iter->second.end());
+    }
+    if (displayId != RUNNINGLOCK_DISPLAY_ID_ALL) {
+        auto allIter = locksByDisplay_.find(RUNNINGLOCK_DISPLAY_ID_ALL);
+        if (allIter != locksByDisplay_.end()) {
+            lockLists.insert(allIter->second.begin(), allIter->second.end());
+        }
+    }
+}
+
+void ScreenLockIndex::QueryAll(std::map<std::string, RunningLockInfo>& lockLists)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    for (const auto& bucket : locksByDisplay_) {
+        lockLists.insert(bucket.second.begin(), bucket.second.end());
+    }
+}
+
+void ScreenLockIndex::DumpInfo(std::string& result)
+{
+    std::map<uint64_t, std::pair<uint32_t, uint32_t>> counts;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        for (const auto& bucket : locksByDisplay_) {
+            counts.emplace(bucket.first, std::make_pair(bucket.second.size(), GetCountInner(bucket.first)));
+        }
+    }
+    result.append("Screen Locks By Display: \n");
+    if (counts.empty()) {
+        result.append("  none\n");
+        return;
+    }
+    for (const auto& count : counts) {
+        if (count.first == RUNNINGLOCK_DISPLAY_ID_ALL) {
+            result.append("  D=ALL");
+        } else {
+            result.append("  D=").append(std::to_string(count.first));
+        }
+        result.append(" own=").append(std::to_string(count.second.first))
+            .append(" effective=").append(std::to_string(count.second.second))
+            .append("\n");
+    }
+}
+} // namespace PowerMgr
+} // namespace OHOS
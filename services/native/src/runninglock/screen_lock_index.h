@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_SCREEN_LOCK_INDEX_H
+#define POWERMGR_SCREEN_LOCK_INDEX_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include "ffrt_utils.h"
+#include "running_lock_info.h"
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * The enabled screen locks, bucketed by the display they keep on. A lock of RUNNINGLOCK_DISPLAY_ID_ALL
+ * keeps every display on, so it counts for each of them. Queries for one display only touch its own
+ * bucket and the shared one, never the locks of the other displays.
+ */
+class ScreenLockIndex {
+public:
+    ScreenLockIndex() = default;
+    ~ScreenLockIndex() = default;
+
+    // false when the lock is already indexed
+    bool Add(const std::string& lockId, const RunningLockInfo& info);
+    // false when the lock is not indexed
+    bool Remove(const std::string& lockId);
+    // the locks keeping displayId on, those of RUNNINGLOCK_DISPLAY_ID_ALL included
+    uint32_t GetCount(uint64_t displayId);
+    uint32_t GetTotalCount();
+    void Query(std::map<std::string, RunningLockInfo>& lockLists, uint64_t displayId);
+    void QueryAll(std::map<std::string, RunningLockInfo>& lockLists);
+    void DumpInfo(std::string& result);
+
+private:
+    using LockBucket = std::map<std::string, RunningLockInfo>;
+
+    uint32_t GetCountInner(uint64_t displayId) const;
+
+    std::unordered_map<uint64_t, LockBucket> locksByDisplay_;
+    std::unordered_map<std::string, uint64_t> displayByLock_;
+    ffrt::mutex mutex_;
+};
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWERMGR_SCREEN_LOCK_INDEX_H
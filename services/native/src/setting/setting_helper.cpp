@@ -69,6 +69,33 @@ void SettingHelper::CopyDataForUpdateScene()
     settingProvider.CopyDataForUpdateScene();
 }
 #endif
+bool SettingHelper::GetProfileSettings(ProfileSettings& settings)
+{
+    std::vector<std::string> keys {
+        SETTING_POWER_WAKEUP_SOURCES_KEY,
+#ifdef POWER_MANAGER_ENABLE_CHARGING_TYPE_SETTING
+        SETTING_POWER_AC_SUSPEND_SOURCES_KEY,
+        SETTING_POWER_DC_SUSPEND_SOURCES_KEY,
+#else
+        SETTING_POWER_SUSPEND_SOURCES_KEY,
+#endif
+    };
+    std::unordered_map<std::string, std::string> values;
+    SettingProvider& settingProvider = SettingProvider::GetInstance(POWER_MANAGER_SERVICE_ID);
+    ErrCode ret = settingProvider.GetStringValues(keys, values);
+    if (ret != ERR_OK) {
+        POWER_HILOGW(COMP_UTILS, "get profile settings failed, ret=%{public}d", ret);
+    }
+    settings.wakeupSources = values[SETTING_POWER_WAKEUP_SOURCES_KEY];
+#ifdef POWER_MANAGER_ENABLE_CHARGING_TYPE_SETTING
+    settings.acSuspendSources = values[SETTING_POWER_AC_SUSPEND_SOURCES_KEY];
+    settings.dcSuspendSources = values[SETTING_POWER_DC_SUSPEND_SOURCES_KEY];
+#else
+    settings.suspendSources = values[SETTING_POWER_SUSPEND_SOURCES_KEY];
+#endif
+    return ret == ERR_OK;
+}
+
 bool SettingHelper::IsSettingKeyValid(const std::string& key)
 {
     return SettingProvider::GetInstance(POWER_MANAGER_SERVICE_ID).IsValidKey(key);
@@ -692,6 +719,11 @@ int64_t SettingHelper::GetSettingPowerAcSleepTime(int64_t defaultVal)
     return value;
 }
 
+sptr<SettingObserver> SettingHelper::RegisterSettingPowerAcSleepTimeObserver(SettingObserver::UpdateFunc& func)
+{
+    return RegisterSettingKeyObserver(SETTING_POWER_AC_SLEEP_TIME_KEY, func);
+}
+
 int64_t SettingHelper::GetSettingPowerDcSleepTime(int64_t defaultVal)
 {
     int64_t value = GetSettingLongValue(SETTING_POWER_DC_SLEEP_TIME_KEY, defaultVal);
@@ -701,6 +733,11 @@ int64_t SettingHelper::GetSettingPowerDcSleepTime(int64_t defaultVal)
     }
     return value;
 }
+
+sptr<SettingObserver> SettingHelper::RegisterSettingPowerDcSleepTimeObserver(SettingObserver::UpdateFunc& func)
+{
+    return RegisterSettingKeyObserver(SETTING_POWER_DC_SLEEP_TIME_KEY, func);
+}
 #endif
 
 #ifdef POWER_MANAGER_ENABLE_BLOCK_LONG_PRESS
@@ -31,7 +31,20 @@ public:
         DISABLE = 0,
         ENABLE = 1,
     };
+    /**
+     * Overrides of the json profiles, an empty string means the key is not set.
+     */
+    struct ProfileSettings {
+        std::string wakeupSources;
+#ifdef POWER_MANAGER_ENABLE_CHARGING_TYPE_SETTING
+        std::string acSuspendSources;
+        std::string dcSuspendSources;
+#else
+        std::string suspendSources;
+#endif
+    };
     static void RegisterAodSwitchObserver();
+    static bool GetProfileSettings(ProfileSettings& settings);
     static void UpdateCurrentUserId();
 #ifdef POWER_PICKUP_ENABLE
     static void CopyDataForUpdateScene();
@@ -57,7 +70,9 @@ public:
     static void SetSettingDcSuspendSources(const std::string& jsonConfig);
     static sptr<SettingObserver> RegisterSettingDcSuspendSourcesObserver(SettingObserver::UpdateFunc& func);
     static int64_t GetSettingPowerAcSleepTime(int64_t defaultVal);
+    static sptr<SettingObserver> RegisterSettingPowerAcSleepTimeObserver(SettingObserver::UpdateFunc& func);
     static int64_t GetSettingPowerDcSleepTime(int64_t defaultVal);
+    static sptr<SettingObserver> RegisterSettingPowerDcSleepTimeObserver(SettingObserver::UpdateFunc& func);
 #else
     static int64_t GetSettingDisplayOffTime(int64_t defaultVal);
     static void SetSettingDisplayOffTime(int64_t time);
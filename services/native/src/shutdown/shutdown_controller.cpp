@@ -22,6 +22,8 @@
 #include "power_mgr_factory.h"
 #include "screen_manager_lite.h"
 #include "parameters.h"
+#include "ffrt_utils.h"
+#include "shutdown_orchestrator.h"
 
 #include <algorithm>
 #include <cinttypes>
@@ -30,11 +32,9 @@
 #include <common_event_publish_info.h>
 #include <common_event_support.h>
 #include <datetime_ex.h>
-#include <future>
 #ifdef HAS_HIVIEWDFX_HISYSEVENT_PART
 #include <hisysevent.h>
 #endif
-#include <thread>
 #include <dlfcn.h>
 #include <fcntl.h>
 #include <sys/ioctl.h>
@@ -47,9 +47,17 @@ using namespace std;
 namespace OHOS {
 namespace PowerMgr {
 namespace {
-constexpr std::chrono::seconds CALLBACK_TIMEOUT = 10s;
-constexpr std::chrono::seconds OFF_TIMEOUT = 5s;
-const time_t MAX_TIMEOUT_SEC = 30;
+// reboot is bounded by this deadline, each phase gets its own share of it
+constexpr int64_t SHUTDOWN_BUDGET_MS = 45000;
+constexpr int64_t PUBLISH_EVENT_BUDGET_MS = 2000;
+constexpr int64_t SYNC_CALLBACK_BUDGET_MS = 10000;
+constexpr int64_t SCREEN_OFF_BUDGET_MS = 5000;
+constexpr int64_t ASYNC_CALLBACK_BUDGET_MS = 30000;
+const std::string PHASE_PUBLISH_EVENT = "publish_event";
+const std::string PHASE_SYNC_CALLBACK = "sync_callback";
+const std::string PHASE_SCREEN_OFF = "screen_off";
+const std::string PHASE_ASYNC_CALLBACK = "async_callback";
+const std::string SHUTDOWN_REPORT_PATH = "/data/service/el0/powermgr/shutdown_report";
 #ifdef POWER_MANAGER_ENABLE_JUDGING_TAKEOVER_SHUTDOWN
 const vector<string> REASONS_DISABLE_TAKE_OVER = {"LowCapacity", "HibernateFail"};
 #endif
@@ -71,6 +79,7 @@ ShutdownController::ShutdownController() : started_(false)
     takeoverShutdownCallbackHolder_ = new ShutdownCallbackHolder();
     asyncShutdownCallbackHolder_ = new ShutdownCallbackHolder();
     syncShutdownCallbackHolder_ = new ShutdownCallbackHolder();
+    lastShutdownReport_ = ShutdownOrchestrator::LoadReport(SHUTDOWN_REPORT_PATH);
 }
 
 PowerErrors ShutdownController::Reboot(const std::string& reason, bool force)
@@ -111,11 +120,6 @@ static void SetFrameworkFinishBootStage(void)
     return;
 }
 
-namespace {
-std::future<void> g_futForSyncCb;
-std::future<void> g_futForOff;
-}
-
 void ShutdownController::SetShutdownReason(const std::string& reason)
 {
     constexpr uint32_t PARAM_ZERO = 0;
@@ -151,32 +155,18 @@ PowerErrors ShutdownController::RebootOrShutdown(const std::string& reason, bool
         }
     }
     started_ = true;
-    POWER_KHILOGI(FEATURE_SHUTDOWN, "Start to detach shutdown thread");
+    POWER_KHILOGI(FEATURE_SHUTDOWN, "Start to submit shutdown task");
 #ifdef HAS_HIVIEWDFX_HISYSEVENT_PART
     ReportDoShutdown();
 #endif
     SetShutdownReason(reason);
-    PublishShutdownEvent();
-    std::string actionTimeStr = std::to_string(GetCurrentRealTimeMs());
     PowerEventType eventType = isReboot ? PowerEventType::REBOOT : PowerEventType::SHUTDOWN;
     system::SetParameter("persist.dfx.eventtype", to_string(eventType));
-    if (force) {
-        // only two threads are allowed, next time it blocks
-        // either block or thread leak. since the previous action is shutdown, block is safer than thread leak
-        g_futForSyncCb = async(launch::async, &ShutdownController::TriggerSyncShutdownCallback, this, isReboot);
-        g_futForSyncCb.wait_for(CALLBACK_TIMEOUT);
-        actionTimeStr = actionTimeStr + "," + std::to_string(GetCurrentRealTimeMs());
-        g_futForOff = async(launch::async, &ShutdownController::TurnOffScreen, this);
-        g_futForOff.wait_for(OFF_TIMEOUT);
-    } else {
-        TriggerSyncShutdownCallback(isReboot);
-        actionTimeStr = actionTimeStr + "," + std::to_string(GetCurrentRealTimeMs());
-        TurnOffScreen();
-    }
-    actionTimeStr = actionTimeStr + "," + std::to_string(GetCurrentRealTimeMs());
-    system::SetParameter("persist.dfx.shutdownactiontime", actionTimeStr);
-    make_unique<thread>([=] {
-        Prepare(isReboot);
+    // the caller still returns only after the shutdown event and the sync callbacks, as before the phases
+    auto foregroundDone = std::make_shared<std::promise<void>>();
+    std::future<void> foregroundFuture = foregroundDone->get_future();
+    FFRTUtils::SubmitTask([this, reason, isReboot, foregroundDone]() {
+        RunShutdownPhases(reason, isReboot, foregroundDone);
         POWER_KHILOGI(FEATURE_SHUTDOWN, "reason = %{public}s, reboot = %{public}d", reason.c_str(), isReboot);
         if (devicePowerAction_ != nullptr) {
             std::string shutdownDeviceTime = std::to_string(GetCurrentRealTimeMs());
@@ -184,26 +174,55 @@ PowerErrors ShutdownController::RebootOrShutdown(const std::string& reason, bool
             isReboot ? devicePowerAction_->Reboot(reason) : devicePowerAction_->Shutdown(reason);
         }
         started_ = false;
-    })->detach();
+    });
+    foregroundFuture.wait();
     return PowerErrors::ERR_OK;
 }
 
-void ShutdownController::Prepare(bool isReboot)
+void ShutdownController::RunShutdownPhases(
+    const std::string& reason, bool isReboot, const std::shared_ptr<std::promise<void>>& foregroundDone)
 {
-    auto callbackStart = [&]() {
-        TriggerAsyncShutdownCallback(isReboot);
+    auto notified = std::make_shared<std::atomic_bool>(false);
+    auto notifyForeground = [foregroundDone, notified]() {
+        if (!notified->exchange(true)) {
+            foregroundDone->set_value();
+        }
     };
+    // the sync callbacks run before the screen goes off and the async ones after both, as they always did,
+    // only publishing the shutdown event runs next to the sync callbacks
+    ShutdownOrchestrator orchestrator(SHUTDOWN_BUDGET_MS);
+    orchestrator.AddPhase(PHASE_PUBLISH_EVENT, {}, PUBLISH_EVENT_BUDGET_MS, [this]() { PublishShutdownEvent(); });
+    orchestrator.AddPhase(PHASE_SYNC_CALLBACK, {}, SYNC_CALLBACK_BUDGET_MS,
+        [this, isReboot]() { TriggerSyncShutdownCallback(isReboot); });
+    orchestrator.AddPhase(PHASE_SCREEN_OFF, {PHASE_SYNC_CALLBACK}, SCREEN_OFF_BUDGET_MS,
+        [this]() { TurnOffScreen(); });
+    orchestrator.AddPhase(PHASE_ASYNC_CALLBACK, {PHASE_PUBLISH_EVENT, PHASE_SYNC_CALLBACK, PHASE_SCREEN_OFF},
+        ASYNC_CALLBACK_BUDGET_MS, [this, isReboot, notifyForeground]() {
+            notifyForeground();
+            TriggerAsyncShutdownCallback(isReboot);
+        });
+    int64_t beginMs = GetCurrentRealTimeMs();
+    orchestrator.Run();
+    // the deadline passed before the async callbacks could start
+    notifyForeground();
+
+    // begin, sync callbacks done and screen off done, in the real time the dfx tools expect
+    std::string actionTimeStr = std::to_string(beginMs);
+    for (const auto& phase : {PHASE_SYNC_CALLBACK, PHASE_SCREEN_OFF}) {
+        int64_t endMs = orchestrator.GetPhaseEndMs(phase);
+        actionTimeStr.append(",").append(std::to_string(endMs < 0 ? GetCurrentRealTimeMs() : beginMs + endMs));
+    }
+    system::SetParameter("persist.dfx.shutdownactiontime", actionTimeStr);
 
-    packaged_task<void()> callbackTask(callbackStart);
-    future<void> fut = callbackTask.get_future();
-    make_unique<thread>(std::move(callbackTask))->detach();
+    std::string report = "LAST SHUTDOWN: reason=" + reason + " reboot=" + std::to_string(isReboot) +
+        " time=" + std::to_string(beginMs) + " " + orchestrator.FormatReport();
+    POWER_KHILOGI(FEATURE_SHUTDOWN, "%{public}s", report.c_str());
+    ShutdownOrchestrator::SaveReport(SHUTDOWN_REPORT_PATH, report);
+}
 
-    POWER_KHILOGI(FEATURE_SHUTDOWN, "Waiting for the callback execution complete...");
-    future_status status = fut.wait_for(std::chrono::seconds(MAX_TIMEOUT_SEC));
-    if (status == future_status::timeout) {
-        POWER_HILOGW(FEATURE_SHUTDOWN, "Shutdown callback execution timeout");
-    }
-    POWER_KHILOGI(FEATURE_SHUTDOWN, "The callback execution is complete");
+void ShutdownController::DumpInfo(std::string& result) const
+{
+    result.append(lastShutdownReport_.empty() ? "LAST SHUTDOWN: none\n" : lastShutdownReport_);
 }
 
 void ShutdownController::PublishShutdownEvent() const
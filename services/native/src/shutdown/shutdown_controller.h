@@ -21,6 +21,8 @@
 #include "power_errors.h"
 #include "want.h"
 #include <atomic>
+#include <future>
+#include <memory>
 #include <string>
 
 #include "shutdown/iasync_shutdown_callback.h"
@@ -59,11 +61,16 @@ public:
     bool TriggerTakeOverHibernateCallback(const TakeOverInfo& info);
     void TriggerAsyncShutdownCallback(bool isReboot);
     void TriggerSyncShutdownCallback(bool isReboot);
+    // phase costs of the shutdown before this boot
+    void DumpInfo(std::string& result) const;
 
 private:
     using IntentWant = OHOS::AAFwk::Want;
     PowerErrors RebootOrShutdown(const std::string& reason, bool isReboot, bool force = false);
-    void Prepare(bool isReboot);
+    // foregroundDone is set once the shutdown event is published, the sync callbacks returned and the
+    // screen is off, or their budgets ran out
+    void RunShutdownPhases(
+        const std::string& reason, bool isReboot, const std::shared_ptr<std::promise<void>>& foregroundDone);
     void TurnOffScreen();
     void PublishShutdownEvent() const;
     bool TakeOverShutdownAction(const std::string& reason, bool isReboot);
@@ -87,6 +94,7 @@ private:
     std::atomic<bool> started_;
     std::unique_ptr<IDevicePowerAction> devicePowerAction_;
     std::shared_ptr<IDeviceStateAction> deviceStateAction_;
+    std::string lastShutdownReport_;
 };
 } // namespace PowerMgr
 } // namespace OHOS
@@ -36,7 +36,7 @@
 #include "power_log.h"
 #include "power_mgr_service.h"
 #include "power_vibrator.h"
-#include "sysparam.h"
+#include "sysparam_cache.h"
 
 #ifdef POWER_MANAGER_ENABLE_BLOCK_LONG_PRESS
 #include "setting_helper.h"
@@ -87,7 +87,8 @@ void ShutdownDialog::KeyMonitorInit()
     keyOption->SetPreKeys(preKeys);
     keyOption->SetFinalKey(KeyEvent::KEYCODE_POWER);
     keyOption->SetFinalKeyDown(true);
-    int32_t downDuration = SysParam::GetIntValue(KEY_DOWN_DURATION, LONG_PRESS_DELAY_MS);
+    static IntSysParam downDurationParam(KEY_DOWN_DURATION, LONG_PRESS_DELAY_MS);
+    int32_t downDuration = downDurationParam.Get();
     POWER_HILOGI(FEATURE_SHUTDOWN, "Initialize powerkey down duration %{public}d.", downDuration);
     keyOption->SetFinalKeyDownDuration(downDuration);
     auto inputManager = InputManager::GetInstance();
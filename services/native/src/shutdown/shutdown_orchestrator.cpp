@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "shutdown_orchestrator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <fcntl.h>
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+
+#include "power_log.h"
+
+namespace OHOS {
+namespace PowerMgr {
+ShutdownOrchestrator::ShutdownOrchestrator(int64_t budgetMs)
+    : budgetMs_(budgetMs), context_(std::make_shared<Context>())
+{
+}
+
+const char* ShutdownOrchestrator::GetStateName(PhaseState state)
+{
+    switch (state) {
+        case PhaseState::PENDING:
+            return "pending";
+        case PhaseState::RUNNING:
+            return "running";
+        case PhaseState::DONE:
+            return "done";
+        case PhaseState::TIMEOUT:
+            return "timeout";
+        case PhaseState::SKIPPED:
+            return "skipped";
+        default:
+            return "unknown";
+    }
+}
+
+int64_t ShutdownOrchestrator::GetNowMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int32_t ShutdownOrchestrator::FindPhase(const std::string& name) const
+{
+    for (size_t index = 0; index < context_->phases.size(); index++) {
+        if (context_->phases[index].record.name == name) {
+            return static_cast<int32_t>(index);
+        }
+    }
+    return -1;
+}
+
+bool ShutdownOrchestrator::AddPhase(const std::string& name, const std::vector<std::string>& deps,
+    int64_t budgetMs, const PhaseFunc& func)
+{
+    std::lock_guard lock(context_->mutex);
+    if (func == nullptr || budgetMs <= 0 || budgetMs > budgetMs_ || FindPhase(name) >= 0) {
+        POWER_HILOGE(FEATURE_SHUTDOWN, "invalid shutdown phase %{public}s", name.c_str());
+        return false;
+    }
+    Phase phase;
+    phase.record.name = name;
+    phase.record.budgetMs = budgetMs;
+    phase.func = func;
+    for (const auto& dep : deps) {
+        int32_t index = FindPhase(dep);
+        if (index < 0) {
+            // dependencies must be declared first, which also keeps the graph acyclic
+            POWER_HILOGE(FEATURE_SHUTDOWN, "phase %{public}s depends on unknown phase %{public}s",
+                name.c_str(), dep.c_str());
+            return false;
+        }
+        phase.deps.push_back(static_cast<size_t>(index));
+    }
+    context_->phases.push_back(std::move(phase));
+    return true;
+}
+
+bool ShutdownOrchestrator::IsReady(const Phase& phase) const
+{
+    return std::all_of(phase.deps.begin(), phase.deps.end(), [this](size_t dep) {
+        PhaseState state = context_->phases[dep].record.state;
+        return state != PhaseState::PENDING && state != PhaseState::RUNNING;
+    });
+}
+
+void ShutdownOrchestrator::StartPhase(size_t index, int64_t nowMs)
+{
+    Phase& phase = context_->phases[index];
+    phase.record.state = PhaseState::RUNNING;
+    phase.record.startMs = nowMs - context_->beginMs;
+    std::shared_ptr<Context> context = context_;
+    PhaseFunc func = phase.func;
+    ffrt::submit([context, index, func]() {
+        func();
+        std::lock_guard lock(context->mutex);
+        PhaseRecord& record = context->phases[index].record;
+        // a phase finishing after its budget keeps the TIMEOUT state but reports its real cost
+        record.costMs = GetNowMs() - context->beginMs - record.startMs;
+        if (record.state == PhaseState::RUNNING) {
+            record.state = PhaseState::DONE;
+        }
+        context->cv.notify_all();
+    }, {}, {}, ffrt::task_attr().name(phase.record.name.c_str()));
+}
+
+bool ShutdownOrchestrator::Run()
+{
+    std::unique_lock lock(context_->mutex);
+    context_->beginMs = GetNowMs();
+    int64_t deadlineMs = context_->beginMs + budgetMs_;
+    while (true) {
+        int64_t nowMs = GetNowMs();
+        for (auto& phase : context_->phases) {
+            PhaseRecord& record = phase.record;
+            if (record.state == PhaseState::RUNNING &&
+                nowMs >= context_->beginMs + record.startMs + record.budgetMs) {
+                // the dependents of a timed out phase may start now
+                POWER_KHILOGW(FEATURE_SHUTDOWN, "shutdown phase %{public}s exceeds %{public}" PRId64 "ms",
+                    record.name.c_str(), record.budgetMs);
+                record.state = PhaseState::TIMEOUT;
+            }
+        }
+        int64_t wakeMs = deadlineMs;
+        bool busy = false;
+        for (size_t index = 0; index < context_->phases.size(); index++) {
+            PhaseRecord& record = context_->phases[index].record;
+            if (record.state == PhaseState::PENDING && nowMs < deadlineMs && IsReady(context_->phases[index])) {
+                StartPhase(index, nowMs);
+            }
+            if (record.state == PhaseState::RUNNING) {
+                wakeMs = std::min(wakeMs, context_->beginMs + record.startMs + record.budgetMs);
+            }
+            busy = busy || record.state == PhaseState::PENDING || record.state == PhaseState::RUNNING;
+        }
+        if (!busy) {
+            break;
+        }
+        if (nowMs >= deadlineMs) {
+            for (auto& phase : context_->phases) {
+                if (phase.record.state == PhaseState::PENDING) {
+                    phase.record.state = PhaseState::SKIPPED;
+                } else if (phase.record.state == PhaseState::RUNNING) {
+                    phase.record.state = PhaseState::TIMEOUT;
+                }
+            }
+            POWER_KHILOGW(FEATURE_SHUTDOWN, "shutdown deadline %{public}" PRId64 "ms reached", budgetMs_);
+            break;
+        }
+        context_->cv.wait_for(lock, std::chrono::milliseconds(std::max<int64_t>(wakeMs - nowMs, 1)));
+    }
+    context_->totalCostMs = GetNowMs() - context_->beginMs;
+    bool ret = std::all_of(context_->phases.begin(), context_->phases.end(), [](const Phase& phase) {
+        return phase.record.state == PhaseState::DONE;
+    });
+    POWER_KHILOGI(FEATURE_SHUTDOWN, "%{public}zu shutdown phases finished, ret=%{public}d, cost=%{public}" PRId64
+        "ms", context_->phases.size(), ret, context_->totalCostMs);
+    return ret;
+}
+
+std::vector<ShutdownOrchestrator::PhaseRecord> ShutdownOrchestrator::GetRecords() const
+{
+    std::lock_guard lock(context_->mutex);
+    std::vector<PhaseRecord> records;
+    for (const auto& phase : context_->phases) {
+        records.push_back(phase.record);
+    }
+    return records;
+}
+
+int64_t ShutdownOrchestrator::GetPhaseEndMs(const std::string& name) const
+{
+    std::lock_guard lock(context_->mutex);
+    int32_t index = FindPhase(name);
+    if (index < 0 || context_->phases[index].record.state != PhaseState::DONE) {
+        return -1;
+    }
+    const PhaseRecord& record = context_->phases[index].record;
+    return record.startMs + record.costMs;
+}
+
+int64_t ShutdownOrchestrator::GetTotalCostMs() const
+{
+    std::lock_guard lock(context_->mutex);
+    return context_->totalCostMs;
+}
+
+std::string ShutdownOrchestrator::FormatReport() const
+{
+    std::lock_guard lock(context_->mutex);
+    std::string result;
+    result.append("budget=").append(std::to_string(budgetMs_)).append("ms")
+        .append(" total=").append(std::to_string(context_->totalCostMs)).append("ms\n");
+    for (const auto& phase : context_->phases) {
+        const PhaseRecord& record = phase.record;
+        result.append("  ").append(record.name)
+            .append(" budget=").append(std::to_string(record.budgetMs)).append("ms")
+            .append(" start=").append(std::to_string(record.startMs)).append("ms")
+            .append(" cost=").append(std::to_string(record.costMs)).append("ms")
+            .append(" state=").append(GetStateName(record.state));
+        if (!phase.deps.empty()) {
+            result.append(" deps=");
+            for (size_t index = 0; index < phase.deps.size(); index++) {
+                result.append(index == 0 ? "" : ",").append(context_->phases[phase.deps[index]].record.name);
+            }
+        }
+        result.append("\n");
+    }
+    return result;
+}
+
+bool ShutdownOrchestrator::SaveReport(const std::string& path, const std::string& report)
+{
+    // write aside and rename, a power cut never leaves a half written report
+    std::string tmpPath = path + ".tmp";
+    int fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        POWER_HILOGE(FEATURE_SHUTDOWN, "open shutdown report failed");
+        return false;
+    }
+    bool ret = write(fd, report.data(), report.size()) == static_cast<ssize_t>(report.size()) && fsync(fd) == 0;
+    close(fd);
+    if (!ret || rename(tmpPath.c_str(), path.c_str()) != 0) {
+        POWER_HILOGE(FEATURE_SHUTDOWN, "write shutdown report failed");
+        unlink(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+std::string ShutdownOrchestrator::LoadReport(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return "";
+    }
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+} // namespace PowerMgr
+} // namespace OHOS
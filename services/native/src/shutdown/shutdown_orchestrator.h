@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_SHUTDOWN_ORCHESTRATOR_H
+#define POWERMGR_SHUTDOWN_ORCHESTRATOR_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ffrt.h"
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Runs the phases of a shutdown or reboot as a dependency graph under one deadline. Phases without
+ * a dependency path between them run concurrently on FFRT. A phase that overruns its own budget no
+ * longer holds back the phases depending on it, and once the deadline passes Run returns whatever
+ * is still running, so the device power action is never delayed past the deadline.
+ */
+class ShutdownOrchestrator {
+public:
+    using PhaseFunc = std::function<void()>;
+    enum class PhaseState : uint32_t {
+        PENDING = 0,
+        RUNNING,
+        DONE,
+        TIMEOUT,
+        SKIPPED
+    };
+    struct PhaseRecord {
+        std::string name;
+        int64_t budgetMs {0};
+        // relative to the start of Run, -1 if the phase never started
+        int64_t startMs {-1};
+        int64_t costMs {-1};
+        PhaseState state {PhaseState::PENDING};
+    };
+
+    explicit ShutdownOrchestrator(int64_t budgetMs);
+    ~ShutdownOrchestrator() = default;
+
+    static const char* GetStateName(PhaseState state);
+    static int64_t GetNowMs();
+
+    /**
+     * Add a phase. Every dependency must have been added before.
+     *
+     * @return false if the name is duplicated, a dependency is unknown or the budget exceeds the deadline.
+     */
+    bool AddPhase(const std::string& name, const std::vector<std::string>& deps, int64_t budgetMs,
+        const PhaseFunc& func);
+    /**
+     * Run the phases, blocking until all of them finished or the deadline passed.
+     *
+     * @return true if every phase finished within its budget.
+     */
+    bool Run();
+    std::vector<PhaseRecord> GetRecords() const;
+    // -1 if the phase is unknown or did not finish in time
+    int64_t GetPhaseEndMs(const std::string& name) const;
+    int64_t GetTotalCostMs() const;
+    std::string FormatReport() const;
+
+    // write the report so that it survives the reboot, replacing the previous one
+    static bool SaveReport(const std::string& path, const std::string& report);
+    static std::string LoadReport(const std::string& path);
+
+private:
+    struct Phase {
+        PhaseRecord record;
+        std::vector<size_t> deps;
+        PhaseFunc func;
+    };
+    // shared with the phase tasks, which may outlive Run when they overrun the deadline
+    struct Context {
+        ffrt::mutex mutex;
+        ffrt::condition_variable cv;
+        std::vector<Phase> phases;
+        int64_t beginMs {0};
+        int64_t totalCostMs {0};
+    };
+    int32_t FindPhase(const std::string& name) const;
+    bool IsReady(const Phase& phase) const;
+    void StartPhase(size_t index, int64_t nowMs);
+
+    const int64_t budgetMs_;
+    std::shared_ptr<Context> context_;
+};
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWERMGR_SHUTDOWN_ORCHESTRATOR_H
@@ -27,8 +27,10 @@
 #ifdef POWER_MANAGER_ENABLE_EXTERNAL_SCREEN_MANAGEMENT
 #include <screen_manager_lite.h>
 #endif
+#include "power_clock.h"
 #include "power_log.h"
 #include "power_mgr_service.h"
+#include "power_profile_loader.h"
 #include "power_state_callback_stub.h"
 #include "power_utils.h"
 #include "setting_helper.h"
@@ -42,12 +44,12 @@ namespace {
 #ifdef POWER_MANAGER_ENABLE_CHARGING_TYPE_SETTING
 sptr<SettingObserver> g_suspendSourcesKeyAcObserver = nullptr;
 sptr<SettingObserver> g_suspendSourcesKeyDcObserver = nullptr;
-constexpr int64_t POWER_SLEEP_DEFAULT_TIME = 60000; // ms
-constexpr int64_t POWER_SLEEP_NEVER = -1;
-constexpr int64_t POWER_SLEEP_NOW = 0;
+constexpr int64_t POWER_SLEEP_NEVER = SuspendPolicy::SLEEP_NEVER;
+constexpr int64_t POWER_SLEEP_NOW = SuspendPolicy::SLEEP_NOW;
 #else
 sptr<SettingObserver> g_suspendSourcesKeyObserver = nullptr;
 #endif
+std::vector<sptr<SettingObserver>> g_suspendPolicyObservers;
 FFRTMutex g_monitorMutex;
 constexpr int64_t POWERKEY_MIN_INTERVAL = 350; // ms
 constexpr int32_t RETRY_COUNT_TIMES = 4;
@@ -145,10 +147,10 @@ void SuspendController::TriggerSyncSleepCallbackInner(
     for (auto &callback : callbacks) {
         auto pidUid = SleepCallbackHolder::GetInstance().FindCallbackPidUid(callback);
         if (callback != nullptr) {
-            int64_t start = GetTickCount();
+            int64_t start = PowerClock::GetTickCount();
             POWER_HILOGI(FEATURE_SUSPEND, "Sync Sleep Callback, pid=%{public}d", pidUid.first);
             isWakeup ? callback->OnSyncWakeup(onForceSleep) : callback->OnSyncSleep(onForceSleep);
-            int64_t cost = GetTickCount() - start;
+            int64_t cost = PowerClock::GetTickCount() - start;
             POWER_HILOGI(FEATURE_SUSPEND,
                 "Trigger %{public}s SyncSleepCb[%{public}u] success,P=%{public}dU=%{public}dT=%{public}" PRId64,
                 priority.c_str(), ++id, pidUid.first, pidUid.second, cost);
@@ -188,9 +190,9 @@ bool SuspendController::TriggerTakeOverSuspendCallbackInner(
             continue;
         }
         auto pidUid = TakeOverSuspendCallbackHolder::GetInstance().FindCallbackPidUid(callback);
-        int64_t start = GetTickCount();
+        int64_t start = PowerClock::GetTickCount();
         isTakeover = isTakeover || callback->OnTakeOverSuspend(type);
-        int64_t count = GetTickCount() - start;
+        int64_t count = PowerClock::GetTickCount() - start;
         POWER_HILOGI(FEATURE_SUSPEND,
             "Trigger %{public}s takeovercb [%{public}u] success, P=%{public}d U=%{public}d T=%{public}" PRId64,
             priority.c_str(), ++id, pidUid.first, pidUid.second, count);
@@ -223,7 +225,7 @@ private:
 void SuspendController::Init()
 {
     std::lock_guard lock(mutex_);
-    std::shared_ptr<SuspendSources> sources = SuspendSourceParser::ParseSources();
+    std::shared_ptr<SuspendSources> sources = PowerProfileLoader::GetInstance().GetSuspendSources();
     sourceList_ = sources->GetSourceList();
     if (sourceList_.empty()) {
         POWER_HILOGE(FEATURE_SUSPEND, "InputManager is null");
@@ -291,37 +293,16 @@ void SuspendController::ExecSuspendMonitorByReason(SuspendDeviceType reason)
 void SuspendController::UpdateSuspendSources()
 {
     POWER_HILOGI(COMP_SVC, "start setting string update");
-    std::lock_guard lock(mutex_);
-
-    auto pms = DelayedSpSingleton<PowerMgrService>::GetInstance();
-    if (pms == nullptr) {
-        POWER_HILOGE(COMP_SVC, "get PowerMgrService fail");
-        return;
-    }
-    std::string jsonStr;
-#ifdef POWER_MANAGER_ENABLE_CHARGING_TYPE_SETTING
-    if (pms->IsPowerConnected()) {
-        jsonStr = SettingHelper::GetSettingAcSuspendSources();
-    } else {
-        jsonStr = SettingHelper::GetSettingDcSuspendSources();
-    }
-#else
-    jsonStr = SettingHelper::GetSettingSuspendSources();
-#endif
-    std::shared_ptr<SuspendSources> sources = SuspendSourceParser::ParseSources(jsonStr);
-    if (sources->GetParseErrorFlag()) {
-        POWER_HILOGI(FEATURE_SUSPEND, "Parse failed, call GetSuspendSourcesByConfig again");
-        jsonStr = SuspendSourceParser::GetSuspendSourcesByConfig();
-        sources = SuspendSourceParser::ParseSources(jsonStr);
-    }
+    // parse before taking mutex_, only the monitor switch runs under the lock
+    std::shared_ptr<SuspendSources> sources = PowerProfileLoader::GetInstance().ReloadSuspendSources();
     if (sources == nullptr) {
-        POWER_HILOGE(COMP_SVC, "get SuspendSources fail");
         return;
     }
     std::vector<SuspendSource> updateSourceList = sources->GetSourceList();
     if (updateSourceList.size() == 0) {
         return;
     }
+    std::lock_guard lock(mutex_);
     sourceList_ = updateSourceList;
     POWER_HILOGI(COMP_SVC, "start updateListener");
     Cancel();
@@ -341,6 +322,36 @@ void SuspendController::UpdateSuspendSources()
     }
 }
 
+void SuspendController::UpdateSuspendPolicy()
+{
+    bool powerConnected = false;
+#ifdef POWER_MANAGER_ENABLE_CHARGING_TYPE_SETTING
+    auto pms = DelayedSpSingleton<PowerMgrService>::GetInstance();
+    if (pms != nullptr) {
+        powerConnected = pms->IsPowerConnected();
+    }
+    int64_t acDisplayOffTime = SettingHelper::GetSettingDisplayAcScreenOffTime(SuspendPolicy::DEFAULT_TIME_MS);
+    int64_t dcDisplayOffTime = SettingHelper::GetSettingDisplayDcScreenOffTime(SuspendPolicy::DEFAULT_TIME_MS);
+    int64_t acSleepTime = SettingHelper::GetSettingPowerAcSleepTime(SuspendPolicy::DEFAULT_TIME_MS);
+    int64_t dcSleepTime = SettingHelper::GetSettingPowerDcSleepTime(SuspendPolicy::DEFAULT_TIME_MS);
+#else
+    int64_t acDisplayOffTime = SettingHelper::GetSettingDisplayOffTime(SuspendPolicy::DEFAULT_TIME_MS);
+    int64_t dcDisplayOffTime = acDisplayOffTime;
+    int64_t acSleepTime = SuspendPolicy::DEFAULT_TIME_MS;
+    int64_t dcSleepTime = SuspendPolicy::DEFAULT_TIME_MS;
+#endif
+    policySnapshot_.Update([&](SuspendPolicy& policy) {
+        policy.powerConnected = powerConnected;
+        policy.acDisplayOffTime = acDisplayOffTime;
+        policy.dcDisplayOffTime = dcDisplayOffTime;
+        policy.acSleepTime = acSleepTime;
+        policy.dcSleepTime = dcSleepTime;
+    });
+    POWER_HILOGI(FEATURE_SUSPEND, "suspend policy updated, connected=%{public}d, displayOffTime=%{public}" PRId64
+        "/%{public}" PRId64 ", sleepTime=%{public}" PRId64 "/%{public}" PRId64, powerConnected, acDisplayOffTime,
+        dcDisplayOffTime, acSleepTime, dcSleepTime);
+}
+
 void SuspendController::RegisterSettingsObserver()
 {
 #ifdef POWER_MANAGER_ENABLE_CHARGING_TYPE_SETTING
@@ -364,6 +375,25 @@ void SuspendController::RegisterSettingsObserver()
 #else
     g_suspendSourcesKeyObserver = SettingHelper::RegisterSettingSuspendSourcesObserver(updateFunc);
 #endif
+    SettingObserver::UpdateFunc policyFunc = [this](const std::string&) {
+        UpdateSuspendPolicy();
+    };
+#ifdef POWER_MANAGER_ENABLE_CHARGING_TYPE_SETTING
+    std::vector<sptr<SettingObserver>> policyObservers = {
+        SettingHelper::RegisterSettingDisplayAcScreenOffTimeObserver(policyFunc),
+        SettingHelper::RegisterSettingDisplayDcScreenOffTimeObserver(policyFunc),
+        SettingHelper::RegisterSettingPowerAcSleepTimeObserver(policyFunc),
+        SettingHelper::RegisterSettingPowerDcSleepTimeObserver(policyFunc)};
+#else
+    std::vector<sptr<SettingObserver>> policyObservers = {
+        SettingHelper::RegisterSettingDisplayOffTimeObserver(policyFunc)};
+#endif
+    for (const auto& observer : policyObservers) {
+        if (observer != nullptr) {
+            g_suspendPolicyObservers.push_back(observer);
+        }
+    }
+    UpdateSuspendPolicy();
     POWER_HILOGI(FEATURE_POWER_STATE, "register setting observer fin");
 }
 
@@ -384,6 +414,10 @@ void SuspendController::UnregisterSettingsObserver()
         g_suspendSourcesKeyObserver = nullptr;
     }
 #endif
+    for (auto& observer : g_suspendPolicyObservers) {
+        SettingHelper::UnregisterSettingObserver(observer);
+    }
+    g_suspendPolicyObservers.clear();
 }
 
 void SuspendController::Execute()
@@ -679,7 +713,7 @@ void SuspendController::ProcessPowerOffInternalScreenOnly(const sptr<PowerMgrSer
     POWER_HILOGI(
         FEATURE_SUSPEND, "[UL_POWER] Power off internal screen when closing switch is configured as no operation");
     PowerOffInternalScreen(reason);
-    pms->RefreshActivity(GetTickCount(), UserActivityType::USER_ACTIVITY_TYPE_SWITCH, false);
+    pms->RefreshActivity(PowerClock::GetTickCount(), UserActivityType::USER_ACTIVITY_TYPE_SWITCH, false);
 }
 #endif
 
@@ -692,7 +726,7 @@ void SuspendController::StartSleepTimer(SuspendDeviceType reason, uint32_t actio
         }
     }
 
-    int64_t tick = GetTickCount();
+    int64_t tick = PowerClock::GetTickCount();
     int64_t timeout = tick + static_cast<int64_t>(delay);
     if (timeout < tick) {
         POWER_HILOGE(FEATURE_SUSPEND, "Sleep timer overflow with tick = %{public}s, delay = %{public}u",
@@ -749,47 +783,14 @@ void SuspendController::HandleAction(SuspendDeviceType reason, uint32_t action)
 }
 
 #ifdef POWER_MANAGER_ENABLE_CHARGING_TYPE_SETTING
-int64_t SuspendController::GetSettingPowerSleepTime(int64_t defaultTime)
-{
-    int64_t settingTime = defaultTime;
-    auto pms = DelayedSpSingleton<PowerMgrService>::GetInstance();
-    if (pms == nullptr) {
-        POWER_HILOGE(FEATURE_POWER_MODE, "get PowerMgrService fail");
-        return settingTime;
-    }
-    if (pms->IsPowerConnected()) {
-        settingTime = SettingHelper::GetSettingPowerAcSleepTime(defaultTime);
-    } else {
-        settingTime = SettingHelper::GetSettingPowerDcSleepTime(defaultTime);
-    }
-    return settingTime;
-}
-
 int64_t SuspendController::CalculateAutoSleepResult(SuspendDeviceType reason)
 {
-    int64_t displayOffTime = 0;
-    int64_t powerSleepTime = 0;
-    auto pms = DelayedSpSingleton<PowerMgrService>::GetInstance();
-    if (pms != nullptr) {
-        displayOffTime = pms->GetSettingDisplayOffTime(POWER_SLEEP_DEFAULT_TIME);
-    }
-    powerSleepTime = GetSettingPowerSleepTime(POWER_SLEEP_DEFAULT_TIME);
-    POWER_HILOGI(FEATURE_SUSPEND, "%{public}s: displayOffTime(%{public}ld), powerSleepTime(%{public}ld)",
-        __func__, displayOffTime, powerSleepTime);
-    if (powerSleepTime == POWER_SLEEP_NEVER) {
-        return POWER_SLEEP_NEVER;
-    }
-    if (reason == SuspendDeviceType::SUSPEND_DEVICE_REASON_POWER_KEY ||
-        reason == SuspendDeviceType::SUSPEND_DEVICE_REASON_SWITCH ||
-        reason == SuspendDeviceType::SUSPEND_DEVICE_REASON_LID) {
-        POWER_HILOGI(FEATURE_SUSPEND, "%{public}s: powerSleepTime without displayOffTime reason(%{public}d)",
-            __func__, reason);
-        return powerSleepTime;
-    }
-    if (powerSleepTime <= displayOffTime) {
-        return POWER_SLEEP_NOW;
-    }
-    return powerSleepTime - displayOffTime;
+    std::shared_ptr<const SuspendPolicy> policy = policySnapshot_.Get();
+    int64_t result = policy->CalculateAutoSleepResult(reason);
+    POWER_HILOGI_LIMITED(FEATURE_SUSPEND, "%{public}s: displayOffTime(%{public}" PRId64 "), powerSleepTime(%{public}"
+        PRId64 "), reason(%{public}d), result(%{public}" PRId64 ")", __func__, policy->GetDisplayOffTime(),
+        policy->GetSleepTime(), reason, result);
+    return result;
 }
 #endif
 
@@ -828,15 +829,29 @@ void SuspendController::SetAutoSleep(SuspendDeviceType reason)
         POWER_HILOGE(FEATURE_SUSPEND, "Can't get PowerStateMachine");
         return;
     }
+    uint64_t cycleId = suspendTrace_.Begin(reason, false);
+    SystemSuspendController::GetInstance().PrepareSuspend();
+    int64_t beginUs = SuspendEntryTrace::GetNowUs();
     bool ret = stateMachine_->SetState(
         PowerState::SLEEP, stateMachine_->GetReasonBySuspendType(reason));
+    int64_t stateUs = SuspendEntryTrace::GetNowUs();
+    suspendTrace_.Record(cycleId, SuspendEntryTrace::Phase::STATE_CHANGE, stateUs - beginUs);
     if (ret && stateMachine_->GetState() == PowerState::SLEEP) {
         POWER_HILOGI(FEATURE_SUSPEND, "State changed, set sleep timer");
         TriggerSyncSleepCallback(false);
+        int64_t callbackUs = SuspendEntryTrace::GetNowUs();
+        suspendTrace_.Record(cycleId, SuspendEntryTrace::Phase::CALLBACKS, callbackUs - stateUs);
         SystemSuspendController::GetInstance().Suspend([]() {}, []() {}, false);
+        suspendTrace_.Record(cycleId, SuspendEntryTrace::Phase::HDI_CALL, SuspendEntryTrace::GetNowUs() - callbackUs);
     } else {
         POWER_HILOGI(FEATURE_SUSPEND, "auto suspend: State change failed");
     }
+    suspendTrace_.End(cycleId);
+}
+
+void SuspendController::DumpSuspendEntry(std::string& result) const
+{
+    suspendTrace_.DumpInfo(result);
 }
 
 void SuspendController::HandleForceSleep(SuspendDeviceType reason)
@@ -856,19 +871,30 @@ void SuspendController::HandleForceSleep(SuspendDeviceType reason)
         POWER_HILOGE(FEATURE_SUSPEND, "Failed to set flag of force sleeping, pms or suspendController is nullptr");
     }
 #endif
+    uint64_t cycleId = suspendTrace_.Begin(reason, true);
+    int64_t beginUs = SuspendEntryTrace::GetNowUs();
     bool ret = stateMachine_->SetState(PowerState::SLEEP,
         stateMachine_->GetReasonBySuspendType(reason), true);
+    int64_t stateUs = SuspendEntryTrace::GetNowUs();
+    suspendTrace_.Record(cycleId, SuspendEntryTrace::Phase::STATE_CHANGE, stateUs - beginUs);
     if (ret) {
         POWER_HILOGI(FEATURE_SUSPEND, "State changed, system suspend");
         onForceSleep = true;
         TriggerSyncSleepCallback(false);
+        suspendTrace_.Record(cycleId, SuspendEntryTrace::Phase::CALLBACKS, SuspendEntryTrace::GetNowUs() - stateUs);
+        // the HDI call is delayed, get it ready in the meantime
+        SystemSuspendController::GetInstance().PrepareSuspend();
 
-        FFRTTask task = [this, reason] {
+        FFRTTask task = [this, reason, cycleId] {
             if (stateMachine_->GetState() == PowerState::SLEEP) {
+                int64_t hdiBeginUs = SuspendEntryTrace::GetNowUs();
                 SystemSuspendController::GetInstance().Suspend([]() {}, []() {}, true);
+                suspendTrace_.Record(cycleId, SuspendEntryTrace::Phase::HDI_CALL,
+                    SuspendEntryTrace::GetNowUs() - hdiBeginUs);
             } else {
                 POWER_HILOGE(FEATURE_SUSPEND, "Don't suspend, power state is not sleep");
             }
+            suspendTrace_.End(cycleId);
         };
         if (ffrtTimer_ != nullptr) {
             ffrtTimer_->SetTimer(TIMER_ID_SLEEP, task, FORCE_SLEEP_DELAY_MS);
@@ -878,6 +904,7 @@ void SuspendController::HandleForceSleep(SuspendDeviceType reason)
         }
     } else {
         POWER_HILOGI(FEATURE_SUSPEND, "force suspend: State change failed");
+        suspendTrace_.End(cycleId);
     }
 }
 
@@ -1064,7 +1091,7 @@ void PowerKeySuspendMonitor::ReceivePowerkeyCallback(std::shared_ptr<OHOS::MMI::
 #endif
 
     static int64_t lastPowerkeyUpTime = 0;
-    int64_t currTime = GetTickCount();
+    int64_t currTime = PowerClock::GetTickCount();
     if (lastPowerkeyUpTime != 0 && currTime - lastPowerkeyUpTime < POWERKEY_MIN_INTERVAL) {
         POWER_HILOGI(FEATURE_WAKEUP, "[UL_POWER] Last powerkey up within %{public}" PRId64 "ms, skip. "
             "%{public}" PRId64 ", %{public}" PRId64, POWERKEY_MIN_INTERVAL, currTime, lastPowerkeyUpTime);
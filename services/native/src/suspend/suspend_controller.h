@@ -28,6 +28,8 @@
 #include "sensor_agent.h"
 #endif
 #include "shutdown_controller.h"
+#include "suspend_entry_trace.h"
+#include "suspend_policy.h"
 #include "suspend_source_parser.h"
 #include "suspend_sources.h"
 #include "sleep_callback_holder.h"
@@ -71,6 +73,7 @@ public:
     void RemoveCallback(const sptr<ISyncSleepCallback>& callback);
     void TriggerSyncSleepCallback(bool isWakeup);
     void UpdateSuspendSources();
+    void UpdateSuspendPolicy();
 
     std::shared_ptr<PowerStateMachine> GetStateMachine() const
     {
@@ -91,6 +94,7 @@ public:
 #endif
     void StartSleepTimer(SuspendDeviceType reason, uint32_t action, uint32_t delay);
     void Reset();
+    void DumpSuspendEntry(std::string& result) const;
 
 #ifdef POWER_MANAGER_ENABLE_FORCE_SLEEP_BROADCAST
     void SetForceSleepingFlag(bool isForceSleeping)
@@ -117,7 +121,6 @@ private:
     void ControlListener(SuspendDeviceType reason, uint32_t action, uint32_t delay);
     void ControlListenerInner(SuspendDeviceType reason, uint32_t action, uint32_t delay);
 #ifdef POWER_MANAGER_ENABLE_CHARGING_TYPE_SETTING
-    int64_t GetSettingPowerSleepTime(int64_t defaultTime);
     int64_t CalculateAutoSleepResult(SuspendDeviceType reason);
 #endif
     void HandleAutoSleep(SuspendDeviceType reason);
@@ -142,6 +145,8 @@ private:
     void SuspendWhenStateSleep(SuspendDeviceType reason, uint32_t action);
     bool CheckDuringCall(const sptr<PowerMgrService>& pms, SuspendDeviceType reason);
     std::vector<SuspendSource> sourceList_;
+    SuspendPolicySnapshot policySnapshot_;
+    SuspendEntryTrace suspendTrace_;
     std::map<SuspendDeviceType, std::shared_ptr<SuspendMonitor>> monitorMap_;
     std::shared_ptr<ShutdownController> shutdownController_;
     std::shared_ptr<PowerStateMachine> stateMachine_;
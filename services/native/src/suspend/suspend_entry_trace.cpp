@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "suspend_entry_trace.h"
+
+namespace OHOS {
+namespace PowerMgr {
+const char* SuspendEntryTrace::GetPhaseName(Phase phase)
+{
+    switch (phase) {
+        case Phase::STATE_CHANGE:
+            return "state";
+        case Phase::CALLBACKS:
+            return "callbacks";
+        case Phase::HDI_CALL:
+            return "hdi";
+        default:
+            return "unknown";
+    }
+}
+
+uint64_t SuspendEntryTrace::Begin(SuspendDeviceType reason, bool force)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cycles_.size() >= MAX_CYCLE_NUM) {
+        cycles_.pop_front();
+    }
+    Cycle cycle;
+    cycle.id = nextId_++;
+    cycle.reason = reason;
+    cycle.force = force;
+    cycles_.push_back(cycle);
+    return cycle.id;
+}
+
+SuspendEntryTrace::Cycle* SuspendEntryTrace::FindLocked(uint64_t id)
+{
+    for (auto iter = cycles_.rbegin(); iter != cycles_.rend(); iter++) {
+        if (iter->id == id) {
+            return &(*iter);
+        }
+    }
+    return nullptr;
+}
+
+void SuspendEntryTrace::Record(uint64_t id, Phase phase, int64_t costUs)
+{
+    if (phase >= Phase::BUTT) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    Cycle* cycle = FindLocked(id);
+    if (cycle != nullptr) {
+        cycle->costUs[static_cast<uint32_t>(phase)] = costUs;
+    }
+}
+
+void SuspendEntryTrace::End(uint64_t id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    Cycle* cycle = FindLocked(id);
+    if (cycle != nullptr) {
+        cycle->completed = true;
+    }
+}
+
+std::vector<SuspendEntryTrace::Cycle> SuspendEntryTrace::GetCycles() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::vector<Cycle>(cycles_.begin(), cycles_.end());
+}
+
+void SuspendEntryTrace::DumpInfo(std::string& result) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    result.append("SUSPEND ENTRY: cycles=").append(std::to_string(cycles_.size())).append("\n");
+    for (const auto& cycle : cycles_) {
+        int64_t totalUs = 0;
+        result.append("  #").append(std::to_string(cycle.id))
+            .append(" reason=").append(std::to_string(static_cast<uint32_t>(cycle.reason)))
+            .append(" force=").append(cycle.force ? "true" : "false");
+        for (uint32_t phase = 0; phase < static_cast<uint32_t>(Phase::BUTT); phase++) {
+            totalUs += cycle.costUs[phase];
+            result.append(" ").append(GetPhaseName(static_cast<Phase>(phase)))
+                .append("=").append(std::to_string(cycle.costUs[phase])).append("us");
+        }
+        result.append(" total=").append(std::to_string(totalUs)).append("us")
+            .append(" state=").append(cycle.completed ? "done" : "pending").append("\n");
+    }
+}
+} // namespace PowerMgr
+} // namespace OHOS
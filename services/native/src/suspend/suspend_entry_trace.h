@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_SUSPEND_ENTRY_TRACE_H
+#define POWERMGR_SUSPEND_ENTRY_TRACE_H
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "power_state_machine_info.h"
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Cost of each phase between the decision to suspend and the HDI suspend call, kept for the most
+ * recent suspend cycles and shown by hidumper.
+ */
+class SuspendEntryTrace {
+public:
+    enum class Phase : uint32_t {
+        STATE_CHANGE = 0,
+        CALLBACKS,
+        HDI_CALL,
+        BUTT
+    };
+    struct Cycle {
+        uint64_t id {0};
+        SuspendDeviceType reason {SuspendDeviceType::SUSPEND_DEVICE_REASON_APPLICATION};
+        bool force {false};
+        bool completed {false};
+        int64_t costUs[static_cast<uint32_t>(Phase::BUTT)] {};
+    };
+    static constexpr size_t MAX_CYCLE_NUM = 16;
+
+    static int64_t GetNowUs()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+    static const char* GetPhaseName(Phase phase);
+
+    // start a new cycle, the oldest one is dropped once MAX_CYCLE_NUM are kept
+    uint64_t Begin(SuspendDeviceType reason, bool force);
+    void Record(uint64_t id, Phase phase, int64_t costUs);
+    // the HDI suspend call was made, or the cycle stopped before it
+    void End(uint64_t id);
+    std::vector<Cycle> GetCycles() const;
+    void DumpInfo(std::string& result) const;
+
+private:
+    Cycle* FindLocked(uint64_t id);
+
+    mutable std::mutex mutex_;
+    std::deque<Cycle> cycles_;
+    uint64_t nextId_ {1};
+};
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWERMGR_SUSPEND_ENTRY_TRACE_H
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "suspend_policy.h"
+
+namespace OHOS {
+namespace PowerMgr {
+int64_t SuspendPolicy::CalculateAutoSleepResult(SuspendDeviceType reason) const
+{
+    int64_t sleepTime = GetSleepTime();
+    if (sleepTime == SLEEP_NEVER) {
+        return SLEEP_NEVER;
+    }
+    // the display is turned off by the event itself, the sleep timeout starts right away
+    if (reason == SuspendDeviceType::SUSPEND_DEVICE_REASON_POWER_KEY ||
+        reason == SuspendDeviceType::SUSPEND_DEVICE_REASON_SWITCH ||
+        reason == SuspendDeviceType::SUSPEND_DEVICE_REASON_LID) {
+        return sleepTime;
+    }
+    int64_t displayOffTime = GetDisplayOffTime();
+    if (sleepTime <= displayOffTime) {
+        return SLEEP_NOW;
+    }
+    return sleepTime - displayOffTime;
+}
+
+void SuspendPolicySnapshot::Update(const std::function<void(SuspendPolicy&)>& updater)
+{
+    if (updater == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto policy = std::make_shared<SuspendPolicy>(*policy_);
+    updater(*policy);
+    std::atomic_store(&policy_, std::shared_ptr<const SuspendPolicy>(std::move(policy)));
+}
+} // namespace PowerMgr
+} // namespace OHOS
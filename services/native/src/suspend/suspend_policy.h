@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_SUSPEND_POLICY_H
+#define POWERMGR_SUSPEND_POLICY_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "suspend_sources.h"
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Settings the suspend decision depends on. The values are copied out of DataShare by the setting
+ * observers, so deciding whether to sleep does not read any setting.
+ */
+struct SuspendPolicy {
+    static constexpr int64_t DEFAULT_TIME_MS = 60000;
+    static constexpr int64_t SLEEP_NEVER = -1;
+    static constexpr int64_t SLEEP_NOW = 0;
+
+    bool powerConnected {false};
+    int64_t acDisplayOffTime {DEFAULT_TIME_MS};
+    int64_t dcDisplayOffTime {DEFAULT_TIME_MS};
+    int64_t acSleepTime {DEFAULT_TIME_MS};
+    int64_t dcSleepTime {DEFAULT_TIME_MS};
+
+    int64_t GetDisplayOffTime() const
+    {
+        return powerConnected ? acDisplayOffTime : dcDisplayOffTime;
+    }
+    int64_t GetSleepTime() const
+    {
+        return powerConnected ? acSleepTime : dcSleepTime;
+    }
+    // delay before auto sleep once the display is off, SLEEP_NEVER or SLEEP_NOW
+    int64_t CalculateAutoSleepResult(SuspendDeviceType reason) const;
+};
+
+/**
+ * Copy-on-write holder of the current SuspendPolicy. Readers take a reference to an immutable
+ * policy, writers publish a modified copy.
+ */
+class SuspendPolicySnapshot {
+public:
+    SuspendPolicySnapshot() : policy_(std::make_shared<const SuspendPolicy>()) {}
+    ~SuspendPolicySnapshot() = default;
+
+    std::shared_ptr<const SuspendPolicy> Get() const
+    {
+        return std::atomic_load(&policy_);
+    }
+    void Update(const std::function<void(SuspendPolicy&)>& updater);
+
+private:
+    mutable std::mutex mutex_;
+    std::shared_ptr<const SuspendPolicy> policy_;
+};
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWERMGR_SUSPEND_POLICY_H
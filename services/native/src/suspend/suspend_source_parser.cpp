@@ -40,6 +40,13 @@ static const uint32_t ILLEGAL_ACTION = static_cast<uint32_t>(SuspendAction::ACTI
 
 #ifdef POWER_MANAGER_ENABLE_CHARGING_TYPE_SETTING
 std::shared_ptr<SuspendSources> SuspendSourceParser::ParseSources()
+{
+    return ParseSourcesBySetting(SettingHelper::GetSettingAcSuspendSources(),
+        SettingHelper::GetSettingDcSuspendSources());
+}
+
+std::shared_ptr<SuspendSources> SuspendSourceParser::ParseSourcesBySetting(
+    const std::string& acSettingStr, const std::string& dcSettingStr)
 {
     std::shared_ptr<SuspendSources> parseSources{nullptr};
     auto pms = DelayedSpSingleton<PowerMgrService>::GetInstance();
@@ -48,8 +55,8 @@ std::shared_ptr<SuspendSources> SuspendSourceParser::ParseSources()
         return parseSources;
     }
     bool isPowerConnected = pms->IsPowerConnected();
-    bool isSettingAcValid = SettingHelper::IsSettingAcSuspendSourcesValid();
-    bool isSettingDcValid = SettingHelper::IsSettingDcSuspendSourcesValid();
+    bool isSettingAcValid = !acSettingStr.empty();
+    bool isSettingDcValid = !dcSettingStr.empty();
     std::string configJsonStr;
 
     if (!isSettingAcValid || !isSettingDcValid) {
@@ -65,9 +72,9 @@ std::shared_ptr<SuspendSources> SuspendSourceParser::ParseSources()
     }
 
     if (isPowerConnected && isSettingAcValid) {
-        configJsonStr = SettingHelper::GetSettingAcSuspendSources();
+        configJsonStr = acSettingStr;
     } else if (!isPowerConnected && isSettingDcValid) {
-        configJsonStr = SettingHelper::GetSettingDcSuspendSources();
+        configJsonStr = dcSettingStr;
     }
 
     parseSources = ParseSources(configJsonStr);
@@ -80,13 +87,17 @@ std::shared_ptr<SuspendSources> SuspendSourceParser::ParseSources()
 }
 #else
 std::shared_ptr<SuspendSources> SuspendSourceParser::ParseSources()
+{
+    return ParseSourcesBySetting(SettingHelper::GetSettingSuspendSources());
+}
+
+std::shared_ptr<SuspendSources> SuspendSourceParser::ParseSourcesBySetting(const std::string& sourcesSettingStr)
 {
     std::shared_ptr<SuspendSources> parseSources{nullptr};
-    bool isSettingUpdated = SettingHelper::IsSuspendSourcesSettingValid();
+    bool isSettingUpdated = !sourcesSettingStr.empty();
     POWER_HILOGI(FEATURE_SUSPEND, "ParseSources setting=%{public}d", isSettingUpdated);
     std::string configJsonStr;
     if (isSettingUpdated) {
-        std::string sourcesSettingStr = SettingHelper::GetSettingSuspendSources();
         configJsonStr = sourcesSettingStr;
 #ifdef POWER_MANAGER_ENABLE_WATCH_UPDATE_ADAPT
         // this branch means use config file for update scene in watch
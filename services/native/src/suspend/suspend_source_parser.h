@@ -28,6 +28,15 @@ class SuspendSourceParser {
 public:
     static std::shared_ptr<SuspendSources> ParseSources();
     static std::shared_ptr<SuspendSources> ParseSources(const std::string& config);
+    /**
+     * Parse with already fetched setting values, empty means no override.
+     */
+#ifdef POWER_MANAGER_ENABLE_CHARGING_TYPE_SETTING
+    static std::shared_ptr<SuspendSources> ParseSourcesBySetting(
+        const std::string& acSettingStr, const std::string& dcSettingStr);
+#else
+    static std::shared_ptr<SuspendSources> ParseSourcesBySetting(const std::string& sourcesSettingStr);
+#endif
     static bool GetTargetPath(std::string& targetPath);
     static bool ParseSourcesProc(
         std::shared_ptr<SuspendSources> &parseSources,  cJSON* valueObj, std::string& key);
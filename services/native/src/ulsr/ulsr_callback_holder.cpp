@@ -15,20 +15,70 @@
 
 #include "ulsr_callback_holder.h"
 
+#include <cinttypes>
 #include <datetime_ex.h>
 #include <future>
 #ifdef HAS_HIVIEWDFX_HISYSEVENT_PART
 #include <hisysevent.h>
 #endif
 
-#include "ffrt_utils.h"
 #include "power_common.h"
 #include "power_state_machine_info.h"
+#include "syspara/parameter.h"
 
 namespace OHOS {
 namespace PowerMgr {
 namespace {
 constexpr int32_t ULSR_SYNC_CALLBACK_TIMEOUT_MS = 30000; // Maximum total execution time for all ULSR sync callbacks
+constexpr const char* ULSR_RESULT_PARAM = "persist.hdi_power.ulsr_result";
+constexpr const char* ULSR_RESULT_SUCCESS = "success";
+constexpr uint32_t ULSR_RESULT_MAX_LEN = 32;
+
+class UlsrResultParamSource : public UlsrResultSource {
+public:
+    ~UlsrResultParamSource() override
+    {
+        if (watching_) {
+            RemoveParameterWatcher(ULSR_RESULT_PARAM, OnParameterChanged, this);
+        }
+    }
+    std::string Read() override
+    {
+        char value[ULSR_RESULT_MAX_LEN] = {0};
+        if (GetParameter(ULSR_RESULT_PARAM, "", value, ULSR_RESULT_MAX_LEN) <= 0) {
+            return "";
+        }
+        return value;
+    }
+    bool Watch(const Listener& listener) override
+    {
+        listener_ = listener;
+        int32_t ret = WatchParameter(ULSR_RESULT_PARAM, OnParameterChanged, this);
+        POWER_HILOGI(FEATURE_WAKEUP, "ULSR result watcher add ret: %{public}d", ret);
+        watching_ = ret == 0;
+        return watching_;
+    }
+
+private:
+    static void OnParameterChanged(const char* key, const char* value, void* context)
+    {
+        auto source = static_cast<UlsrResultParamSource*>(context);
+        if (source == nullptr || value == nullptr || source->listener_ == nullptr) {
+            return;
+        }
+        source->listener_(value);
+    }
+
+    Listener listener_;
+    bool watching_ {false};
+};
+} // namespace
+
+UlsrCallbackHolder::UlsrCallbackHolder() : UlsrCallbackHolder(std::make_unique<UlsrResultParamSource>()) {}
+
+UlsrCallbackHolder::UlsrCallbackHolder(std::unique_ptr<UlsrResultSource> resultSource, int64_t resultTimeoutMs)
+    : resultSource_(std::move(resultSource)), resultTimeoutMs_(resultTimeoutMs)
+{
 }
 
 void UlsrCallbackHolder::OnRemoteDied(const wptr<IRemoteObject>& object)
@@ -209,5 +259,72 @@ UlsrCallbackStage UlsrCallbackHolder::GetCallbackState() const
     POWER_HILOGI(FEATURE_WAKEUP, "ULSRcb GetCallbackState S=%{public}d", static_cast<int32_t>(state));
     return state;
 }
+
+bool UlsrCallbackHolder::WaitUlsrResult(const ResultHandler& handler)
+{
+    RETURN_IF_WITH_RET(handler == nullptr || resultSource_ == nullptr, false);
+    if (callbackState_.load() != UlsrCallbackStage::STAGE_ENTER) {
+        POWER_HILOGW(FEATURE_WAKEUP, "ULSRcb WaitUlsrResult skip, ulsr callback state != STAGE_ENTER");
+        return false;
+    }
+    bool expected = false;
+    if (!resultPending_.compare_exchange_strong(expected, true)) {
+        POWER_HILOGW(FEATURE_WAKEUP, "ULSRcb WaitUlsrResult skip, already waiting for the ulsr result");
+        return false;
+    }
+    // registered once and kept, the resume path never adds or removes a watcher
+    std::call_once(watchFlag_, [this]() {
+        resultSource_->Watch([this](const std::string& value) { OnUlsrResultChanged(value); });
+    });
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(resultMutex_);
+        generation = ++resultGeneration_;
+        resultHandler_ = handler;
+    }
+    std::string value = resultSource_->Read();
+    if (!value.empty()) {
+        CompleteUlsrResult(generation, value == ULSR_RESULT_SUCCESS, false);
+        return true;
+    }
+    POWER_HILOGI(FEATURE_WAKEUP, "ULSRcb ulsr result not ready, wait at most %{public}" PRId64 "ms", resultTimeoutMs_);
+    FFRTTask timeoutTask = [this, generation]() {
+        CompleteUlsrResult(generation, resultSource_->Read() == ULSR_RESULT_SUCCESS, true);
+    };
+    FFRTUtils::SubmitDelayTask(timeoutTask, static_cast<uint32_t>(resultTimeoutMs_), resultQueue_);
+    return true;
+}
+
+void UlsrCallbackHolder::OnUlsrResultChanged(const std::string& value)
+{
+    if (value.empty()) {
+        return;
+    }
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(resultMutex_);
+        generation = resultGeneration_;
+    }
+    CompleteUlsrResult(generation, value == ULSR_RESULT_SUCCESS, false);
+}
+
+void UlsrCallbackHolder::CompleteUlsrResult(uint64_t generation, bool ulsrResult, bool isTimeout)
+{
+    ResultHandler handler;
+    {
+        std::lock_guard<std::mutex> lock(resultMutex_);
+        // already completed, or the timeout of an earlier resume
+        if (generation != resultGeneration_ || resultHandler_ == nullptr) {
+            return;
+        }
+        handler = std::move(resultHandler_);
+        resultHandler_ = nullptr;
+    }
+    POWER_HILOGI(FEATURE_WAKEUP, "ULSRcb ulsr result: %{public}d, isTimeout: %{public}d", ulsrResult, isTimeout);
+    FFRTUtils::SubmitQueueTasks({[this, handler, ulsrResult]() {
+        handler(ulsrResult);
+        resultPending_.store(false, std::memory_order_release);
+    }}, resultQueue_);
+}
 } // namespace PowerMgr
 } // namespace OHOS
\ No newline at end of file
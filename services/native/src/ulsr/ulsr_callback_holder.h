@@ -16,10 +16,13 @@
 #ifndef ULSR_CALLBACK_HOLDER_H
 #define ULSR_CALLBACK_HOLDER_H
 
+#include <functional>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
 
+#include "ffrt_utils.h"
 #include "ipc_skeleton.h"
 #include "iremote_object.h"
 #include "ulsr/iulsr_callback.h"
@@ -31,8 +34,24 @@ enum class UlsrCallbackStage : int32_t {
     STAGE_ENTER,    // SyncUlsrNotify() was called but WakeupNotify() hasn't been called
 };
 
+/**
+ * Where the ULSR result written by the HDI is read from, the system parameter on the device.
+ */
+class UlsrResultSource {
+public:
+    using Listener = std::function<void(const std::string& value)>;
+    virtual ~UlsrResultSource() = default;
+    // empty while the result of the current resume has not been written
+    virtual std::string Read() = 0;
+    // listener is called on every later change, for the lifetime of the source
+    virtual bool Watch(const Listener& listener) = 0;
+};
+
 class UlsrCallbackHolder : public IRemoteObject::DeathRecipient {
 public:
+    using ResultHandler = std::function<void(bool ulsrResult)>;
+    static constexpr int64_t ULSR_RESULT_WAIT_TIMEOUT_MS = 2000;
+
     struct UlsrCallbackRecord {
         sptr<IUlsrCallback> callback;
         int32_t priority;
@@ -64,6 +83,11 @@ public:
     using UlsrCallbackContainerType = std::unordered_map<sptr<IUlsrCallback>, UlsrCallbackRecord,
         UlsrCallbackKeyHash, UlsrCallbackKeyEqual>;
 
+    UlsrCallbackHolder();
+    explicit UlsrCallbackHolder(std::unique_ptr<UlsrResultSource> resultSource,
+        int64_t resultTimeoutMs = ULSR_RESULT_WAIT_TIMEOUT_MS);
+    ~UlsrCallbackHolder() override = default;
+
     void OnRemoteDied(const wptr<IRemoteObject>& object) override;
     void AddCallback(const sptr<IUlsrCallback>& callback, const std::pair<int32_t, int32_t>& pidUid,
         UlsrPriority priority = UlsrPriority::DEFAULT);
@@ -71,6 +95,18 @@ public:
     bool SyncUlsrNotify();
     void WakeupNotify(bool ulsrResult = false);
     UlsrCallbackStage GetCallbackState() const;
+    /**
+     * Hand the ULSR result of this resume to handler without blocking: right away if it is already
+     * written, otherwise when the parameter changes or after the timeout, whichever comes first.
+     * handler always runs on the result queue.
+     *
+     * @return false if no ULSR is in progress or a result is already being waited for.
+     */
+    bool WaitUlsrResult(const ResultHandler& handler);
+    bool IsWaitingUlsrResult() const
+    {
+        return resultPending_.load(std::memory_order_acquire);
+    }
 
 private:
     template<typename Func>
@@ -83,12 +119,25 @@ private:
 
     int64_t SyncUlsrNotifyInner(int64_t timeoutMs);
     void ReportSyncUlsrResult(int64_t elapsedTimeMs, bool isTimeout);
+    void OnUlsrResultChanged(const std::string& value);
+    void CompleteUlsrResult(uint64_t generation, bool ulsrResult, bool isTimeout);
 
     std::mutex callbacksMutex_;
     std::atomic<UlsrCallbackStage> callbackState_{UlsrCallbackStage::STAGE_DONE};
     UlsrCallbackContainerType highPriorityCallbacks_;
     UlsrCallbackContainerType defaultPriorityCallbacks_;
     UlsrCallbackContainerType lowPriorityCallbacks_;
+
+    std::unique_ptr<UlsrResultSource> resultSource_;
+    const int64_t resultTimeoutMs_;
+    std::once_flag watchFlag_;
+    std::mutex resultMutex_;
+    // bumped by every wait, a late timeout of an earlier wait is dropped
+    uint64_t resultGeneration_ {0};
+    ResultHandler resultHandler_;
+    std::atomic<bool> resultPending_ {false};
+    // declared last, destroyed first, so that no queued result task outlives the members above
+    FFRTQueue resultQueue_ {"power_ulsr_result"};
 };
 } // namespace PowerMgr
 } // namespace OHOS
@@ -15,6 +15,7 @@
 
 #include "wakeup_controller.h"
 
+#include <cinttypes>
 #include <datetime_ex.h>
 #ifdef POWER_MANAGER_ENABLE_EXTERNAL_SCREEN_MANAGEMENT
 #include <display_manager_lite.h>
@@ -31,9 +32,11 @@
 #include <securec.h>
 #include "permission.h"
 #include "power_cjson_utils.h"
+#include "power_clock.h"
 #include "power_errors.h"
 #include "power_log.h"
 #include "power_mgr_service.h"
+#include "power_profile_loader.h"
 #include "power_state_callback_stub.h"
 #include "power_utils.h"
 #include "setting_helper.h"
@@ -50,7 +53,6 @@ sptr<SettingObserver> g_wakeupSourcesKeyObserver = nullptr;
 #ifdef POWER_DOUBLECLICK_ENABLE
 const int32_t ERR_FAILED = -1;
 #endif
-constexpr int32_t EVENT_INTERVAL_MS = 1000;
 constexpr int32_t WAKEUP_LOCK_TIMEOUT_MS = 5000;
 constexpr int32_t COLLABORATION_REMOTE_DEVICE_ID = 0xAAAAAAFF;
 constexpr int32_t OTHER_SYSTEM_DEVICE_ID = 0xAAAAAAFE;
@@ -67,12 +69,6 @@ WakeupController::WakeupController(std::shared_ptr<PowerStateMachine>& stateMach
 #ifdef HAS_MULTIMODALINPUT_INPUT_PART
     RegisterMonitor(PowerState::AWAKE);
 #endif
-    eventHandleMap_.emplace(WakeupDeviceType::WAKEUP_DEVICE_KEYBOARD, 0);
-    eventHandleMap_.emplace(WakeupDeviceType::WAKEUP_DEVICE_MOUSE, 0);
-    eventHandleMap_.emplace(WakeupDeviceType::WAKEUP_DEVICE_TOUCHPAD, 0);
-    eventHandleMap_.emplace(WakeupDeviceType::WAKEUP_DEVICE_PEN, 0);
-    eventHandleMap_.emplace(WakeupDeviceType::WAKEUP_DEVICE_TOUCH_SCREEN, 0);
-    eventHandleMap_.emplace(WakeupDeviceType::WAKEUP_DEVICE_SINGLE_CLICK, 0);
 }
 
 WakeupController::~WakeupController()
@@ -90,16 +86,17 @@ void WakeupController::RegisterMonitor(PowerState state)
 {
 #ifdef HAS_MULTIMODALINPUT_INPUT_PART
     constexpr int32_t PARAM_ZERO = 0;
-    static PowerState curState = PowerState::UNKNOWN;
-    POWER_HILOGD(FEATURE_WAKEUP, "RegisterMonitor state: %{public}d -> %{public}d", static_cast<int32_t>(curState),
-        static_cast<int32_t>(state));
-    if (state != PowerState::AWAKE && state != PowerState::INACTIVE) {
-        POWER_HILOGE(FEATURE_WAKEUP, "not setting awake or inactive, return");
+    int64_t interval = WakeupInputFilter::GetSubscribeInterval(state);
+    POWER_HILOGD(FEATURE_WAKEUP, "RegisterMonitor state: %{public}d -> %{public}d",
+        static_cast<int32_t>(subscribedState_), static_cast<int32_t>(state));
+    if (interval < PARAM_ZERO) {
+        POWER_HILOGD(FEATURE_WAKEUP, "state does not change the subscription, return");
         return;
     }
     std::lock_guard lock(mmiMonitorMutex_);
-    if (curState == state) {
-        POWER_HILOGE(FEATURE_WAKEUP, "State not changed, return");
+    if (interval == subscribedIntervalMs_) {
+        subscribedState_ = state;
+        POWER_HILOGD(FEATURE_WAKEUP, "interval not changed, return");
         return;
     }
     InputManager* inputManager = InputManager::GetInstance();
@@ -112,8 +109,7 @@ void WakeupController::RegisterMonitor(PowerState state)
         inputManager->UnsubscribeInputActive(monitorId_);
     }
     std::shared_ptr<InputCallback> callback = std::make_shared<InputCallback>();
-    monitorId_ = inputManager->SubscribeInputActive(std::static_pointer_cast<IInputEventConsumer>(callback),
-        state == PowerState::AWAKE ? EVENT_INTERVAL_MS : static_cast<int64_t>(PARAM_ZERO));
+    monitorId_ = inputManager->SubscribeInputActive(std::static_pointer_cast<IInputEventConsumer>(callback), interval);
     if (monitorId_ < PARAM_ZERO) {
         POWER_HILOGE(FEATURE_WAKEUP, "trigger InputActiveCallback subscribe fail hiviewevent");
 #ifdef HAS_HIVIEWDFX_HISYSEVENT_PART
@@ -122,16 +118,27 @@ void WakeupController::RegisterMonitor(PowerState state)
             "REASON", "InputActive Callback Subscribe Fail");
 #endif
     }
-    curState = state;
-    POWER_HILOGD(FEATURE_WAKEUP, "new monitorid = %{public}d, new state = %{public}d", monitorId_,
-        static_cast<int32_t>(curState));
+    subscribedState_ = state;
+    subscribedIntervalMs_ = monitorId_ >= PARAM_ZERO ? interval : -1;
+    POWER_HILOGD(FEATURE_WAKEUP, "new monitorid = %{public}d, new state = %{public}d, interval = %{public}" PRId64,
+        monitorId_, static_cast<int32_t>(subscribedState_), interval);
 #endif
 }
 
+void WakeupController::UpdateInputFilter()
+{
+    uint64_t mask = 0;
+    for (const auto& [reason, monitor] : monitorMap_) {
+        mask |= WakeupInputFilter::ToMask(reason);
+    }
+    inputFilter_.SetEnabledTypes(mask);
+    POWER_HILOGI(FEATURE_WAKEUP, "wakeup input types=0x%{public}" PRIx64, mask);
+}
+
 void WakeupController::Init()
 {
     std::lock_guard lock(monitorMutex_);
-    std::shared_ptr<WakeupSources> sources = WakeupSourceParser::ParseSources();
+    std::shared_ptr<WakeupSources> sources = PowerProfileLoader::GetInstance().GetWakeupSources();
     sourceList_ = sources->GetSourceList();
     if (sourceList_.empty()) {
         POWER_HILOGE(FEATURE_WAKEUP, "InputManager is null");
@@ -149,6 +156,7 @@ void WakeupController::Init()
             monitorMap_.emplace(monitor->GetReason(), monitor);
         }
     }
+    UpdateInputFilter();
     RegisterSettingsObserver();
 }
 
@@ -158,6 +166,7 @@ void WakeupController::Cancel()
         monitor->second->Cancel();
     }
     monitorMap_.clear();
+    inputFilter_.SetEnabledTypes(0);
 }
 
 void WakeupController::RegisterSettingsObserver()
@@ -167,18 +176,14 @@ void WakeupController::RegisterSettingsObserver()
         return;
     }
     SettingObserver::UpdateFunc updateFunc = [&](const std::string&) {
-        std::lock_guard lock(monitorMutex_);
         POWER_HILOGI(COMP_SVC, "start setting string update");
-        std::string jsonStr = SettingHelper::GetSettingWakeupSources();
-        std::shared_ptr<WakeupSources> sources = WakeupSourceParser::ParseSources(jsonStr);
-        if (sources->GetParseErrorFlag()) {
-            POWER_HILOGI(FEATURE_WAKEUP, "Parse failed, call GetWakeupSourcesByConfig again");
-            sources = WakeupSourceParser::ParseSources(WakeupSourceParser::GetWakeupSourcesByConfig());
-        }
+        // parse before taking monitorMutex_, input events keep being handled meanwhile
+        std::shared_ptr<WakeupSources> sources = PowerProfileLoader::GetInstance().ReloadWakeupSources();
         std::vector<WakeupSource> updateSourceList = sources->GetSourceList();
         if (updateSourceList.size() == 0) {
             return;
         }
+        std::lock_guard lock(monitorMutex_);
         sourceList_ = updateSourceList;
         POWER_HILOGI(COMP_SVC, "start updateListener");
         Cancel();
@@ -193,6 +198,7 @@ void WakeupController::RegisterSettingsObserver()
                 monitorMap_.emplace(monitor->GetReason(), monitor);
             }
         }
+        UpdateInputFilter();
     };
     g_wakeupSourcesKeyObserver = SettingHelper::RegisterSettingWakeupSourcesObserver(updateFunc);
     POWER_HILOGI(FEATURE_POWER_STATE, "register setting observer fin");
@@ -561,9 +567,11 @@ void WakeupController::ProcessWakeupReason()
         return;
     }
     std::string wakeupReason;
-    wakeupActionController->GetWakeupReason(wakeupReason);
-    if (wakeupActionController->GetWakeupAction(wakeupReason) == WakeupAction::ACTION_NONE) {
+    int64_t readTimeUs = 0;
+    WakeupReasonMatch match = wakeupActionController->TakeWakeupReason(wakeupReason, readTimeUs);
+    if (match.IsDarkWakeup()) {
         POWER_HILOGI(FEATURE_WAKEUP, "[UL_POWER] WakeupAction is NONE, skip Wakeup and TriggerSyncSleepCallback.");
+        wakeupActionController->HandleDarkWakeup(wakeupReason, match, readTimeUs);
         return;
     }
     SleepGuard sleepGuard(pms);
@@ -700,6 +708,11 @@ void InputCallback::OnInputEvent(std::shared_ptr<KeyEvent> keyEvent) const
         POWER_HILOGE(FEATURE_WAKEUP, "get powerMgrService instance error");
         return;
     }
+    int32_t keyCode = keyEvent->GetKeyCode();
+    WakeupDeviceType wakeupType = GetKeyWakeupDeviceType(keyCode);
+    if (IsFilteredOut(pms, wakeupType)) {
+        return;
+    }
     // ignores remote event
     if (isRemoteEvent(keyEvent)) {
         POWER_HILOGE(FEATURE_WAKEUP, "is remote event, ignore");
@@ -720,17 +733,7 @@ void InputCallback::OnInputEvent(std::shared_ptr<KeyEvent> keyEvent) const
         POWER_HILOGE(FEATURE_WAKEUP, "wakeupController is not init");
         return;
     }
-    int32_t keyCode = keyEvent->GetKeyCode();
-    WakeupDeviceType wakeupType = WakeupDeviceType::WAKEUP_DEVICE_UNKNOWN;
-    if (keyCode == KeyEvent::KEYCODE_F1) {
-        wakeupType = WakeupDeviceType::WAKEUP_DEVICE_DOUBLE_CLICK;
-    } else if (keyCode == KeyEvent::KEYCODE_STYLUS_SCREEN) {
-        wakeupType = WakeupDeviceType::WAKEUP_DEVICE_PEN;
-    } else if (keyCode == KeyEvent::KEYCODE_WAKEUP) {
-        wakeupType = WakeupDeviceType::WAKEUP_DEVICE_TP_TOUCH;
-    }
-    if (isKeyboardKeycode(keyCode)) {
-        wakeupType = WakeupDeviceType::WAKEUP_DEVICE_KEYBOARD;
+    if (wakeupType == WakeupDeviceType::WAKEUP_DEVICE_KEYBOARD) {
         if (wakeupController->CheckEventReciveTime(wakeupType) ||
             keyEvent->GetKeyAction() == KeyEvent::KEY_ACTION_UP) {
             return;
@@ -742,6 +745,31 @@ void InputCallback::OnInputEvent(std::shared_ptr<KeyEvent> keyEvent) const
     }
 }
 
+WakeupDeviceType InputCallback::GetKeyWakeupDeviceType(int32_t keyCode) const
+{
+    if (isKeyboardKeycode(keyCode)) {
+        return WakeupDeviceType::WAKEUP_DEVICE_KEYBOARD;
+    }
+    if (keyCode == KeyEvent::KEYCODE_F1) {
+        return WakeupDeviceType::WAKEUP_DEVICE_DOUBLE_CLICK;
+    } else if (keyCode == KeyEvent::KEYCODE_STYLUS_SCREEN) {
+        return WakeupDeviceType::WAKEUP_DEVICE_PEN;
+    } else if (keyCode == KeyEvent::KEYCODE_WAKEUP) {
+        return WakeupDeviceType::WAKEUP_DEVICE_TP_TOUCH;
+    }
+    return WakeupDeviceType::WAKEUP_DEVICE_UNKNOWN;
+}
+
+bool InputCallback::IsFilteredOut(const sptr<PowerMgrService>& pms, WakeupDeviceType wakeupType) const
+{
+    // with the screen off an event only matters if its device type can wake the device
+    if (!WakeupInputFilter::IsScreenOffState(pms->GetState())) {
+        return false;
+    }
+    std::shared_ptr<WakeupController> wakeupController = pms->GetWakeupController();
+    return wakeupController != nullptr && !wakeupController->IsWakeupInputEnabled(wakeupType);
+}
+
 bool InputCallback::TouchEventAfterScreenOn(std::shared_ptr<PointerEvent> pointerEvent, PowerState state) const
 {
     if (state == PowerState::AWAKE || state == PowerState::FREEZE) {
@@ -790,7 +818,7 @@ bool InputCallback::IsNeedMouseDebounceAfterSuspend(std::shared_ptr<PointerEvent
         POWER_HILOGE(FEATURE_WAKEUP, "suspendController is nullptr");
         return false;
     }
-    int64_t now = GetTickCount();
+    int64_t now = PowerClock::GetTickCount();
     int64_t lastForceSuspendStartTime = suspendController->GetLastForceSuspendStartTime();
     int64_t mouseDebounceTimeAfterSuspend = suspendController->GeMouseDebounceTimeAfterSuspend();
     if (lastForceSuspendStartTime > 0 && now >= lastForceSuspendStartTime &&
@@ -818,6 +846,14 @@ void InputCallback::OnInputEvent(std::shared_ptr<PointerEvent> pointerEvent) con
         POWER_HILOGE(FEATURE_WAKEUP, "generated by window event, ignore");
         return;
     }
+    PointerEvent::PointerItem pointerItem;
+    if (!pointerEvent->GetPointerItem(pointerEvent->GetPointerId(), pointerItem)) {
+        POWER_HILOGI(FEATURE_WAKEUP, "GetPointerItem false");
+    }
+    WakeupDeviceType wakeupType = DetermineWakeupDeviceType(pointerItem.GetToolType(), pointerEvent->GetSourceType());
+    if (IsFilteredOut(pms, wakeupType)) {
+        return;
+    }
     if (isRemoteEvent(pointerEvent)) {
         POWER_HILOGE(FEATURE_WAKEUP, "is remote event, ignore");
         return;
@@ -838,15 +874,7 @@ void InputCallback::OnInputEvent(std::shared_ptr<PointerEvent> pointerEvent) con
         return;
     }
     std::shared_ptr<WakeupController> wakeupController = pms->GetWakeupController();
-    WakeupDeviceType wakeupType = WakeupDeviceType::WAKEUP_DEVICE_UNKNOWN;
-    PointerEvent::PointerItem pointerItem;
-    if (!pointerEvent->GetPointerItem(pointerEvent->GetPointerId(), pointerItem)) {
-        POWER_HILOGI(FEATURE_WAKEUP, "GetPointerItem false");
-    }
-    int32_t deviceType = pointerItem.GetToolType();
-    int32_t sourceType = pointerEvent->GetSourceType();
-    wakeupType = DetermineWakeupDeviceType(deviceType, sourceType);
-    if (wakeupController->CheckEventReciveTime(wakeupType)) {
+    if (wakeupController == nullptr || wakeupController->CheckEventReciveTime(wakeupType)) {
         return;
     }
     if (wakeupType != WakeupDeviceType::WAKEUP_DEVICE_UNKNOWN) {
@@ -878,6 +906,10 @@ void InputCallback::OnInputEvent(std::shared_ptr<AxisEvent> axisEvent) const
     if (pms == nullptr) {
         return;
     }
+    // axis events never wake the device, they only refresh a lit screen
+    if (WakeupInputFilter::IsScreenOffState(pms->GetState())) {
+        return;
+    }
     int64_t now = static_cast<int64_t>(time(nullptr));
     pms->RefreshActivityInner(now, UserActivityType::USER_ACTIVITY_TYPE_ACCESSIBILITY, false);
 }
@@ -886,16 +918,7 @@ void InputCallback::OnInputEvent(std::shared_ptr<AxisEvent> axisEvent) const
 bool WakeupController::CheckEventReciveTime(WakeupDeviceType wakeupType)
 {
     // The minimum refreshactivity interval is 100ms!!
-    std::lock_guard lock(eventHandleMutex_);
-    int64_t now = GetTickCount();
-    if (eventHandleMap_.find(wakeupType) != eventHandleMap_.end()) {
-        if ((eventHandleMap_[wakeupType] + MIN_TIME_MS_BETWEEN_MULTIMODEACTIVITIES) > now) {
-            return true;
-        }
-        eventHandleMap_[wakeupType] = now;
-        return false;
-    }
-    return false;
+    return inputFilter_.IsTooFrequent(wakeupType, PowerClock::GetTickCount());
 }
 
 #ifdef POWER_MANAGER_ENABLE_EXTERNAL_SCREEN_MANAGEMENT
@@ -941,7 +964,7 @@ void WakeupController::ProcessPowerOnInternalScreenOnly(const sptr<PowerMgrServi
 {
     POWER_HILOGI(FEATURE_WAKEUP, "[UL_POWER] Power on internal screen only when external screen is on");
     PowerOnInternalScreen(reason);
-    pms->RefreshActivity(GetTickCount(), UserActivityType::USER_ACTIVITY_TYPE_SWITCH, false);
+    pms->RefreshActivity(PowerClock::GetTickCount(), UserActivityType::USER_ACTIVITY_TYPE_SWITCH, false);
 }
 #endif
 
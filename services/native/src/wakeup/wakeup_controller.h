@@ -30,6 +30,7 @@
 #ifdef HAS_SENSORS_SENSOR_PART
 #include "sensor_agent.h"
 #endif
+#include "wakeup_input_filter.h"
 #include "wakeup_sources.h"
 #include "wakeup_source_parser.h"
 
@@ -73,6 +74,10 @@ public:
         return wakeupReason_;
     }
     bool CheckEventReciveTime(WakeupDeviceType wakeupType);
+    bool IsWakeupInputEnabled(WakeupDeviceType wakeupType) const
+    {
+        return inputFilter_.IsEnabled(wakeupType);
+    }
 #ifdef POWER_MANAGER_ENABLE_EXTERNAL_SCREEN_MANAGEMENT
     void PowerOnInternalScreen(WakeupDeviceType type);
     void PowerOnAllScreens(WakeupDeviceType type);
@@ -102,18 +107,21 @@ private:
     bool NeedToSkipCurrentWakeup(const sptr<PowerMgrService>& pms, WakeupDeviceType reason) const;
     void HandleWakeup(const sptr<PowerMgrService>& pms, WakeupDeviceType reason);
     void ControlListener(WakeupDeviceType reason);
+    // called with monitorMutex_ held whenever monitorMap_ changes
+    void UpdateInputFilter();
 
     std::vector<WakeupSource> sourceList_;
     std::map<WakeupDeviceType, std::shared_ptr<WakeupMonitor>> monitorMap_;
-    std::map<WakeupDeviceType, int64_t> eventHandleMap_;
+    WakeupInputFilter inputFilter_;
     std::shared_ptr<PowerStateMachine> stateMachine_;
     WakeupDeviceType wakeupReason_ {0};
     ffrt::mutex mutex_;
     ffrt::mutex monitorMutex_;
-    ffrt::mutex eventHandleMutex_;
     ffrt::mutex mmiMonitorMutex_;
     static ffrt::mutex sourceUpdateMutex_;
     int32_t monitorId_ {-1};
+    PowerState subscribedState_ {PowerState::UNKNOWN};
+    int64_t subscribedIntervalMs_ {-1};
 };
 
 #ifdef HAS_MULTIMODALINPUT_INPUT_PART
@@ -128,6 +136,8 @@ public:
 private:
     bool isRemoteEvent(std::shared_ptr<InputEvent> event) const;
     bool isKeyboardKeycode(int32_t keyCode) const;
+    WakeupDeviceType GetKeyWakeupDeviceType(int32_t keyCode) const;
+    bool IsFilteredOut(const sptr<PowerMgrService>& pms, WakeupDeviceType wakeupType) const;
     WakeupDeviceType DetermineWakeupDeviceType(int32_t deviceType, int32_t sourceType) const;
 #ifdef POWER_MANAGER_ENABLE_MOUSE_DEBOUNCE_AFTER_SUSPEND
     bool IsNeedMouseDebounceAfterSuspend(std::shared_ptr<PointerEvent> pointerEvent) const;
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "wakeup_input_filter.h"
+
+namespace OHOS {
+namespace PowerMgr {
+WakeupInputFilter::WakeupInputFilter()
+{
+    for (auto& lastEventMs : lastEventMs_) {
+        lastEventMs.store(0, std::memory_order_relaxed);
+    }
+    debounceMask_ = ToMask(WakeupDeviceType::WAKEUP_DEVICE_KEYBOARD) |
+        ToMask(WakeupDeviceType::WAKEUP_DEVICE_MOUSE) |
+        ToMask(WakeupDeviceType::WAKEUP_DEVICE_TOUCHPAD) |
+        ToMask(WakeupDeviceType::WAKEUP_DEVICE_PEN) |
+        ToMask(WakeupDeviceType::WAKEUP_DEVICE_TOUCH_SCREEN) |
+        ToMask(WakeupDeviceType::WAKEUP_DEVICE_SINGLE_CLICK);
+}
+
+int64_t WakeupInputFilter::GetSubscribeInterval(PowerState state)
+{
+    switch (state) {
+        case PowerState::AWAKE:
+            return AWAKE_INTERVAL_MS;
+        // the first touch on a dimmed or dark screen must not wait for the interval
+        case PowerState::DIM:
+        case PowerState::INACTIVE:
+            return 0;
+        default:
+            return -1;
+    }
+}
+
+bool WakeupInputFilter::IsTooFrequent(WakeupDeviceType type, int64_t nowMs)
+{
+    if ((debounceMask_ & ToMask(type)) == 0) {
+        return false;
+    }
+    std::atomic<int64_t>& lastEventMs = lastEventMs_[static_cast<size_t>(type)];
+    int64_t last = lastEventMs.load(std::memory_order_relaxed);
+    if (last + MIN_TIME_MS_BETWEEN_MULTIMODEACTIVITIES > nowMs) {
+        return true;
+    }
+    // another event of this type won the race, this one is the duplicate
+    return !lastEventMs.compare_exchange_strong(last, nowMs, std::memory_order_relaxed);
+}
+} // namespace PowerMgr
+} // namespace OHOS
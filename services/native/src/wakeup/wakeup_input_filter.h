@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_WAKEUP_INPUT_FILTER_H
+#define POWERMGR_WAKEUP_INPUT_FILTER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "power_state_machine_info.h"
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Decides how input events reach the power service. While the screen is on only the activity refresh
+ * matters and events are subscribed at a coarse interval, while it is off every event is delivered
+ * and dropped at once unless its device type can wake the device.
+ */
+class WakeupInputFilter {
+public:
+    // the activity refresh, and with it the screen off timer, may lag the last input by this much
+    static constexpr int64_t AWAKE_INTERVAL_MS = 1000;
+
+    WakeupInputFilter();
+    ~WakeupInputFilter() = default;
+
+    static uint64_t ToMask(WakeupDeviceType type)
+    {
+        uint32_t bit = static_cast<uint32_t>(type);
+        return bit < static_cast<uint32_t>(WakeupDeviceType::WAKEUP_DEVICE_MAX) ? (1ULL << bit) : 0;
+    }
+    // -1 if the state does not change the subscription
+    static int64_t GetSubscribeInterval(PowerState state);
+    static bool IsScreenOffState(PowerState state)
+    {
+        return state == PowerState::INACTIVE || state == PowerState::SLEEP || state == PowerState::HIBERNATE;
+    }
+
+    void SetEnabledTypes(uint64_t mask)
+    {
+        enabledMask_.store(mask, std::memory_order_release);
+    }
+    uint64_t GetEnabledTypes() const
+    {
+        return enabledMask_.load(std::memory_order_acquire);
+    }
+    bool IsEnabled(WakeupDeviceType type) const
+    {
+        return (GetEnabledTypes() & ToMask(type)) != 0;
+    }
+    // true if an event of the same device type was taken less than MIN_TIME_MS_BETWEEN_MULTIMODEACTIVITIES ago
+    bool IsTooFrequent(WakeupDeviceType type, int64_t nowMs);
+
+private:
+    static constexpr size_t TYPE_NUM = static_cast<size_t>(WakeupDeviceType::WAKEUP_DEVICE_MAX);
+
+    std::atomic<uint64_t> enabledMask_ {0};
+    uint64_t debounceMask_ {0};
+    std::array<std::atomic<int64_t>, TYPE_NUM> lastEventMs_;
+};
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWERMGR_WAKEUP_INPUT_FILTER_H
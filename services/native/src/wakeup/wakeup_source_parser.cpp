@@ -37,11 +37,15 @@ bool g_isFirstSettingUpdated = true;
 
 std::shared_ptr<WakeupSources> WakeupSourceParser::ParseSources()
 {
-    bool isWakeupSourcesSettingValid = SettingHelper::IsWakeupSourcesSettingValid();
+    return ParseSourcesBySetting(SettingHelper::GetSettingWakeupSources());
+}
+
+std::shared_ptr<WakeupSources> WakeupSourceParser::ParseSourcesBySetting(const std::string& sourcesSettingStr)
+{
+    bool isWakeupSourcesSettingValid = !sourcesSettingStr.empty();
     POWER_HILOGI(FEATURE_WAKEUP, "ParseSources setting=%{public}d", isWakeupSourcesSettingValid);
     std::string configJsonStr;
     if (isWakeupSourcesSettingValid) {
-        std::string sourcesSettingStr = SettingHelper::GetSettingWakeupSources();
         configJsonStr = sourcesSettingStr;
 #ifdef POWER_MANAGER_ENABLE_WATCH_UPDATE_ADAPT
         // this branch means use config file for update scene in watch
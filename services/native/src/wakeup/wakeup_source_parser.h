@@ -29,6 +29,10 @@ class WakeupSourceParser {
 public:
     static std::shared_ptr<WakeupSources> ParseSources();
     static std::shared_ptr<WakeupSources> ParseSources(const std::string& config);
+    /**
+     * Parse with an already fetched setting value, empty means no override.
+     */
+    static std::shared_ptr<WakeupSources> ParseSourcesBySetting(const std::string& sourcesSettingStr);
     static bool ParseSourcesProc(
         std::shared_ptr<WakeupSources>& parseSources, cJSON* valueObj, std::string& key);
     static bool GetTargetPath(std::string& targetPath);
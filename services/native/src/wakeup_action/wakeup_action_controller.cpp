@@ -15,9 +15,14 @@
 
 #include "wakeup_action_controller.h"
 
+#include <chrono>
+#include <cinttypes>
 #include <ipc_skeleton.h>
+#include "ffrt_utils.h"
+#include "power_event_recorder.h"
 #include "power_log.h"
 #include "power_mgr_service.h"
+#include "power_profile_loader.h"
 #include "system_suspend_controller.h"
 
 namespace OHOS {
@@ -38,11 +43,23 @@ WakeupActionController::~WakeupActionController()
 void WakeupActionController::Init()
 {
     std::lock_guard lock(mutex_);
-    std::shared_ptr<WakeupActionSources> sources = WakeupActionSourceParser::ParseSources();
+    std::shared_ptr<WakeupActionSources> sources = PowerProfileLoader::GetInstance().GetWakeupActionSources();
     sourceMap_ = sources->GetSourceMap();
     if (sourceMap_.empty()) {
         POWER_HILOGE(FEATURE_WAKEUP_ACTION, "InputManager is null");
     }
+    matcher_.Build(sourceMap_);
+}
+
+int64_t WakeupActionController::GetNowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+WakeupReasonMatch WakeupActionController::MatchWakeupReason(const std::string& reason) const
+{
+    return matcher_.Match(reason);
 }
 
 void WakeupActionController::GetWakeupReason(std::string& reason)
@@ -58,32 +75,80 @@ void WakeupActionController::GetWakeupReason(std::string& reason)
 
 WakeupAction WakeupActionController::GetWakeupAction(const std::string& reason) const
 {
-    auto it = sourceMap_.find(reason);
-    if (it == sourceMap_.end()) {
-        return WakeupAction::ACTION_INVALID;
+    WakeupAction action = matcher_.Match(reason).GetAction();
+    if (action != WakeupAction::ACTION_INVALID) {
+        POWER_HILOGI(FEATURE_WAKEUP_ACTION, "WakeupAction reason %{public}s, action %{public}d", reason.c_str(),
+            action);
     }
-    auto action = it->second->GetAction();
-    POWER_HILOGI(FEATURE_WAKEUP_ACTION, "WakeupAction reason %{public}s, action %{public}d", reason.c_str(), action);
-    return static_cast<WakeupAction>(action);
+    return action;
 }
 
 bool WakeupActionController::IsWakeupReasonConfigMatched()
 {
+    int64_t readTimeUs = GetNowUs();
     std::string reason;
     GetWakeupReason(reason);
     if (reason.empty()) {
         return false;
     }
-    if (sourceMap_.find(reason) != sourceMap_.end()) {
-        return true;
+    if (!matcher_.Match(reason).IsMatched()) {
+        POWER_HILOGI(FEATURE_WAKEUP_ACTION, "WakeupAction reason %{public}s doesn't exist", reason.c_str());
+        return false;
+    }
+    std::lock_guard lock(pendingMutex_);
+    hasPendingReason_ = true;
+    pendingReason_ = reason;
+    pendingReadTimeUs_ = readTimeUs;
+    return true;
+}
+
+WakeupReasonMatch WakeupActionController::TakeWakeupReason(std::string& reason, int64_t& readTimeUs)
+{
+    {
+        std::lock_guard lock(pendingMutex_);
+        if (hasPendingReason_) {
+            hasPendingReason_ = false;
+            reason = std::move(pendingReason_);
+            readTimeUs = pendingReadTimeUs_;
+            return matcher_.Match(reason);
+        }
     }
-    POWER_HILOGI(FEATURE_WAKEUP_ACTION, "WakeupAction reason %{public}s doesn't exist", reason.c_str());
-    return false;
+    readTimeUs = GetNowUs();
+    GetWakeupReason(reason);
+    return matcher_.Match(reason);
+}
+
+void WakeupActionController::ReportWakeupStatistic(const std::string& reason, const WakeupReasonMatch& match)
+{
+#ifdef HAS_HIVIEWDFX_HISYSEVENT_PART
+    std::string str = reason + ":" + std::to_string(static_cast<uint32_t>(match.GetAction()));
+    PowerEventRecorder::GetInstance().Record([str] {
+        HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "WAKEUP_STATISTIC",
+            HiviewDFX::HiSysEvent::EventType::STATISTIC, "WAKEUP_REASON", str.c_str());
+    });
+#endif
+}
+
+void WakeupActionController::HandleDarkWakeup(
+    const std::string& reason, const WakeupReasonMatch& match, int64_t readTimeUs)
+{
+    ReportWakeupStatistic(reason, match);
+    int64_t costUs = GetNowUs() - readTimeUs;
+    darkWakeupStats_.Record(costUs);
+    POWER_HILOGI(FEATURE_WAKEUP_ACTION, "dark wakeup, reason=%{public}s, scene=%{public}s, cost=%{public}" PRId64
+        "us", reason.c_str(), match.source->GetScene().c_str(), costUs);
+}
+
+void WakeupActionController::DumpInfo(std::string& result) const
+{
+    result.append("WAKEUP ACTION: reasons=").append(std::to_string(matcher_.GetSize())).append("\n");
+    darkWakeupStats_.DumpInfo(result);
 }
 
 bool WakeupActionController::ExecuteByGetReason(const std::string& reason)
 {
-    if (sourceMap_.find(reason) == sourceMap_.end()) {
+    WakeupReasonMatch match = matcher_.Match(reason);
+    if (!match.IsMatched()) {
         POWER_HILOGI(FEATURE_WAKEUP_ACTION, "WakeupAction reason %{public}s doesn't exist", reason.c_str());
         return false;
     }
@@ -91,24 +156,20 @@ bool WakeupActionController::ExecuteByGetReason(const std::string& reason)
     auto uid = IPCSkeleton::GetCallingUid();
     POWER_HILOGI(FEATURE_WAKEUP_ACTION,
         "WakeupAction device, pid=%{public}d, uid=%{public}d, reason=%{public}s, scene=%{public}s, action=%{public}u",
-        pid, uid, reason.c_str(), sourceMap_[reason]->GetScene().c_str(), sourceMap_[reason]->GetAction());
-#ifdef HAS_HIVIEWDFX_HISYSEVENT_PART
-    std::string str = reason + ":" + std::to_string(sourceMap_[reason]->GetAction());
-    HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::POWER, "WAKEUP_STATISTIC",
-        HiviewDFX::HiSysEvent::EventType::STATISTIC, "WAKEUP_REASON", str.c_str());
-#endif
-    HandleAction(reason);
+        pid, uid, reason.c_str(), match.source->GetScene().c_str(), match.source->GetAction());
+    ReportWakeupStatistic(reason, match);
+    HandleAction(match);
     return true;
 }
 
-void WakeupActionController::HandleAction(const std::string& reason)
+void WakeupActionController::HandleAction(const WakeupReasonMatch& match)
 {
-    switch (static_cast<WakeupAction>(sourceMap_[reason]->GetAction())) {
+    switch (match.GetAction()) {
         case WakeupAction::ACTION_HIBERNATE:
-            HandleHibernate(WakeupActionSources::mapSuspendDeviceType(reason));
+            HandleHibernate(match.suspendType);
             break;
         case WakeupAction::ACTION_SHUTDOWN:
-            HandleShutdown(sourceMap_[reason]->GetScene());
+            HandleShutdown(match.source->GetScene());
             break;
         case WakeupAction::ACTION_NONE:
         default:
@@ -25,6 +25,7 @@
 #include "shutdown_controller.h"
 #include "wakeup_action_source_parser.h"
 #include "wakeup_action_sources.h"
+#include "wakeup_reason_matcher.h"
 
 namespace OHOS {
 namespace PowerMgr {
@@ -39,13 +40,28 @@ public:
     WakeupAction GetWakeupAction(const std::string& reason) const;
     bool ExecuteByGetReason(const std::string& reason);
     bool IsWakeupReasonConfigMatched();
+    WakeupReasonMatch MatchWakeupReason(const std::string& reason) const;
+    // the reason read by IsWakeupReasonConfigMatched, read again from the HDI if there is none
+    WakeupReasonMatch TakeWakeupReason(std::string& reason, int64_t& readTimeUs);
+    // the device stays asleep, nothing but the telemetry is done
+    void HandleDarkWakeup(const std::string& reason, const WakeupReasonMatch& match, int64_t readTimeUs);
+    void DumpInfo(std::string& result) const;
+
+    static int64_t GetNowUs();
 
 private:
-    void HandleAction(const std::string& reason);
+    void HandleAction(const WakeupReasonMatch& match);
     void HandleHibernate(SuspendDeviceType reason);
     void HandleShutdown(const std::string& scene);
+    void ReportWakeupStatistic(const std::string& reason, const WakeupReasonMatch& match);
 
     std::map<std::string, std::shared_ptr<WakeupActionSource>> sourceMap_;
+    WakeupReasonMatcher matcher_;
+    DarkWakeupStats darkWakeupStats_;
+    std::mutex pendingMutex_;
+    bool hasPendingReason_ {false};
+    std::string pendingReason_;
+    int64_t pendingReadTimeUs_ {0};
     std::shared_ptr<ShutdownController> shutdownController_;
     std::shared_ptr<PowerStateMachine> stateMachine_;
     std::mutex mutex_;
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "wakeup_reason_matcher.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace OHOS {
+namespace PowerMgr {
+namespace {
+constexpr uint32_t DECIMAL_BASE = 10;
+} // namespace
+
+bool WakeupReasonMatcher::ParseDenseReason(std::string_view reason, uint32_t& code)
+{
+    if (reason.empty()) {
+        return false;
+    }
+    code = 0;
+    for (char ch : reason) {
+        if (ch < '0' || ch > '9') {
+            return false;
+        }
+        code = code * DECIMAL_BASE + static_cast<uint32_t>(ch - '0');
+        if (code >= MAX_DENSE_REASON) {
+            return false;
+        }
+    }
+    // "053" is a different key than "53"
+    return reason.size() == 1 || reason.front() != '0';
+}
+
+void WakeupReasonMatcher::Build(const std::map<std::string, std::shared_ptr<WakeupActionSource>>& sourceMap)
+{
+    dense_.assign(MAX_DENSE_REASON, WakeupReasonMatch());
+    others_.clear();
+    size_ = 0;
+    for (const auto& [reason, source] : sourceMap) {
+        if (source == nullptr) {
+            continue;
+        }
+        WakeupReasonMatch match {source, WakeupActionSources::mapSuspendDeviceType(reason)};
+        uint32_t code = 0;
+        if (ParseDenseReason(reason, code)) {
+            dense_[code] = match;
+        } else {
+            others_.emplace(reason, match);
+        }
+        size_++;
+    }
+}
+
+WakeupReasonMatch WakeupReasonMatcher::Match(std::string_view reason) const
+{
+    while (!reason.empty() && std::isspace(static_cast<unsigned char>(reason.back()))) {
+        reason.remove_suffix(1);
+    }
+    uint32_t code = 0;
+    if (!dense_.empty() && ParseDenseReason(reason, code)) {
+        return dense_[code];
+    }
+    auto iter = others_.find(reason);
+    if (iter != others_.end()) {
+        return iter->second;
+    }
+    return WakeupReasonMatch();
+}
+
+void DarkWakeupStats::Record(int64_t costUs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    count_++;
+    lastUs_ = costUs;
+    maxUs_ = std::max(maxUs_, costUs);
+    totalUs_ += costUs;
+}
+
+uint64_t DarkWakeupStats::GetCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return count_;
+}
+
+int64_t DarkWakeupStats::GetMaxUs() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return maxUs_;
+}
+
+void DarkWakeupStats::DumpInfo(std::string& result) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    result.append("DARK WAKEUP: count=").append(std::to_string(count_))
+        .append(" last=").append(std::to_string(lastUs_)).append("us")
+        .append(" max=").append(std::to_string(maxUs_)).append("us")
+        .append(" avg=").append(std::to_string(count_ == 0 ? 0 : totalUs_ / static_cast<int64_t>(count_)))
+        .append("us\n");
+}
+} // namespace PowerMgr
+} // namespace OHOS
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_WAKEUP_REASON_MATCHER_H
+#define POWERMGR_WAKEUP_REASON_MATCHER_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "wakeup_action_sources.h"
+
+namespace OHOS {
+namespace PowerMgr {
+struct WakeupReasonMatch {
+    std::shared_ptr<WakeupActionSource> source;
+    SuspendDeviceType suspendType {SuspendDeviceType::SUSPEND_DEVICE_REASON_MIN};
+
+    bool IsMatched() const
+    {
+        return source != nullptr;
+    }
+    WakeupAction GetAction() const
+    {
+        return source == nullptr ? WakeupAction::ACTION_INVALID : static_cast<WakeupAction>(source->GetAction());
+    }
+    // the wakeup does not need the screen or the power state, the device goes back to suspend
+    bool IsDarkWakeup() const
+    {
+        return GetAction() == WakeupAction::ACTION_NONE;
+    }
+};
+
+/**
+ * Lookup table built once from power_wakeup_action.json. The HDI reports wakeup reasons as small
+ * numbers, those are resolved by index, anything else through a map searched with the string_view
+ * itself. The suspend type of each reason is resolved when the table is built.
+ */
+class WakeupReasonMatcher {
+public:
+    static constexpr uint32_t MAX_DENSE_REASON = 256;
+
+    void Build(const std::map<std::string, std::shared_ptr<WakeupActionSource>>& sourceMap);
+    // trailing whitespace of the raw HDI reason is ignored
+    WakeupReasonMatch Match(std::string_view reason) const;
+    size_t GetSize() const
+    {
+        return size_;
+    }
+
+private:
+    static bool ParseDenseReason(std::string_view reason, uint32_t& code);
+
+    std::vector<WakeupReasonMatch> dense_;
+    std::map<std::string, WakeupReasonMatch, std::less<>> others_;
+    size_t size_ {0};
+};
+
+/**
+ * Cost of the dark wakeups, from reading the wakeup reason to handing the device back to suspend.
+ */
+class DarkWakeupStats {
+public:
+    void Record(int64_t costUs);
+    void DumpInfo(std::string& result) const;
+    uint64_t GetCount() const;
+    int64_t GetMaxUs() const;
+
+private:
+    mutable std::mutex mutex_;
+    uint64_t count_ {0};
+    int64_t lastUs_ {0};
+    int64_t maxUs_ {0};
+    int64_t totalUs_ {0};
+};
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWERMGR_WAKEUP_REASON_MATCHER_H
@@ -32,6 +32,8 @@ public:
         : IRemoteProxy<IPowerRunninglockCallback>(impl) {}
     virtual ~PowerRunningLockCallbackProxy() = default;
     virtual void HandleRunningLockMessage(std::string message) override;
+    virtual void HandleRunningLockChanges(
+        const std::vector<RunningLockChangeRecord>& records, uint32_t droppedCount) override;
 
 private:
     static inline BrokerDelegator<PowerRunningLockCallbackProxy> delegator_;
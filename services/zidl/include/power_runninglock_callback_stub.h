@@ -30,6 +30,11 @@ public:
     virtual ~PowerRunningLockCallbackStub() = default;
     int OnRemoteRequest(uint32_t code, MessageParcel& data, MessageParcel& reply, MessageOption& option) override;
     void HandleRunningLockMessage(std::string message) override {};
+
+private:
+    static constexpr uint32_t MAX_RECORD_NUM = 1024;
+
+    int32_t HandleRunningLockChangesStub(MessageParcel& data);
 };
 } // namespace PowerMgr
 } // namespace OHOS
@@ -47,5 +47,34 @@ void PowerRunningLockCallbackProxy::HandleRunningLockMessage(std::string message
         POWER_HILOGE(FEATURE_POWER_MODE, "%{public}s: SendRequest failed with ret=%{public}d", __func__, ret);
     }
 }
+
+void PowerRunningLockCallbackProxy::HandleRunningLockChanges(
+    const std::vector<RunningLockChangeRecord>& records, uint32_t droppedCount)
+{
+    sptr<IRemoteObject> remote = Remote();
+    RETURN_IF(remote == nullptr);
+
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option = { MessageOption::TF_ASYNC };
+
+    if (!data.WriteInterfaceToken(PowerRunningLockCallbackProxy::GetDescriptor())) {
+        POWER_HILOGE(FEATURE_POWER_MODE, "Write descriptor failed");
+        return;
+    }
+
+    RETURN_IF_WRITE_PARCEL_FAILED_NO_RET(data, Uint32, static_cast<uint32_t>(records.size()));
+    for (const auto& record : records) {
+        RETURN_IF(!record.Marshalling(data));
+    }
+    RETURN_IF_WRITE_PARCEL_FAILED_NO_RET(data, Uint32, droppedCount);
+
+    int ret = remote->SendRequest(
+        static_cast<int>(PowerMgr::PowerRunningLockCallbackInterfaceCode::POWER_RUNNINGLOCK_CHANGES),
+        data, reply, option);
+    if (ret != ERR_OK) {
+        POWER_HILOGE(FEATURE_POWER_MODE, "%{public}s: SendRequest failed with ret=%{public}d", __func__, ret);
+    }
+}
 } // namespace PowerMgr
 } // namespace OHOS
\ No newline at end of file
@@ -39,10 +39,33 @@ int PowerRunningLockCallbackStub::OnRemoteRequest(uint32_t code, MessageParcel &
         std::string message;
         RETURN_IF_READ_PARCEL_FAILED_WITH_RET(data, String, message, E_READ_PARCEL_ERROR);
         HandleRunningLockMessage(message);
+    } else if (code ==
+        static_cast<uint32_t>(PowerMgr::PowerRunningLockCallbackInterfaceCode::POWER_RUNNINGLOCK_CHANGES)) {
+        ret = HandleRunningLockChangesStub(data);
     } else {
         ret = IPCObjectStub::OnRemoteRequest(code, data, reply, option);
     }
     return ret;
 }
+
+int32_t PowerRunningLockCallbackStub::HandleRunningLockChangesStub(MessageParcel& data)
+{
+    uint32_t recordNum = 0;
+    RETURN_IF_READ_PARCEL_FAILED_WITH_RET(data, Uint32, recordNum, E_READ_PARCEL_ERROR);
+    if (recordNum > MAX_RECORD_NUM) {
+        POWER_HILOGE(COMP_SVC, "record num exceed limit, num=%{public}u", recordNum);
+        return E_READ_PARCEL_ERROR;
+    }
+    std::vector<RunningLockChangeRecord> records(recordNum);
+    for (auto& record : records) {
+        if (!record.ReadFromParcel(data)) {
+            return E_READ_PARCEL_ERROR;
+        }
+    }
+    uint32_t droppedCount = 0;
+    RETURN_IF_READ_PARCEL_FAILED_WITH_RET(data, Uint32, droppedCount, E_READ_PARCEL_ERROR);
+    HandleRunningLockChanges(records, droppedCount);
+    return ERR_OK;
+}
 } // namespace PowerMgr
 } // namespace OHOS
\ No newline at end of file
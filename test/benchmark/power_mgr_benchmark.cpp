@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <datetime_ex.h>
+#include <gmock/gmock.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hdi_running_lock_queue.h"
+#include "ipower_mgr.h"
+#include "message_parcel.h"
+#include "mock_lock_action.h"
+#include "mock_power_action.h"
+#include "mock_state_action.h"
+#include "power_log.h"
+#include "power_mgr_service.h"
+#include "power_mode_policy.h"
+#include "running_lock_token_stub.h"
+#include "suspend_source_parser.h"
+#include "wakeup_source_parser.h"
+
+using namespace OHOS;
+using namespace OHOS::PowerMgr;
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace {
+constexpr int64_t LOCK_COUNT_SMALL = 1;
+constexpr int64_t LOCK_COUNT_MEDIUM = 100;
+constexpr int64_t LOCK_COUNT_LARGE = 10000;
+constexpr pid_t BENCHMARK_PID_BASE = 10000;
+constexpr pid_t BENCHMARK_UID_BASE = 20000;
+// cost of one HoldRunningLockExt/UnholdRunningLockExt round trip to the power HDI
+constexpr int64_t HDI_LATENCY_US = 200;
+const std::string DEFAULT_OUT_FILE = "/data/test/power_mgr_benchmark.json";
+
+class PowerBenchmarkEnv {
+public:
+    static PowerBenchmarkEnv& GetInstance()
+    {
+        static PowerBenchmarkEnv instance;
+        return instance;
+    }
+
+    sptr<PowerMgrService> GetService() const
+    {
+        return pms_;
+    }
+
+    ~PowerBenchmarkEnv()
+    {
+        pms_->OnStop();
+        pms_->Reset();
+    }
+
+private:
+    PowerBenchmarkEnv()
+    {
+        pms_ = DelayedSpSingleton<PowerMgrService>::GetInstance();
+        pms_->OnStart();
+        stateAction_ = new NiceMock<MockStateAction>();
+        shutdownState_ = new NiceMock<MockStateAction>();
+        powerAction_ = new NiceMock<MockPowerAction>();
+        lockAction_ = new NiceMock<MockLockAction>();
+        ON_CALL(*stateAction_, GetDisplayState()).WillByDefault(Return(DisplayState::DISPLAY_ON));
+        ON_CALL(*stateAction_, SetDisplayState(_, _)).WillByDefault(Return(ActionResult::SUCCESS));
+        ON_CALL(*lockAction_, Lock(_)).WillByDefault(Return(RUNNINGLOCK_SUCCESS));
+        ON_CALL(*lockAction_, Unlock(_)).WillByDefault(Return(RUNNINGLOCK_SUCCESS));
+        pms_->EnableMock(stateAction_, shutdownState_, powerAction_, lockAction_);
+    }
+
+    sptr<PowerMgrService> pms_ {nullptr};
+    NiceMock<MockStateAction>* stateAction_ {nullptr};
+    NiceMock<MockStateAction>* shutdownState_ {nullptr};
+    NiceMock<MockPowerAction>* powerAction_ {nullptr};
+    NiceMock<MockLockAction>* lockAction_ {nullptr};
+};
+
+std::vector<sptr<IRemoteObject>> CreateTokens(int64_t count)
+{
+    std::vector<sptr<IRemoteObject>> tokens;
+    tokens.reserve(count);
+    for (int64_t index = 0; index < count; index++) {
+        tokens.push_back(new RunningLockTokenStub());
+    }
+    return tokens;
+}
+
+RunningLockParam CreateLockParam(int64_t index)
+{
+    RunningLockParam param;
+    param.lockid = static_cast<uint64_t>(index);
+    param.name = "benchmark_lock_" + std::to_string(index);
+    param.bundleName = "com.benchmark.power";
+    param.type = RunningLockType::RUNNINGLOCK_BACKGROUND_TASK;
+    param.pid = BENCHMARK_PID_BASE + static_cast<pid_t>(index % LOCK_COUNT_MEDIUM);
+    param.uid = BENCHMARK_UID_BASE + static_cast<pid_t>(index % LOCK_COUNT_MEDIUM);
+    return param;
+}
+
+void BM_PowerStateMachineSetState(benchmark::State& state)
+{
+    auto stateMachine = PowerBenchmarkEnv::GetInstance().GetService()->GetPowerStateMachine();
+    bool toInactive = true;
+    for (auto _ : state) {
+        if (toInactive) {
+            stateMachine->SetState(PowerState::INACTIVE, StateChangeReason::STATE_CHANGE_REASON_APPLICATION, true);
+        } else {
+            stateMachine->SetState(PowerState::AWAKE, StateChangeReason::STATE_CHANGE_REASON_APPLICATION, true);
+        }
+        toInactive = !toInactive;
+    }
+    stateMachine->SetState(PowerState::AWAKE, StateChangeReason::STATE_CHANGE_REASON_APPLICATION, true);
+}
+BENCHMARK(BM_PowerStateMachineSetState);
+
+void BM_PowerStateMachineRefreshActivityInner(benchmark::State& state)
+{
+    auto stateMachine = PowerBenchmarkEnv::GetInstance().GetService()->GetPowerStateMachine();
+    stateMachine->SetState(PowerState::AWAKE, StateChangeReason::STATE_CHANGE_REASON_APPLICATION, true);
+    for (auto _ : state) {
+        stateMachine->RefreshActivityInner(
+            BENCHMARK_PID_BASE, GetTickCount(), UserActivityType::USER_ACTIVITY_TYPE_TOUCH, true);
+    }
+}
+BENCHMARK(BM_PowerStateMachineRefreshActivityInner);
+
+void BM_RunningLockCreateRelease(benchmark::State& state)
+{
+    auto runningLockMgr = PowerBenchmarkEnv::GetInstance().GetService()->GetRunningLockMgr();
+    auto tokens = CreateTokens(state.range(0));
+    for (auto _ : state) {
+        for (int64_t index = 0; index < state.range(0); index++) {
+            runningLockMgr->CreateRunningLock(tokens[index], CreateLockParam(index));
+        }
+        for (int64_t index = 0; index < state.range(0); index++) {
+            runningLockMgr->ReleaseLock(tokens[index]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RunningLockCreateRelease)->Arg(LOCK_COUNT_SMALL)->Arg(LOCK_COUNT_MEDIUM)->Arg(LOCK_COUNT_LARGE);
+
+void BM_RunningLockLockUnLock(benchmark::State& state)
+{
+    auto runningLockMgr = PowerBenchmarkEnv::GetInstance().GetService()->GetRunningLockMgr();
+    auto tokens = CreateTokens(state.range(0));
+    for (int64_t index = 0; index < state.range(0); index++) {
+        runningLockMgr->CreateRunningLock(tokens[index], CreateLockParam(index));
+    }
+    for (auto _ : state) {
+        for (int64_t index = 0; index < state.range(0); index++) {
+            runningLockMgr->Lock(tokens[index]);
+        }
+        for (int64_t index = 0; index < state.range(0); index++) {
+            runningLockMgr->UnLock(tokens[index]);
+        }
+    }
+    for (int64_t index = 0; index < state.range(0); index++) {
+        runningLockMgr->ReleaseLock(tokens[index]);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RunningLockLockUnLock)->Arg(LOCK_COUNT_SMALL)->Arg(LOCK_COUNT_MEDIUM)->Arg(LOCK_COUNT_LARGE);
+
+void BM_RunningLockProxyBulk(benchmark::State& state)
+{
+    auto runningLockMgr = PowerBenchmarkEnv::GetInstance().GetService()->GetRunningLockMgr();
+    auto tokens = CreateTokens(state.range(0));
+    std::vector<std::pair<pid_t, pid_t>> processInfos;
+    for (int64_t index = 0; index < state.range(0); index++) {
+        RunningLockParam param = CreateLockParam(index);
+        runningLockMgr->CreateRunningLock(tokens[index], param);
+        runningLockMgr->Lock(tokens[index]);
+        processInfos.emplace_back(param.pid, param.uid);
+    }
+    for (auto _ : state) {
+        runningLockMgr->ProxyRunningLocks(true, processInfos);
+        runningLockMgr->ProxyRunningLocks(false, processInfos);
+    }
+    for (int64_t index = 0; index < state.range(0); index++) {
+        runningLockMgr->ReleaseLock(tokens[index]);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RunningLockProxyBulk)->Arg(LOCK_COUNT_SMALL)->Arg(LOCK_COUNT_MEDIUM)->Arg(LOCK_COUNT_LARGE);
+
+// the fake IPowerInterface, counts the HoldRunningLockExt/UnholdRunningLockExt calls it gets
+HdiRunningLockQueue::Command CreateFakeHdiCommand(std::atomic<int64_t>& hdiCalls)
+{
+    return [&hdiCalls](const RunningLockParam&) {
+        std::this_thread::sleep_for(std::chrono::microseconds(HDI_LATENCY_US));
+        hdiCalls++;
+        return RUNNINGLOCK_SUCCESS;
+    };
+}
+
+// AcquireRunningLock/ReleaseRunningLock as they were, every call waits for the HDI
+void BM_HdiRunningLockSync(benchmark::State& state)
+{
+    std::atomic<int64_t> hdiCalls {0};
+    HdiRunningLockQueue::Command hold = CreateFakeHdiCommand(hdiCalls);
+    HdiRunningLockQueue::Command unhold = CreateFakeHdiCommand(hdiCalls);
+    for (auto _ : state) {
+        for (int64_t index = 0; index < state.range(0); index++) {
+            hold(CreateLockParam(index));
+            unhold(CreateLockParam(index));
+        }
+    }
+    state.counters["hdi_calls"] = benchmark::Counter(static_cast<double>(hdiCalls.load()),
+        benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HdiRunningLockSync)->Arg(LOCK_COUNT_SMALL)->Arg(LOCK_COUNT_MEDIUM);
+
+// AcquireRunningLock/ReleaseRunningLock through the queue, the HDI calls are made on the ffrt queue
+void BM_HdiRunningLockQueued(benchmark::State& state)
+{
+    std::atomic<int64_t> hdiCalls {0};
+    HdiRunningLockQueue queue(CreateFakeHdiCommand(hdiCalls), CreateFakeHdiCommand(hdiCalls));
+    for (auto _ : state) {
+        for (int64_t index = 0; index < state.range(0); index++) {
+            queue.Hold(CreateLockParam(index));
+            queue.Unhold(CreateLockParam(index));
+        }
+    }
+    queue.Drain();
+    state.counters["hdi_calls"] = benchmark::Counter(static_cast<double>(hdiCalls.load()),
+        benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HdiRunningLockQueued)->Arg(LOCK_COUNT_SMALL)->Arg(LOCK_COUNT_MEDIUM);
+
+void BM_WakeupSourceParse(benchmark::State& state)
+{
+    const std::string config = WakeupSourceParser::GetWakeupSourcesByConfig();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(WakeupSourceParser::ParseSources(config));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(config.size()));
+}
+BENCHMARK(BM_WakeupSourceParse);
+
+void BM_SuspendSourceParse(benchmark::State& state)
+{
+    const std::string config = SuspendSourceParser::GetSuspendSourcesByConfig();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(SuspendSourceParser::ParseSources(config));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(config.size()));
+}
+BENCHMARK(BM_SuspendSourceParse);
+
+void BM_PowerModePolicySwitch(benchmark::State& state)
+{
+    PowerBenchmarkEnv::GetInstance();
+    auto policy = DelayedSingleton<PowerModePolicy>::GetInstance();
+    bool toSaveMode = true;
+    for (auto _ : state) {
+        policy->UpdatePowerModePolicy(static_cast<uint32_t>(
+            toSaveMode ? PowerMode::POWER_SAVE_MODE : PowerMode::NORMAL_MODE));
+        toSaveMode = !toSaveMode;
+    }
+    policy->UpdatePowerModePolicy(static_cast<uint32_t>(PowerMode::NORMAL_MODE));
+}
+BENCHMARK(BM_PowerModePolicySwitch);
+
+void BM_IpcAdapterDispatch(benchmark::State& state)
+{
+    auto pms = PowerBenchmarkEnv::GetInstance().GetService();
+    for (auto _ : state) {
+        MessageParcel data;
+        MessageParcel reply;
+        MessageOption option;
+        data.WriteInterfaceToken(PowerMgrService::GetDescriptor());
+        pms->OnRemoteRequest(static_cast<uint32_t>(IPowerMgrIpcCode::COMMAND_GET_STATE_IPC), data, reply, option);
+    }
+}
+BENCHMARK(BM_IpcAdapterDispatch);
+} // namespace
+
+// Results are written as JSON by default so that they can be compared between builds.
+int main(int argc, char** argv)
+{
+    std::vector<char*> args(argv, argv + argc);
+    bool hasOut = false;
+    for (int index = 1; index < argc; index++) {
+        if (std::string(argv[index]).find("--benchmark_out=") == 0) {
+            hasOut = true;
+        }
+    }
+    std::string outArg = "--benchmark_out=" + DEFAULT_OUT_FILE;
+    std::string formatArg = "--benchmark_out_format=json";
+    if (!hasOut) {
+        args.push_back(outArg.data());
+        args.push_back(formatArg.data());
+    }
+    int count = static_cast<int>(args.size());
+    benchmark::Initialize(&count, args.data());
+    if (benchmark::ReportUnrecognizedArguments(count, args.data())) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_RESTORE_SESSION_TEST_H
+#define POWERMGR_RESTORE_SESSION_TEST_H
+
+#include <atomic>
+#include <gtest/gtest.h>
+
+#include "power_mode_callback_stub.h"
+
+namespace OHOS {
+namespace PowerMgr {
+class PowerMgrRestoreSessionTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+
+    class PowerModeTestCallback : public PowerModeCallbackStub {
+    public:
+        PowerModeTestCallback() = default;
+        virtual ~PowerModeTestCallback() = default;
+        void OnPowerModeChanged(PowerMode mode) override;
+
+        std::atomic<int32_t> changedCount {0};
+    };
+};
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWERMGR_RESTORE_SESSION_TEST_H
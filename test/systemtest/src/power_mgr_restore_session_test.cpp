@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "power_mgr_restore_session_test.h"
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include <if_system_ability_manager.h>
+#include <iservice_registry.h>
+#include <system_ability_definition.h>
+
+#include "power_log.h"
+#include "power_mgr_client.h"
+#include "running_lock.h"
+#include "running_lock_info.h"
+
+using namespace testing::ext;
+using namespace OHOS::PowerMgr;
+using namespace OHOS;
+using namespace std;
+
+namespace {
+constexpr int32_t LOCK_NUM = 64;
+constexpr int32_t WORKER_NUM = 4;
+constexpr int32_t WAIT_SERVICE_MS = 10000;
+constexpr int32_t WAIT_RESTORE_MS = 5000;
+constexpr int32_t POLL_INTERVAL_MS = 100;
+
+bool WaitFor(const std::function<bool()>& condition, int32_t timeoutMs)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (condition()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(POLL_INTERVAL_MS));
+    }
+    return condition();
+}
+
+sptr<IRemoteObject> CheckPowerService()
+{
+    sptr<ISystemAbilityManager> sam = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
+    return sam == nullptr ? nullptr : sam->CheckSystemAbility(POWER_MANAGER_SERVICE_ID);
+}
+
+// kill the service process and wait until init has started a new instance
+bool RestartPowerService()
+{
+    sptr<IRemoteObject> oldService = CheckPowerService();
+    std::system("kill -9 $(pidof powermgr)");
+    return WaitFor([&oldService]() {
+        sptr<IRemoteObject> service = CheckPowerService();
+        return service != nullptr && service != oldService;
+    }, WAIT_SERVICE_MS);
+}
+} // namespace
+
+void PowerMgrRestoreSessionTest::PowerModeTestCallback::OnPowerModeChanged(PowerMode mode)
+{
+    POWER_HILOGI(LABEL_TEST, "OnPowerModeChanged mode=%{public}u", static_cast<uint32_t>(mode));
+    changedCount++;
+}
+
+void PowerMgrRestoreSessionTest::SetUpTestCase(void)
+{
+    ASSERT_TRUE(WaitFor([]() { return CheckPowerService() != nullptr; }, WAIT_SERVICE_MS));
+}
+
+void PowerMgrRestoreSessionTest::TearDownTestCase(void)
+{
+    PowerMgrClient::GetInstance().SetDeviceMode(PowerMode::NORMAL_MODE);
+}
+
+namespace {
+/**
+ * @tc.name: PowerMgrRestoreSession001
+ * @tc.desc: the running locks of the process are restored after the service restarts under load
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerMgrRestoreSessionTest, PowerMgrRestoreSession001, TestSize.Level2)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerMgrRestoreSession001 function start!");
+    auto& powerMgrClient = PowerMgrClient::GetInstance();
+    std::vector<std::shared_ptr<RunningLock>> locks;
+    for (int32_t index = 0; index < LOCK_NUM; index++) {
+        auto runningLock = powerMgrClient.CreateRunningLock(
+            "restore_session_" + std::to_string(index), RunningLockType::RUNNINGLOCK_BACKGROUND);
+        ASSERT_TRUE(runningLock != nullptr);
+        locks.push_back(runningLock);
+    }
+
+    // keep the client busy while the service goes away and comes back
+    std::atomic_bool running {true};
+    std::vector<std::thread> workers;
+    for (int32_t worker = 0; worker < WORKER_NUM; worker++) {
+        workers.emplace_back([&locks, &running, worker]() {
+            for (size_t index = worker; running.load(); index = (index + WORKER_NUM) % locks.size()) {
+                locks[index]->Lock();
+                locks[index]->UnLock();
+            }
+        });
+    }
+    EXPECT_TRUE(RestartPowerService());
+    bool restored = WaitFor([&powerMgrClient]() {
+        std::map<std::string, RunningLockInfo> lockLists;
+        powerMgrClient.QueryRunningLockLists(lockLists);
+        int32_t found = 0;
+        for (const auto& item : lockLists) {
+            if (item.second.name.find("restore_session_") == 0) {
+                found++;
+            }
+        }
+        return found == LOCK_NUM;
+    }, WAIT_RESTORE_MS);
+    running.store(false);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    EXPECT_TRUE(restored);
+    EXPECT_EQ(locks[0]->Lock(), ERR_OK);
+    EXPECT_TRUE(locks[0]->IsUsed());
+    EXPECT_EQ(locks[0]->UnLock(), ERR_OK);
+    POWER_HILOGI(LABEL_TEST, "PowerMgrRestoreSession001 function end!");
+}
+
+/**
+ * @tc.name: PowerMgrRestoreSession002
+ * @tc.desc: the callback registrations of the process are restored after the service restarts
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerMgrRestoreSessionTest, PowerMgrRestoreSession002, TestSize.Level2)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerMgrRestoreSession002 function start!");
+    auto& powerMgrClient = PowerMgrClient::GetInstance();
+    sptr<PowerModeTestCallback> callback = new PowerModeTestCallback();
+    ASSERT_TRUE(powerMgrClient.RegisterPowerModeCallback(callback));
+    EXPECT_TRUE(RestartPowerService());
+    // the restore is delayed by the jitter, keep switching until the callback is back
+    PowerMode mode = PowerMode::NORMAL_MODE;
+    bool restored = WaitFor([&powerMgrClient, &callback, &mode]() {
+        mode = mode == PowerMode::NORMAL_MODE ? PowerMode::POWER_SAVE_MODE : PowerMode::NORMAL_MODE;
+        powerMgrClient.SetDeviceMode(mode);
+        return callback->changedCount.load() > 0;
+    }, WAIT_RESTORE_MS);
+    EXPECT_TRUE(restored);
+    EXPECT_TRUE(powerMgrClient.UnRegisterPowerModeCallback(callback));
+    POWER_HILOGI(LABEL_TEST, "PowerMgrRestoreSession002 function end!");
+}
+} // namespace
@@ -45,6 +45,22 @@ public:
     virtual ~PowerRunningLockTestCallback() {};
     virtual void HandleRunningLockMessage(std::string message) override;
 };
+class PowerRunningLockBatchTestCallback : public PowerRunningLockCallbackStub {
+public:
+    PowerRunningLockBatchTestCallback() {};
+    virtual ~PowerRunningLockBatchTestCallback() {};
+    virtual void HandleRunningLockChanges(
+        const std::vector<RunningLockChangeRecord>& records, uint32_t droppedCount) override
+    {
+        batchCount_++;
+        droppedCount_ += droppedCount;
+        records_.insert(records_.end(), records.begin(), records.end());
+    }
+
+    uint32_t batchCount_ {0};
+    uint32_t droppedCount_ {0};
+    std::vector<RunningLockChangeRecord> records_;
+};
 } // namespace PowerMgr
 } // namespace OHOS
 #endif // POWERMGR_RUNNING_LOCK_NATIVE_TEST_H
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <power_log.h>
+
+#include "activity_coalescer.h"
+
+namespace OHOS {
+namespace PowerMgr {
+using namespace testing;
+using namespace ext;
+namespace {
+constexpr int64_t INTERVAL_MS = 100;
+constexpr int64_t START_MS = 1000;
+} // namespace
+
+class ActivityCoalescerTest : public Test {
+public:
+    void SetUp()
+    {
+        intervalMs_ = INTERVAL_MS;
+        serial_ = 0;
+        coalescer_ = std::make_unique<ActivityCoalescer>(
+            [this]() { return intervalMs_; }, [this]() { return serial_; });
+    }
+    void TearDown()
+    {
+        coalescer_.reset();
+    }
+
+    // a refresh as PowerMgrClient sends it, true if it reached the service
+    bool Refresh(int64_t nowMs, bool accepted = true)
+    {
+        uint64_t serial = 0;
+        if (!coalescer_->ShouldSend(nowMs, serial)) {
+            return false;
+        }
+        if (accepted) {
+            coalescer_->OnAccepted(nowMs, serial);
+        }
+        return true;
+    }
+
+protected:
+    int64_t intervalMs_ {INTERVAL_MS};
+    uint64_t serial_ {0};
+    std::unique_ptr<ActivityCoalescer> coalescer_;
+};
+
+namespace {
+/**
+ * @tc.name: ActivityCoalescerTest001
+ * @tc.desc: At most one refresh per published interval reaches the service
+ * @tc.type: FUNC
+ */
+HWTEST_F(ActivityCoalescerTest, ActivityCoalescerTest001, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "ActivityCoalescerTest001 function start!");
+    EXPECT_TRUE(Refresh(START_MS));
+    EXPECT_FALSE(Refresh(START_MS + 1));
+    EXPECT_FALSE(Refresh(START_MS + INTERVAL_MS - 1));
+    EXPECT_TRUE(Refresh(START_MS + INTERVAL_MS));
+    EXPECT_EQ(coalescer_->GetCoalescedCount(), 2);
+
+    // the interval follows the parameter published by the service
+    intervalMs_ = INTERVAL_MS / 2;
+    EXPECT_TRUE(Refresh(START_MS + INTERVAL_MS + INTERVAL_MS / 2));
+    intervalMs_ = 0;
+    EXPECT_TRUE(Refresh(START_MS + INTERVAL_MS + INTERVAL_MS / 2 + 1));
+    POWER_HILOGI(LABEL_TEST, "ActivityCoalescerTest001 function end!");
+}
+
+/**
+ * @tc.name: ActivityCoalescerTest002
+ * @tc.desc: The first refresh after a power state change is always sent
+ * @tc.type: FUNC
+ */
+HWTEST_F(ActivityCoalescerTest, ActivityCoalescerTest002, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "ActivityCoalescerTest002 function start!");
+    EXPECT_TRUE(Refresh(START_MS));
+    serial_++;
+    EXPECT_TRUE(Refresh(START_MS + 1));
+    EXPECT_FALSE(Refresh(START_MS + 2));
+    POWER_HILOGI(LABEL_TEST, "ActivityCoalescerTest002 function end!");
+}
+
+/**
+ * @tc.name: ActivityCoalescerTest003
+ * @tc.desc: Refreshes the service refused do not open a coalescing window
+ * @tc.type: FUNC
+ */
+HWTEST_F(ActivityCoalescerTest, ActivityCoalescerTest003, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "ActivityCoalescerTest003 function start!");
+    EXPECT_TRUE(Refresh(START_MS, false));
+    EXPECT_TRUE(Refresh(START_MS + 1, false));
+    EXPECT_TRUE(Refresh(START_MS + 2));
+    EXPECT_FALSE(Refresh(START_MS + 3));
+    // a clock going backwards never blocks a refresh
+    EXPECT_TRUE(Refresh(START_MS - 1));
+    EXPECT_EQ(coalescer_->GetCoalescedCount(), 1);
+    POWER_HILOGI(LABEL_TEST, "ActivityCoalescerTest003 function end!");
+}
+} // namespace
+} // namespace PowerMgr
+} // namespace OHOS
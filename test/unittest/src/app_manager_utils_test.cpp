@@ -15,7 +15,10 @@
 
 #include "app_manager_utils_test.h"
 
+#include <app_mgr_constants.h>
+
 #include "app_manager_utils.h"
+#include "foreground_app_tracker.h"
 #include "power_log.h"
 
 namespace OHOS {
@@ -23,6 +26,16 @@ namespace PowerMgr {
 using namespace OHOS::AppExecFwk;
 using namespace testing;
 using namespace testing::ext;
+namespace {
+AppStateData MakeAppStateData(int32_t uid, const std::string& bundleName, ApplicationState state)
+{
+    AppStateData appStateData;
+    appStateData.uid = uid;
+    appStateData.bundleName = bundleName;
+    appStateData.state = static_cast<int32_t>(state);
+    return appStateData;
+}
+} // namespace
 
 /**
  * @tc.name: AppManagerUtilsTest001
@@ -67,5 +80,63 @@ HWTEST_F(AppManagerUtilsTest, AppManagerUtilsTest003, TestSize.Level0)
     EXPECT_FALSE(bundleNames.size() > 5);
     POWER_HILOGI(LABEL_TEST, "AppManagerUtilsTest003 function end!");
 }
+
+/**
+ * @tc.name: AppManagerUtilsTest004
+ * @tc.desc: test ForegroundAppTracker follows the foreground changes
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppManagerUtilsTest, AppManagerUtilsTest004, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "AppManagerUtilsTest004 function start!");
+    sptr<ForegroundAppTracker> tracker = new ForegroundAppTracker();
+    EXPECT_FALSE(tracker->IsReady());
+    tracker->OnForegroundApplicationChanged(
+        MakeAppStateData(20010001, "com.example.voice", ApplicationState::APP_STATE_FOREGROUND));
+    tracker->OnForegroundApplicationChanged(
+        MakeAppStateData(20010002, "com.example.video", ApplicationState::APP_STATE_FOCUS));
+    EXPECT_TRUE(tracker->IsForeground("com.example.voice"));
+    EXPECT_TRUE(tracker->IsForegroundUid(20010002));
+    EXPECT_TRUE(tracker->IsAnyForeground({"com.example.unknown", "com.example.video"}));
+    EXPECT_EQ(tracker->GetCount(), 2U);
+
+    tracker->OnForegroundApplicationChanged(
+        MakeAppStateData(20010001, "com.example.voice", ApplicationState::APP_STATE_BACKGROUND));
+    tracker->OnAppStopped(MakeAppStateData(20010002, "com.example.video", ApplicationState::APP_STATE_TERMINATED));
+    EXPECT_FALSE(tracker->IsForeground("com.example.voice"));
+    EXPECT_FALSE(tracker->IsAnyForeground({"com.example.voice", "com.example.video"}));
+    EXPECT_EQ(tracker->GetCount(), 0U);
+    POWER_HILOGI(LABEL_TEST, "AppManagerUtilsTest004 function end!");
+}
+
+/**
+ * @tc.name: AppManagerUtilsTest005
+ * @tc.desc: test ForegroundAppTracker keeps a bundle running as several uids until all of them left
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppManagerUtilsTest, AppManagerUtilsTest005, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "AppManagerUtilsTest005 function start!");
+    sptr<ForegroundAppTracker> tracker = new ForegroundAppTracker();
+    tracker->OnForegroundApplicationChanged(
+        MakeAppStateData(20010001, "com.example.voice", ApplicationState::APP_STATE_FOREGROUND));
+    tracker->OnForegroundApplicationChanged(
+        MakeAppStateData(20010001, "com.example.voice", ApplicationState::APP_STATE_FOREGROUND));
+    tracker->OnForegroundApplicationChanged(
+        MakeAppStateData(20110001, "com.example.voice", ApplicationState::APP_STATE_FOREGROUND));
+    std::set<std::string> bundleNames;
+    tracker->GetBundleNames(bundleNames);
+    EXPECT_EQ(bundleNames.size(), 1U);
+
+    tracker->OnForegroundApplicationChanged(
+        MakeAppStateData(20010001, "com.example.voice", ApplicationState::APP_STATE_BACKGROUND));
+    EXPECT_TRUE(tracker->IsForeground("com.example.voice"));
+    tracker->OnAppStopped(MakeAppStateData(20110001, "com.example.voice", ApplicationState::APP_STATE_TERMINATED));
+    EXPECT_FALSE(tracker->IsForeground("com.example.voice"));
+
+    tracker->Stop();
+    EXPECT_FALSE(tracker->IsReady());
+    POWER_HILOGI(LABEL_TEST, "AppManagerUtilsTest005 function end!");
+}
 } // PowerMgr
 } // OHOS
\ No newline at end of file
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cinttypes>
+#include <mutex>
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include "hdi_running_lock_queue.h"
+#include "power_log.h"
+
+namespace OHOS {
+namespace PowerMgr {
+using namespace testing;
+using namespace ext;
+namespace {
+/**
+ * Stands in for the HoldRunningLockExt/UnholdRunningLockExt calls of the power HDI, the set of
+ * held locks is what the kernel would see.
+ */
+class FakePowerInterface {
+public:
+    int32_t HoldRunningLockExt(const RunningLockParam& param)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        callCount_++;
+        if (holdResult_ == RUNNINGLOCK_SUCCESS) {
+            held_.insert(param.lockid);
+        }
+        return holdResult_;
+    }
+
+    int32_t UnholdRunningLockExt(const RunningLockParam& param)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        held_.erase(param.lockid);
+        callCount_++;
+        return RUNNINGLOCK_SUCCESS;
+    }
+
+    bool IsHeld(uint64_t lockid)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return held_.count(lockid) != 0;
+    }
+
+    uint32_t GetCallCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return callCount_;
+    }
+
+    void SetHoldResult(int32_t result)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        holdResult_ = result;
+    }
+
+private:
+    std::mutex mutex_;
+    int32_t holdResult_ {RUNNINGLOCK_SUCCESS};
+    std::set<uint64_t> held_;
+    uint32_t callCount_ {0};
+};
+
+std::unique_ptr<HdiRunningLockQueue> MakeQueue(FakePowerInterface& fake)
+{
+    return std::make_unique<HdiRunningLockQueue>(
+        [&fake](const RunningLockParam& param) { return fake.HoldRunningLockExt(param); },
+        [&fake](const RunningLockParam& param) { return fake.UnholdRunningLockExt(param); });
+}
+
+RunningLockParam MakeParam(uint64_t lockid)
+{
+    RunningLockParam param;
+    param.lockid = lockid;
+    param.name = "hdi_queue_test_" + std::to_string(lockid);
+    param.type = RunningLockType::RUNNINGLOCK_BACKGROUND_TASK;
+    return param;
+}
+} // namespace
+
+class HdiRunningLockQueueTest : public Test {};
+
+namespace {
+/**
+ * @tc.name: HdiRunningLockQueueTest001
+ * @tc.desc: test pending hold/unhold pairs cancel out and the rest is applied in order
+ * @tc.type: FUNC
+ */
+HWTEST_F(HdiRunningLockQueueTest, HdiRunningLockQueueTest001, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "HdiRunningLockQueueTest001 function start!");
+    FakePowerInterface fake;
+    auto queue = MakeQueue(fake);
+    queue->Drain();
+    uint64_t coalesced = queue->GetCoalescedCount();
+
+    EXPECT_EQ(queue->Hold(MakeParam(1)), RUNNINGLOCK_SUCCESS);
+    EXPECT_EQ(queue->Unhold(MakeParam(1)), RUNNINGLOCK_SUCCESS);
+    EXPECT_EQ(queue->Hold(MakeParam(2)), RUNNINGLOCK_SUCCESS);
+    queue->Drain();
+    EXPECT_FALSE(fake.IsHeld(1));
+    EXPECT_TRUE(fake.IsHeld(2));
+    EXPECT_EQ(queue->GetPendingCount(), 0);
+
+    uint32_t callCount = fake.GetCallCount();
+    queue->Unhold(MakeParam(2));
+    queue->Hold(MakeParam(2));
+    queue->Drain();
+    // the lock never left the kernel
+    EXPECT_TRUE(fake.IsHeld(2));
+    EXPECT_GE(queue->GetCoalescedCount(), coalesced + 1);
+    EXPECT_LE(fake.GetCallCount(), callCount);
+    POWER_HILOGI(LABEL_TEST, "HdiRunningLockQueueTest001 function end!");
+}
+
+/**
+ * @tc.name: HdiRunningLockQueueTest002
+ * @tc.desc: test holds reach the HDI before returning once the HDI may suspend
+ * @tc.type: FUNC
+ */
+HWTEST_F(HdiRunningLockQueueTest, HdiRunningLockQueueTest002, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "HdiRunningLockQueueTest002 function start!");
+    FakePowerInterface fake;
+    auto queue = MakeQueue(fake);
+    queue->Hold(MakeParam(1));
+    queue->Hold(MakeParam(2));
+    queue->SetSynchronous(true);
+    EXPECT_TRUE(queue->IsSynchronous());
+    EXPECT_EQ(queue->GetPendingCount(), 0);
+    EXPECT_TRUE(fake.IsHeld(1));
+    EXPECT_TRUE(fake.IsHeld(2));
+
+    queue->Hold(MakeParam(3));
+    EXPECT_TRUE(fake.IsHeld(3));
+    // a deferred unhold followed by a hold keeps the lock held
+    queue->Unhold(MakeParam(3));
+    queue->Hold(MakeParam(3));
+    queue->Drain();
+    EXPECT_TRUE(fake.IsHeld(3));
+
+    queue->SetSynchronous(false);
+    queue->Unhold(MakeParam(1));
+    queue->Drain();
+    EXPECT_FALSE(fake.IsHeld(1));
+    POWER_HILOGI(LABEL_TEST, "HdiRunningLockQueueTest002 function end!");
+}
+
+/**
+ * @tc.name: HdiRunningLockQueueTest003
+ * @tc.desc: test the pending lock/unlock pairs never reach the HDI
+ * @tc.type: FUNC
+ */
+HWTEST_F(HdiRunningLockQueueTest, HdiRunningLockQueueTest003, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "HdiRunningLockQueueTest003 function start!");
+    constexpr uint64_t loopCount = 500;
+    FakePowerInterface directFake;
+    for (uint64_t index = 0; index < loopCount; index++) {
+        directFake.HoldRunningLockExt(MakeParam(index));
+        directFake.UnholdRunningLockExt(MakeParam(index));
+    }
+
+    FakePowerInterface queuedFake;
+    auto queue = MakeQueue(queuedFake);
+    for (uint64_t index = 0; index < loopCount; index++) {
+        queue->Hold(MakeParam(index));
+        queue->Unhold(MakeParam(index));
+    }
+    queue->Drain();
+
+    POWER_HILOGI(LABEL_TEST, "lock/unlock x%{public}" PRIu64 ": direct calls=%{public}u, queued calls=%{public}u, "
+        "coalesced=%{public}" PRIu64, loopCount, directFake.GetCallCount(), queuedFake.GetCallCount(),
+        queue->GetCoalescedCount());
+    EXPECT_EQ(directFake.GetCallCount(), 2 * loopCount);
+    // every pair that was still pending when its unhold came costs no HDI call
+    EXPECT_EQ(queuedFake.GetCallCount() + 2 * queue->GetCoalescedCount(), 2 * loopCount);
+    EXPECT_LT(queuedFake.GetCallCount(), directFake.GetCallCount());
+    for (uint64_t index = 0; index < loopCount; index++) {
+        EXPECT_FALSE(queuedFake.IsHeld(index));
+    }
+    POWER_HILOGI(LABEL_TEST, "HdiRunningLockQueueTest003 function end!");
+}
+
+/**
+ * @tc.name: HdiRunningLockQueueTest004
+ * @tc.desc: test a deferred hold the HDI rejected is kept, tried again and makes later holds synchronous
+ * @tc.type: FUNC
+ */
+HWTEST_F(HdiRunningLockQueueTest, HdiRunningLockQueueTest004, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "HdiRunningLockQueueTest004 function start!");
+    FakePowerInterface fake;
+    auto queue = MakeQueue(fake);
+    fake.SetHoldResult(RUNNINGLOCK_FAILURE);
+    EXPECT_EQ(queue->Hold(MakeParam(1)), RUNNINGLOCK_SUCCESS);
+    queue->Drain();
+    EXPECT_FALSE(fake.IsHeld(1));
+    EXPECT_EQ(queue->GetFailedHoldCount(), 1);
+
+    // the caller of a synchronous hold gets the failure, the lock is not tried again
+    EXPECT_EQ(queue->Hold(MakeParam(2)), RUNNINGLOCK_FAILURE);
+    EXPECT_EQ(queue->GetFailedHoldCount(), 1);
+
+    fake.SetHoldResult(RUNNINGLOCK_SUCCESS);
+    queue->SetSynchronous(true);
+    EXPECT_EQ(queue->GetFailedHoldCount(), 0);
+    EXPECT_TRUE(fake.IsHeld(1));
+    EXPECT_FALSE(fake.IsHeld(2));
+    queue->SetSynchronous(false);
+
+    // an unhold of a lock the HDI never got is not sent
+    fake.SetHoldResult(RUNNINGLOCK_FAILURE);
+    queue->Hold(MakeParam(3));
+    queue->Drain();
+    uint32_t callCount = fake.GetCallCount();
+    EXPECT_EQ(queue->Unhold(MakeParam(3)), RUNNINGLOCK_SUCCESS);
+    EXPECT_EQ(queue->GetFailedHoldCount(), 0);
+    EXPECT_EQ(queue->GetPendingCount(), 0);
+    queue->Drain();
+    EXPECT_EQ(fake.GetCallCount(), callCount);
+    POWER_HILOGI(LABEL_TEST, "HdiRunningLockQueueTest004 function end!");
+}
+} // namespace
+} // namespace PowerMgr
+} // namespace OHOS
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+#include <power_log.h>
+
+#include "hibernate_memory_reclaimer.h"
+
+namespace OHOS {
+namespace PowerMgr {
+using namespace testing;
+using namespace ext;
+
+// a procfs tree with the meminfo the reclaimer reads, the steps are recorded instead of run by init
+class HibernateMemoryReclaimerTest : public Test {
+public:
+    static constexpr const char* MEMCG_RECLAIM_PATH = "/memory.reclaim";
+
+    void SetUp()
+    {
+        char root[] = "/data/local/tmp/hibernate_reclaimXXXXXX";
+        char* dir = mkdtemp(root);
+        ASSERT_NE(dir, nullptr);
+        root_ = dir;
+        mkdir((root_ + "/proc").c_str(), S_IRWXU);
+        std::ofstream(root_ + MEMCG_RECLAIM_PATH);
+        SetFreeKb(FREE_KB);
+        steps_.clear();
+        memcgAmountKb_ = 0;
+        reclaimer_ = std::make_unique<HibernateMemoryReclaimer>(root_,
+            [this](const std::string& step, int64_t amountKb) {
+                usleep(stepUs_);
+                std::lock_guard<std::mutex> lock(mutex_);
+                steps_.push_back(step);
+                if (step == HibernateMemoryReclaimer::STEP_MEMCG_RECLAIM) {
+                    memcgAmountKb_ = amountKb;
+                }
+                return true;
+            });
+    }
+    void TearDown()
+    {
+        reclaimer_.reset();
+        std::string command = "rm -rf " + root_;
+        system(command.c_str());
+    }
+
+    void SetFreeKb(int64_t freeKb)
+    {
+        std::ofstream file(root_ + "/proc/meminfo", std::ios::trunc);
+        file << "MemTotal:        8000000 kB\nMemFree:         " << freeKb <<
+            " kB\nHugePages_Total:       0\nMemAvailable:    4000000 kB\n";
+    }
+    std::vector<std::string> GetSteps()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return steps_;
+    }
+    int64_t GetMemcgAmountKb()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return memcgAmountKb_;
+    }
+
+protected:
+    static constexpr int64_t FREE_KB = 1000000;
+    std::string root_;
+    useconds_t stepUs_ {0};
+    std::mutex mutex_;
+    std::vector<std::string> steps_;
+    int64_t memcgAmountKb_ {0};
+    std::unique_ptr<HibernateMemoryReclaimer> reclaimer_;
+};
+
+namespace {
+constexpr int64_t TARGET_KB = 50000;
+constexpr useconds_t CALLBACK_US = 100000;
+
+HibernateReclaimConfig MakeConfig(int64_t targetKb, uint32_t finishTimeoutMs)
+{
+    HibernateReclaimConfig config;
+    config.memcgReclaimPath = HibernateMemoryReclaimerTest::MEMCG_RECLAIM_PATH;
+    config.steps = HibernateMemoryReclaimer::ParseSteps("drop_caches,compact,memcg_reclaim");
+    config.targetKb = targetKb;
+    config.finishTimeoutMs = finishTimeoutMs;
+    return config;
+}
+
+/**
+ * @tc.name: HibernateMemoryReclaimerTest001
+ * @tc.desc: Without a target every step runs once, memcg reclaim waits for the callbacks
+ * @tc.type: FUNC
+ */
+HWTEST_F(HibernateMemoryReclaimerTest, HibernateMemoryReclaimerTest001, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "HibernateMemoryReclaimerTest001 function start!");
+    EXPECT_EQ(reclaimer_->ReadFreeKb(), FREE_KB);
+    reclaimer_->Start(MakeConfig(0, 1000));
+    usleep(CALLBACK_US);
+    EXPECT_TRUE(reclaimer_->IsRunning());
+    EXPECT_EQ(GetSteps(), std::vector<std::string>({"drop_caches", "compact"}));
+
+    // the callbacks returned, the pass completes before Finish is called
+    reclaimer_->OnCallbacksDone();
+    usleep(CALLBACK_US);
+    EXPECT_FALSE(reclaimer_->IsRunning());
+    EXPECT_EQ(GetSteps(), std::vector<std::string>({"drop_caches", "compact", "memcg_reclaim"}));
+
+    HibernateReclaimReport report = reclaimer_->Finish();
+    EXPECT_FALSE(report.targetMet);
+    ASSERT_EQ(report.steps.size(), 3);
+    EXPECT_EQ(report.steps[2].name, HibernateMemoryReclaimer::STEP_MEMCG_RECLAIM);
+    EXPECT_TRUE(report.steps[2].succeeded);
+    EXPECT_EQ(report.failedSteps, 0);
+    // without a target memcg reclaim is asked for all of MemTotal
+    EXPECT_EQ(GetMemcgAmountKb(), 8000000);
+    POWER_HILOGI(LABEL_TEST, "HibernateMemoryReclaimerTest001 function end!");
+}
+
+/**
+ * @tc.name: HibernateMemoryReclaimerTest002
+ * @tc.desc: The reclaim ends as soon as the target is met
+ * @tc.type: FUNC
+ */
+HWTEST_F(HibernateMemoryReclaimerTest, HibernateMemoryReclaimerTest002, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "HibernateMemoryReclaimerTest002 function start!");
+    reclaimer_->Start(MakeConfig(TARGET_KB, 5000));
+    SetFreeKb(FREE_KB + TARGET_KB);
+    HibernateReclaimReport report = reclaimer_->Finish();
+    EXPECT_TRUE(report.targetMet);
+    EXPECT_EQ(report.reclaimedKb, TARGET_KB);
+    ASSERT_FALSE(report.steps.empty());
+    EXPECT_LE(report.steps.size(), 3);
+    POWER_HILOGI(LABEL_TEST, "HibernateMemoryReclaimerTest002 function end!");
+}
+
+/**
+ * @tc.name: HibernateMemoryReclaimerTest003
+ * @tc.desc: A target that is never met repeats the passes until the finish timeout
+ * @tc.type: FUNC
+ */
+HWTEST_F(HibernateMemoryReclaimerTest, HibernateMemoryReclaimerTest003, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "HibernateMemoryReclaimerTest003 function start!");
+    constexpr uint32_t finishTimeoutMs = HibernateMemoryReclaimer::PASS_INTERVAL_MS * 3;
+    reclaimer_->Start(MakeConfig(TARGET_KB, finishTimeoutMs));
+    HibernateReclaimReport report = reclaimer_->Finish();
+    EXPECT_FALSE(report.targetMet);
+    EXPECT_EQ(report.reclaimedKb, 0);
+    // the first pass, then drop_caches and memcg_reclaim again
+    EXPECT_GE(report.steps.size(), 5);
+    EXPECT_FALSE(reclaimer_->IsRunning());
+    EXPECT_EQ(GetMemcgAmountKb(), TARGET_KB);
+
+    std::vector<std::string> steps = HibernateMemoryReclaimer::ParseSteps("compact,,unknown,memcg_reclaim");
+    EXPECT_EQ(steps, std::vector<std::string>({"compact", "memcg_reclaim"}));
+    POWER_HILOGI(LABEL_TEST, "HibernateMemoryReclaimerTest003 function end!");
+}
+
+/**
+ * @tc.name: HibernateMemoryReclaimerTest004
+ * @tc.desc: Finish waits no longer than its timeout, the step being run ends the reclaim, as Stop does
+ * @tc.type: FUNC
+ */
+HWTEST_F(HibernateMemoryReclaimerTest, HibernateMemoryReclaimerTest004, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "HibernateMemoryReclaimerTest004 function start!");
+    stepUs_ = CALLBACK_US;
+    reclaimer_->Start(MakeConfig(0, 0));
+    HibernateReclaimReport report = reclaimer_->Finish();
+    EXPECT_LT(report.steps.size(), 3);
+    EXPECT_FALSE(reclaimer_->IsRunning());
+
+    size_t count = GetSteps().size();
+    reclaimer_->Start(MakeConfig(0, 0));
+    usleep(CALLBACK_US / 2);
+    reclaimer_->Stop();
+    EXPECT_FALSE(reclaimer_->IsRunning());
+    EXPECT_LE(GetSteps().size(), count + 1);
+    POWER_HILOGI(LABEL_TEST, "HibernateMemoryReclaimerTest004 function end!");
+}
+
+/**
+ * @tc.name: HibernateMemoryReclaimerTest005
+ * @tc.desc: Memcg reclaim fails without memory.reclaim and is counted in the report
+ * @tc.type: FUNC
+ */
+HWTEST_F(HibernateMemoryReclaimerTest, HibernateMemoryReclaimerTest005, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "HibernateMemoryReclaimerTest005 function start!");
+    HibernateReclaimConfig config = MakeConfig(0, 1000);
+    config.memcgReclaimPath = "/missing/memory.reclaim";
+    reclaimer_->Start(config);
+    reclaimer_->OnCallbacksDone();
+    HibernateReclaimReport report = reclaimer_->Finish();
+    ASSERT_EQ(report.steps.size(), 3);
+    EXPECT_TRUE(report.steps[0].succeeded);
+    EXPECT_FALSE(report.steps[2].succeeded);
+    EXPECT_EQ(report.failedSteps, 1);
+    // the runner is not asked to write a file that does not exist
+    EXPECT_EQ(GetSteps(), std::vector<std::string>({"drop_caches", "compact"}));
+    POWER_HILOGI(LABEL_TEST, "HibernateMemoryReclaimerTest005 function end!");
+}
+} // namespace
+} // namespace PowerMgr
+} // namespace OHOS
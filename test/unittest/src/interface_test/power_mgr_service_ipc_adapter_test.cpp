@@ -308,6 +308,10 @@ public:
     {
         return PowerErrors::ERR_OK;
     }
+    PowerErrors RestoreSession(const PowerRestoreSession& session)
+    {
+        return PowerErrors::ERR_OK;
+    }
 };
 
 class TestTakeOverSuspendCallback : public ITakeOverSuspendCallback {
@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 #include <system_ability_definition.h>
+#include <unistd.h>
 
 #include "accesstoken_kit.h"
 #include "mock_accesstoken_kit.h"
@@ -32,6 +33,8 @@
 
 #include "setting_observer.h"
 #include "sysparam.h"
+#include "sysparam_cache.h"
+#include "syspara/parameter.h"
 #include "tokenid_kit.h"
 
 using namespace OHOS::Security::AccessToken;
@@ -387,6 +390,72 @@ HWTEST_F (PowerMgrUtilTest, Sysparam001, TestSize.Level0)
     POWER_HILOGI(LABEL_TEST, "Sysparam001 function end!");
 }
 
+/**
+ * @tc.name: Sysparam002
+ * @tc.desc: test SysParamCache follows the parameter it watches
+ * @tc.type: FUNC
+ */
+HWTEST_F (PowerMgrUtilTest, Sysparam002, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "Sysparam002 function start!");
+    constexpr int32_t def = 100;
+    constexpr int32_t retryTimes = 50;
+    constexpr int32_t retryIntervalUs = 20000;
+    static IntSysParam constParam("const.power.sysparam_cache_test", def);
+    EXPECT_EQ(constParam.Get(), def);
+    EXPECT_FALSE(constParam.IsWatching());
+
+    static BoolSysParam boolParam("debug.power.sysparam_cache_test", false);
+    SetParameter(boolParam.GetKey().c_str(), "false");
+    EXPECT_FALSE(boolParam.Get());
+    if (boolParam.IsWatching()) {
+        SetParameter(boolParam.GetKey().c_str(), "true");
+        for (int32_t count = 0; count < retryTimes && !boolParam.Get(); count++) {
+            usleep(retryIntervalUs);
+        }
+        EXPECT_TRUE(boolParam.Get());
+        SetParameter(boolParam.GetKey().c_str(), "invalid");
+        for (int32_t count = 0; count < retryTimes && boolParam.Get(); count++) {
+            usleep(retryIntervalUs);
+        }
+        EXPECT_FALSE(boolParam.Get());
+    }
+    POWER_HILOGI(LABEL_TEST, "Sysparam002 function end!");
+}
+
+/**
+ * @tc.name: PowerLogBudget001
+ * @tc.desc: test a log call site prints its burst, then one line per interval with the dropped count
+ * @tc.type: FUNC
+ */
+HWTEST_F (PowerMgrUtilTest, PowerLogBudget001, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerLogBudget001 function start!");
+    constexpr int64_t intervalUs = 100000;
+    PowerLogBudgetConfig& config = PowerLogBudgetConfig::GetInstance();
+    EXPECT_TRUE(config.Apply("10/2"));
+    PowerLogBudget budget;
+    uint32_t suppressed = 0;
+    EXPECT_TRUE(budget.TryAcquire(0, suppressed));
+    EXPECT_TRUE(budget.TryAcquire(0, suppressed));
+    EXPECT_FALSE(budget.TryAcquire(0, suppressed));
+    EXPECT_FALSE(budget.TryAcquire(intervalUs / 2, suppressed));
+    EXPECT_TRUE(budget.TryAcquire(intervalUs, suppressed));
+    EXPECT_EQ(suppressed, 2);
+    EXPECT_FALSE(budget.TryAcquire(intervalUs, suppressed));
+
+    // a rate of 0 lifts the limit, malformed values restore the defaults
+    EXPECT_TRUE(config.Apply("0/1"));
+    EXPECT_TRUE(budget.TryAcquire(intervalUs, suppressed));
+    EXPECT_EQ(suppressed, 1);
+    EXPECT_TRUE(budget.TryAcquire(intervalUs, suppressed));
+    EXPECT_EQ(suppressed, 0);
+    EXPECT_FALSE(config.Apply("10"));
+    EXPECT_EQ(config.GetRate(), PowerLogBudgetConfig::DEFAULT_RATE);
+    EXPECT_EQ(config.GetBurst(), PowerLogBudgetConfig::DEFAULT_BURST);
+    POWER_HILOGI(LABEL_TEST, "PowerLogBudget001 function end!");
+}
+
 /**
  * @tc.name: PowerVibratorTest001
  * @tc.desc: test power vibrator
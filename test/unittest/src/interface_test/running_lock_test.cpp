@@ -15,12 +15,14 @@
 
 #include "running_lock_test.h"
 
+#include <algorithm>
 #include <ipc_skeleton.h>
 
 #include "actions/irunning_lock_action.h"
 #include "power_mgr_proxy.h"
 #include "power_mgr_service.h"
 #include "running_lock_mgr.h"
+#include "running_lock_registry.h"
 #include "power_log.h"
 
 using namespace testing::ext;
@@ -34,6 +36,7 @@ constexpr int32_t TEST_PROCESS_COUNT = 2000;
 constexpr int32_t US_PER_MS = 1000;
 constexpr int32_t app0Uid = 8;
 constexpr int32_t app1Uid = 9;
+constexpr int32_t REGISTRY_STRESS_COUNT = 2000000;
 }
 
 namespace {
@@ -620,4 +623,61 @@ HWTEST_F(RunningLockTest, RunningLockTest022, TestSize.Level1)
     EXPECT_EQ(result, ERR_INVALID_DATA);
     POWER_HILOGI(LABEL_TEST, "RunningLockTest022 function end!");
 }
+
+/**
+ * @tc.name: RunningLockTest023
+ * @tc.desc: Test the client registry tracks live locks only and drops them on destruction
+ * @tc.type: FUNC
+ */
+HWTEST_F(RunningLockTest, RunningLockTest023, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "RunningLockTest023 function start!");
+    auto& powerMgrClient = PowerMgrClient::GetInstance();
+    size_t baseCount = powerMgrClient.GetLiveRunningLockCount();
+    size_t baseScreenCount = powerMgrClient.GetLiveRunningLockCount(RunningLockType::RUNNINGLOCK_SCREEN);
+    auto runningLock1 = powerMgrClient.CreateRunningLock("registry1", RunningLockType::RUNNINGLOCK_SCREEN);
+    auto runningLock2 = powerMgrClient.CreateRunningLock("registry2", RunningLockType::RUNNINGLOCK_BACKGROUND);
+    ASSERT_TRUE(runningLock1 != nullptr && runningLock2 != nullptr);
+    EXPECT_EQ(powerMgrClient.GetLiveRunningLockCount(), baseCount + 2);
+    EXPECT_EQ(powerMgrClient.GetLiveRunningLockCount(RunningLockType::RUNNINGLOCK_SCREEN), baseScreenCount + 1);
+
+    runningLock1.reset();
+    EXPECT_EQ(powerMgrClient.GetLiveRunningLockCount(), baseCount + 1);
+    EXPECT_EQ(powerMgrClient.GetLiveRunningLockCount(RunningLockType::RUNNINGLOCK_SCREEN), baseScreenCount);
+    auto liveLocks = RunningLockRegistry::GetInstance().GetLiveLocks();
+    EXPECT_NE(std::find(liveLocks.begin(), liveLocks.end(), runningLock2), liveLocks.end());
+    liveLocks.clear();
+    powerMgrClient.RecoverRunningLocks();
+    runningLock2.reset();
+    EXPECT_EQ(powerMgrClient.GetLiveRunningLockCount(), baseCount);
+    POWER_HILOGI(LABEL_TEST, "RunningLockTest023 function end!");
+}
+
+/**
+ * @tc.name: RunningLockTest024
+ * @tc.desc: Memory regression, creating and destroying millions of locks must not grow the registry
+ * @tc.type: FUNC
+ */
+HWTEST_F(RunningLockTest, RunningLockTest024, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "RunningLockTest024 function start!");
+    auto& registry = RunningLockRegistry::GetInstance();
+    size_t baseCount = registry.GetLiveCount();
+    // locks without a proxy never reach the service, only the registry is exercised
+    wptr<IPowerMgr> noProxy;
+    auto keeper = std::make_shared<RunningLock>(noProxy, "registry_keeper", RunningLockType::RUNNINGLOCK_BACKGROUND);
+    registry.Add(keeper);
+    for (int32_t index = 0; index < REGISTRY_STRESS_COUNT; index++) {
+        auto runningLock =
+            std::make_shared<RunningLock>(noProxy, "registry_stress", RunningLockType::RUNNINGLOCK_BACKGROUND_TASK);
+        registry.Add(runningLock);
+        registry.Add(runningLock);
+    }
+    EXPECT_EQ(registry.GetLiveCount(), baseCount + 1);
+    EXPECT_EQ(registry.GetLiveCount(RunningLockType::RUNNINGLOCK_BACKGROUND_TASK), 0);
+    EXPECT_EQ(registry.GetLiveLocks().size(), baseCount + 1);
+    keeper.reset();
+    EXPECT_EQ(registry.GetLiveCount(), baseCount);
+    POWER_HILOGI(LABEL_TEST, "RunningLockTest024 function end!");
+}
 } // namespace
\ No newline at end of file
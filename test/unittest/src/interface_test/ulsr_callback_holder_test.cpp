@@ -15,7 +15,9 @@
 
 #include "ulsr_callback_holder_test.h"
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include "gtest/gtest.h"
 #include "power_common.h"
 #include "power_log.h"
@@ -83,6 +85,79 @@ public:
     sptr<IRemoteObject> AsObject() override { return nullptr; }
 };
 
+// In-memory ULSR result parameter
+class FakeUlsrResultSource : public UlsrResultSource {
+public:
+    std::string Read() override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return value_;
+    }
+    bool Watch(const Listener& listener) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        listener_ = listener;
+        watchCount_++;
+        return true;
+    }
+    void Write(const std::string& value)
+    {
+        Listener listener;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            value_ = value;
+            listener = listener_;
+        }
+        if (listener != nullptr) {
+            listener(value);
+        }
+    }
+    int32_t GetWatchCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return watchCount_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::string value_;
+    Listener listener_;
+    int32_t watchCount_ = 0;
+};
+
+// Records the results handed to WaitUlsrResult
+class UlsrResultRecorder {
+public:
+    UlsrCallbackHolder::ResultHandler GetHandler()
+    {
+        return [this](bool ulsrResult) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            results_.push_back(ulsrResult);
+            cv_.notify_all();
+        };
+    }
+    bool WaitForCount(size_t count, int64_t timeoutMs)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this, count]() {
+            return results_.size() >= count;
+        });
+    }
+    std::vector<bool> GetResults()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return results_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<bool> results_;
+};
+
+constexpr int64_t TEST_RESULT_TIMEOUT_MS = 100;
+constexpr int64_t TEST_WAIT_MS = 1000;
+
 // Test UlsrCallbackHolder with accessible internal state for coverage testing
 class UlsrCallbackHolderTestWrapper : public UlsrCallbackHolder {
 public:
@@ -1101,5 +1176,116 @@ HWTEST_F(UlsrCallbackHolderTest, UlsrCallbackHolderTest033, TestSize.Level2)
     POWER_HILOGI(LABEL_TEST, "UlsrCallbackHolderTest::UlsrCallbackHolderTest033 end!");
 }
 
+/**
+ * @tc.name: UlsrCallbackHolderTest034
+ * @tc.desc: Test WaitUlsrResult when the result is already written
+ * @tc.type: FUNC
+ */
+HWTEST_F(UlsrCallbackHolderTest, UlsrCallbackHolderTest034, TestSize.Level2)
+{
+    POWER_HILOGI(LABEL_TEST, "UlsrCallbackHolderTest::UlsrCallbackHolderTest034 start!");
+    auto source = std::make_unique<FakeUlsrResultSource>();
+    FakeUlsrResultSource* fakeSource = source.get();
+    sptr<UlsrCallbackHolder> holder = new UlsrCallbackHolder(std::move(source), TEST_RESULT_TIMEOUT_MS);
+    UlsrResultRecorder recorder;
+
+    // no ULSR in progress
+    EXPECT_FALSE(holder->WaitUlsrResult(recorder.GetHandler()));
+    EXPECT_EQ(fakeSource->GetWatchCount(), 0);
+
+    fakeSource->Write("success");
+    EXPECT_TRUE(holder->SyncUlsrNotify());
+    EXPECT_TRUE(holder->WaitUlsrResult(recorder.GetHandler()));
+    EXPECT_TRUE(recorder.WaitForCount(1, TEST_WAIT_MS));
+    EXPECT_EQ(recorder.GetResults(), std::vector<bool>({true}));
+    EXPECT_EQ(fakeSource->GetWatchCount(), 1);
+    POWER_HILOGI(LABEL_TEST, "UlsrCallbackHolderTest::UlsrCallbackHolderTest034 end!");
+}
+
+/**
+ * @tc.name: UlsrCallbackHolderTest035
+ * @tc.desc: Test WaitUlsrResult is completed by the parameter watcher
+ * @tc.type: FUNC
+ */
+HWTEST_F(UlsrCallbackHolderTest, UlsrCallbackHolderTest035, TestSize.Level2)
+{
+    POWER_HILOGI(LABEL_TEST, "UlsrCallbackHolderTest::UlsrCallbackHolderTest035 start!");
+    auto source = std::make_unique<FakeUlsrResultSource>();
+    FakeUlsrResultSource* fakeSource = source.get();
+    sptr<UlsrCallbackHolder> holder = new UlsrCallbackHolder(std::move(source), TEST_WAIT_MS);
+    UlsrResultRecorder recorder;
+
+    EXPECT_TRUE(holder->SyncUlsrNotify());
+    EXPECT_TRUE(holder->WaitUlsrResult(recorder.GetHandler()));
+    EXPECT_TRUE(holder->IsWaitingUlsrResult());
+    // a second wakeup while waiting is dropped
+    EXPECT_FALSE(holder->WaitUlsrResult(recorder.GetHandler()));
+    // an empty value is not a result
+    fakeSource->Write("");
+    fakeSource->Write("fail");
+    EXPECT_TRUE(recorder.WaitForCount(1, TEST_WAIT_MS));
+    EXPECT_EQ(recorder.GetResults(), std::vector<bool>({false}));
+    POWER_HILOGI(LABEL_TEST, "UlsrCallbackHolderTest::UlsrCallbackHolderTest035 end!");
+}
+
+/**
+ * @tc.name: UlsrCallbackHolderTest036
+ * @tc.desc: Test WaitUlsrResult times out and ignores a late result
+ * @tc.type: FUNC
+ */
+HWTEST_F(UlsrCallbackHolderTest, UlsrCallbackHolderTest036, TestSize.Level2)
+{
+    POWER_HILOGI(LABEL_TEST, "UlsrCallbackHolderTest::UlsrCallbackHolderTest036 start!");
+    auto source = std::make_unique<FakeUlsrResultSource>();
+    FakeUlsrResultSource* fakeSource = source.get();
+    sptr<UlsrCallbackHolder> holder = new UlsrCallbackHolder(std::move(source), TEST_RESULT_TIMEOUT_MS);
+    UlsrResultRecorder recorder;
+
+    EXPECT_TRUE(holder->SyncUlsrNotify());
+    EXPECT_TRUE(holder->WaitUlsrResult(recorder.GetHandler()));
+    EXPECT_TRUE(recorder.WaitForCount(1, TEST_WAIT_MS));
+    EXPECT_EQ(recorder.GetResults(), std::vector<bool>({false}));
+    fakeSource->Write("success");
+    EXPECT_FALSE(recorder.WaitForCount(2, TEST_RESULT_TIMEOUT_MS));
+    POWER_HILOGI(LABEL_TEST, "UlsrCallbackHolderTest::UlsrCallbackHolderTest036 end!");
+}
+
+/**
+ * @tc.name: UlsrCallbackHolderTest037
+ * @tc.desc: Test the watcher is registered once and serves later resumes
+ * @tc.type: FUNC
+ */
+HWTEST_F(UlsrCallbackHolderTest, UlsrCallbackHolderTest037, TestSize.Level2)
+{
+    POWER_HILOGI(LABEL_TEST, "UlsrCallbackHolderTest::UlsrCallbackHolderTest037 start!");
+    auto source = std::make_unique<FakeUlsrResultSource>();
+    FakeUlsrResultSource* fakeSource = source.get();
+    sptr<UlsrCallbackHolder> holder = new UlsrCallbackHolder(std::move(source), TEST_WAIT_MS);
+    UlsrResultRecorder recorder;
+    sptr<TestUlsrCallback> cb = new TestUlsrCallback();
+    holder->AddCallback(cb, {1, 1}, UlsrPriority::DEFAULT);
+    auto handler = [&holder, &recorder](bool ulsrResult) {
+        holder->WakeupNotify(ulsrResult);
+        recorder.GetHandler()(ulsrResult);
+    };
+
+    EXPECT_TRUE(holder->SyncUlsrNotify());
+    EXPECT_TRUE(holder->WaitUlsrResult(handler));
+    fakeSource->Write("success");
+    EXPECT_TRUE(recorder.WaitForCount(1, TEST_WAIT_MS));
+    EXPECT_TRUE(cb->GetLastUlsrResult());
+
+    // the HDI clears the result before the next ULSR
+    fakeSource->Write("");
+    EXPECT_TRUE(holder->SyncUlsrNotify());
+    EXPECT_TRUE(holder->WaitUlsrResult(handler));
+    fakeSource->Write("fail");
+    EXPECT_TRUE(recorder.WaitForCount(2, TEST_WAIT_MS));
+    EXPECT_FALSE(cb->GetLastUlsrResult());
+    EXPECT_EQ(recorder.GetResults(), std::vector<bool>({true, false}));
+    EXPECT_EQ(fakeSource->GetWatchCount(), 1);
+    holder->RemoveCallback(cb);
+    POWER_HILOGI(LABEL_TEST, "UlsrCallbackHolderTest::UlsrCallbackHolderTest037 end!");
+}
 } // namespace PowerMgr
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <power_log.h>
+
+#include "power_event_recorder.h"
+
+namespace OHOS {
+namespace PowerMgr {
+using namespace testing;
+using namespace ext;
+
+class PowerEventRecorderTest : public Test {
+public:
+    void SetUp()
+    {
+        written_.clear();
+        submitCount_ = 0;
+        timers_.clear();
+        recorder_ = std::make_unique<PowerEventRecorder>([this](const std::vector<FFRTTask>& tasks, uint32_t delayMs) {
+            if (delayMs != 0) {
+                timers_.insert(timers_.end(), tasks.begin(), tasks.end());
+                return;
+            }
+            submitCount_++;
+            for (const auto& task : tasks) {
+                task();
+            }
+        });
+    }
+    void TearDown()
+    {
+        recorder_.reset();
+    }
+
+    FFRTTask Event(const std::string& name)
+    {
+        return [this, name]() { written_.push_back(name); };
+    }
+
+protected:
+    std::vector<std::string> written_;
+    int32_t submitCount_ {0};
+    std::vector<FFRTTask> timers_;
+    std::unique_ptr<PowerEventRecorder> recorder_;
+};
+
+namespace {
+/**
+ * @tc.name: PowerEventRecorderTest001
+ * @tc.desc: Nothing is written on the recording thread, a flush writes the events in order
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerEventRecorderTest, PowerEventRecorderTest001, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerEventRecorderTest001 function start!");
+    recorder_->Record(Event("A"));
+    recorder_->Record(Event("B"));
+    recorder_->Record(Event("C"));
+    EXPECT_TRUE(written_.empty());
+    EXPECT_EQ(recorder_->GetPendingCount(), 3);
+    // one timer for the whole batch
+    EXPECT_EQ(timers_.size(), 1);
+
+    recorder_->Flush();
+    EXPECT_EQ(written_, std::vector<std::string>({"A", "B", "C"}));
+    EXPECT_EQ(submitCount_, 1);
+    EXPECT_EQ(recorder_->GetPendingCount(), 0);
+    recorder_->Flush();
+    EXPECT_EQ(submitCount_, 1);
+    POWER_HILOGI(LABEL_TEST, "PowerEventRecorderTest001 function end!");
+}
+
+/**
+ * @tc.name: PowerEventRecorderTest002
+ * @tc.desc: A full buffer is flushed without waiting for the timer
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerEventRecorderTest, PowerEventRecorderTest002, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerEventRecorderTest002 function start!");
+    for (size_t i = 0; i < PowerEventRecorder::MAX_PENDING_EVENT_NUM - 1; i++) {
+        recorder_->Record(Event(std::to_string(i)));
+    }
+    EXPECT_TRUE(written_.empty());
+    recorder_->Record(Event("last"));
+    ASSERT_EQ(written_.size(), PowerEventRecorder::MAX_PENDING_EVENT_NUM);
+    EXPECT_EQ(written_.front(), "0");
+    EXPECT_EQ(written_.back(), "last");
+
+    // the next event starts a new timer
+    recorder_->Record(Event("next"));
+    EXPECT_EQ(timers_.size(), 2);
+    POWER_HILOGI(LABEL_TEST, "PowerEventRecorderTest002 function end!");
+}
+
+/**
+ * @tc.name: PowerEventRecorderTest003
+ * @tc.desc: Deferred events start no timer, the next flush writes them in order
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerEventRecorderTest, PowerEventRecorderTest003, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerEventRecorderTest003 function start!");
+    recorder_->Defer(Event("suspend"));
+    EXPECT_TRUE(timers_.empty());
+    EXPECT_EQ(recorder_->GetPendingCount(), 1);
+    recorder_->Record(Event("A"));
+    EXPECT_EQ(timers_.size(), 1);
+    recorder_->Flush();
+    EXPECT_EQ(written_, std::vector<std::string>({"suspend", "A"}));
+    EXPECT_EQ(recorder_->GetPendingCount(), 0);
+    POWER_HILOGI(LABEL_TEST, "PowerEventRecorderTest003 function end!");
+}
+} // namespace
+} // namespace PowerMgr
+} // namespace OHOS
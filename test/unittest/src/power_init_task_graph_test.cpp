@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <gtest/gtest.h>
+#include <power_log.h>
+#include "power_init_task_graph.h"
+
+namespace OHOS {
+namespace PowerMgr {
+using namespace testing;
+using namespace ext;
+class PowerInitTaskGraphTest : public Test {
+public:
+    void SetUp() {}
+    void TearDown() {}
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+};
+
+namespace {
+/**
+ * @tc.name: PowerInitTaskGraphTest001
+ * @tc.desc: test invalid steps are rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerInitTaskGraphTest, PowerInitTaskGraphTest001, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerInitTaskGraphTest001 function start!");
+    PowerInitTaskGraph graph("test");
+    EXPECT_TRUE(graph.AddStep("A", {}, []() { return true; }));
+    EXPECT_FALSE(graph.AddStep("A", {}, []() { return true; }));
+    EXPECT_FALSE(graph.AddStep("B", {"C"}, []() { return true; }));
+    EXPECT_FALSE(graph.AddStep("D", {}, nullptr));
+    EXPECT_EQ(graph.GetStepCount(), 1);
+    POWER_HILOGI(LABEL_TEST, "PowerInitTaskGraphTest001 function end!");
+}
+
+/**
+ * @tc.name: PowerInitTaskGraphTest002
+ * @tc.desc: test dependencies are respected when running in parallel and in serial
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerInitTaskGraphTest, PowerInitTaskGraphTest002, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerInitTaskGraphTest002 function start!");
+    for (bool parallel : {true, false}) {
+        std::atomic<int32_t> order {0};
+        int32_t orderA = -1;
+        int32_t orderB = -1;
+        int32_t orderC = -1;
+        int32_t orderD = -1;
+        PowerInitTaskGraph graph("test");
+        graph.AddStep("A", {}, [&]() { orderA = order++; return true; });
+        graph.AddStep("B", {"A"}, [&]() { orderB = order++; return true; });
+        graph.AddStep("C", {"A"}, [&]() { orderC = order++; return true; });
+        graph.AddStep("D", {"B", "C"}, [&]() { orderD = order++; return true; });
+        EXPECT_TRUE(graph.Run(parallel));
+        EXPECT_EQ(order.load(), 4);
+        EXPECT_LT(orderA, orderB);
+        EXPECT_LT(orderA, orderC);
+        EXPECT_LT(orderB, orderD);
+        EXPECT_LT(orderC, orderD);
+    }
+    POWER_HILOGI(LABEL_TEST, "PowerInitTaskGraphTest002 function end!");
+}
+
+/**
+ * @tc.name: PowerInitTaskGraphTest003
+ * @tc.desc: test failed steps are reported and dumped
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerInitTaskGraphTest, PowerInitTaskGraphTest003, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerInitTaskGraphTest003 function start!");
+    PowerInitTaskGraph graph("test");
+    graph.AddStep("Ok", {}, []() { return true; });
+    graph.AddStep("Fail", {"Ok"}, []() { return false; });
+    EXPECT_FALSE(graph.Run());
+    EXPECT_TRUE(graph.IsStepSucceed("Ok"));
+    EXPECT_FALSE(graph.IsStepSucceed("Fail"));
+    EXPECT_FALSE(graph.IsStepSucceed("NotExist"));
+    std::string dump;
+    graph.DumpInfo(dump);
+    EXPECT_NE(dump.find("Fail"), std::string::npos);
+    EXPECT_NE(dump.find("state=failed"), std::string::npos);
+    EXPECT_NE(dump.find("deps=Ok"), std::string::npos);
+    EXPECT_GE(graph.GetTotalCostUs(), 0);
+    POWER_HILOGI(LABEL_TEST, "PowerInitTaskGraphTest003 function end!");
+}
+} // namespace
+} // namespace PowerMgr
+} // namespace OHOS
@@ -15,7 +15,10 @@
 
 #include "power_mgr_client_native_test.h"
 
+#include <algorithm>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 #include <datetime_ex.h>
 #include <gtest/gtest.h>
@@ -24,6 +27,8 @@
 #include <system_ability_definition.h>
 #include <ipc_skeleton.h>
 #include <string_ex.h>
+#include <message_parcel.h>
+#include "client_recovery.h"
 #include "running_lock_token_stub.h"
 #include "power_common.h"
 #include "power_mgr_client.h"
@@ -142,4 +147,106 @@ HWTEST_F(PowerMgrClientNativeTest, PowerMgrClientNative002, TestSize.Level2)
     POWER_HILOGI(LABEL_TEST, "PowerMgrClientNative002 function end!");
     GTEST_LOG_(INFO) << "PowerMgrClientNative002 function end!";
 }
+
+/**
+ * @tc.name: PowerMgrClientNative003
+ * @tc.desc: test the published proxy snapshot is shared by concurrent callers
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerMgrClientNativeTest, PowerMgrClientNative003, TestSize.Level2)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerMgrClientNative003 function start!");
+    constexpr int32_t threadCount = 8;
+    constexpr int32_t loopCount = 1000;
+    auto& powerMgrClient = PowerMgrClient::GetInstance();
+    sptr<IPowerMgr> proxy = powerMgrClient.GetPowerMgrProxy();
+    ASSERT_TRUE(proxy != nullptr);
+    std::atomic<int32_t> mismatchCount {0};
+    std::vector<std::thread> threads;
+    for (int32_t index = 0; index < threadCount; index++) {
+        threads.emplace_back([&powerMgrClient, &proxy, &mismatchCount]() {
+            for (int32_t loop = 0; loop < loopCount; loop++) {
+                if (powerMgrClient.GetPowerMgrProxy() != proxy) {
+                    mismatchCount++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(mismatchCount.load(), 0);
+    EXPECT_FALSE(powerMgrClient.ResetProxy(nullptr));
+    // a service notice without a preceding death does not reconnect
+    powerMgrClient.OnServiceAdded();
+    EXPECT_FALSE(powerMgrClient.needRecover_.load());
+    EXPECT_TRUE(powerMgrClient.LoadProxy() == proxy);
+    POWER_HILOGI(LABEL_TEST, "PowerMgrClientNative003 function end!");
+}
+
+/**
+ * @tc.name: PowerMgrClientNative004
+ * @tc.desc: test the restore session survives a parcel round trip
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerMgrClientNativeTest, PowerMgrClientNative004, TestSize.Level2)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerMgrClientNative004 function start!");
+    PowerRestoreSession session;
+    sptr<IRemoteObject> token = new RunningLockTokenStub();
+    session.locks.push_back({token, RunningLockInfo("restore_lock", RunningLockType::RUNNINGLOCK_BACKGROUND)});
+    sptr<IPowerStateCallback> callback = new PowerStateTestCallback();
+    session.callbacks.push_back({RestoreCallbackType::POWER_STATE, callback->AsObject(), 1, UINT64_MAX});
+    MessageParcel parcel;
+    EXPECT_TRUE(session.Marshalling(parcel));
+    std::unique_ptr<PowerRestoreSession> result(PowerRestoreSession::Unmarshalling(parcel));
+    ASSERT_TRUE(result != nullptr);
+    ASSERT_EQ(result->locks.size(), 1);
+    EXPECT_EQ(result->locks[0].info.name, "restore_lock");
+    EXPECT_EQ(result->locks[0].info.type, RunningLockType::RUNNINGLOCK_BACKGROUND);
+    ASSERT_EQ(result->callbacks.size(), 1);
+    EXPECT_EQ(result->callbacks[0].type, RestoreCallbackType::POWER_STATE);
+    EXPECT_EQ(result->callbacks[0].param, 1);
+    EXPECT_TRUE(result->callbacks[0].callback != nullptr);
+
+    PowerRestoreSession oversized;
+    oversized.callbacks.resize(PowerRestoreSession::MAX_CALLBACK_NUM + 1);
+    MessageParcel oversizedParcel;
+    EXPECT_FALSE(oversized.Marshalling(oversizedParcel));
+    POWER_HILOGI(LABEL_TEST, "PowerMgrClientNative004 function end!");
+}
+
+/**
+ * @tc.name: PowerMgrClientNative005
+ * @tc.desc: test the callback registrations recorded for the restore session
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerMgrClientNativeTest, PowerMgrClientNative005, TestSize.Level2)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerMgrClientNative005 function start!");
+    auto& recovery = PowerClientRecovery::GetInstance();
+    size_t baseCount = recovery.GetCallbackCount();
+    sptr<IPowerStateCallback> callback = new PowerStateTestCallback();
+    recovery.AddCallback(RestoreCallbackType::POWER_STATE, nullptr);
+    EXPECT_EQ(recovery.GetCallbackCount(), baseCount);
+    recovery.AddCallback(RestoreCallbackType::POWER_STATE, callback->AsObject(), 0);
+    recovery.AddCallback(RestoreCallbackType::POWER_STATE, callback->AsObject(), 1);
+    EXPECT_EQ(recovery.GetCallbackCount(), baseCount + 1);
+    recovery.AddCallback(RestoreCallbackType::RUNNING_LOCK_CHANGED, callback->AsObject(), 0, 0);
+    EXPECT_EQ(recovery.GetCallbackCount(), baseCount + 2);
+
+    PowerRestoreSession session = recovery.BuildSession(PowerMgrClient::GetInstance().GetPowerMgrProxy());
+    auto iter = std::find_if(session.callbacks.begin(), session.callbacks.end(), [&](const auto& entry) {
+        return entry.type == RestoreCallbackType::POWER_STATE && entry.callback == callback->AsObject();
+    });
+    ASSERT_TRUE(iter != session.callbacks.end());
+    EXPECT_EQ(iter->param, 1);
+
+    recovery.RemoveCallback(RestoreCallbackType::POWER_STATE, callback->AsObject());
+    recovery.RemoveCallback(RestoreCallbackType::RUNNING_LOCK_CHANGED, callback->AsObject(), 0);
+    EXPECT_EQ(recovery.GetCallbackCount(), baseCount);
+    EXPECT_EQ(recovery.GetJitterMs(), recovery.GetJitterMs());
+    EXPECT_LE(recovery.GetJitterMs(), PowerClientRecovery::RESTORE_JITTER_MAX_MS);
+    POWER_HILOGI(LABEL_TEST, "PowerMgrClientNative005 function end!");
+}
 }
\ No newline at end of file
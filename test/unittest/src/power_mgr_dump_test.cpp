@@ -254,4 +254,42 @@ HWTEST_F (PowerMgrDumpTest, PowerMgrDumpNative010, TestSize.Level1)
     POWER_HILOGI(LABEL_TEST, "PowerMgrDumpNative010 function end!");
     GTEST_LOG_(INFO) << "PowerMgrDumpNative010 function end!";
 }
+
+/**
+ * @tc.name: PowerMgrDumpNative011
+ * @tc.desc: Test that args in PowerMgrDump is -p.
+ * @tc.type: FUNC
+ */
+HWTEST_F (PowerMgrDumpTest, PowerMgrDumpNative011, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "PowerMgrDumpNative011 function start!";
+    POWER_HILOGI(LABEL_TEST, "PowerMgrDumpNative011 function start!");
+    EXPECT_TRUE(g_pmsTest != nullptr) << "PowerMgrDumpNative011 fail to get PowerMgrService";
+    int32_t fd = 1;
+    std::vector<std::u16string> args;
+    std::u16string arg = u"-p";
+    args.push_back(arg);
+    EXPECT_TRUE(g_pmsTest->Dump(fd, args) == ERR_OK);
+    POWER_HILOGI(LABEL_TEST, "PowerMgrDumpNative011 function end!");
+    GTEST_LOG_(INFO) << "PowerMgrDumpNative011 function end!";
+}
+
+/**
+ * @tc.name: PowerMgrDumpNative012
+ * @tc.desc: Test that args in PowerMgrDump is -o.
+ * @tc.type: FUNC
+ */
+HWTEST_F (PowerMgrDumpTest, PowerMgrDumpNative012, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "PowerMgrDumpNative012 function start!";
+    POWER_HILOGI(LABEL_TEST, "PowerMgrDumpNative012 function start!");
+    EXPECT_TRUE(g_pmsTest != nullptr) << "PowerMgrDumpNative012 fail to get PowerMgrService";
+    int32_t fd = 1;
+    std::vector<std::u16string> args;
+    std::u16string arg = u"-o";
+    args.push_back(arg);
+    EXPECT_TRUE(g_pmsTest->Dump(fd, args) == ERR_OK);
+    POWER_HILOGI(LABEL_TEST, "PowerMgrDumpNative012 function end!");
+    GTEST_LOG_(INFO) << "PowerMgrDumpNative012 function end!";
+}
 } // namespace
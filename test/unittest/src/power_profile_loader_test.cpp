@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <power_log.h>
+#include "power_mgr_service.h"
+#include "power_profile_loader.h"
+
+namespace OHOS {
+namespace PowerMgr {
+using namespace testing;
+using namespace ext;
+class PowerProfileLoaderTest : public Test {
+public:
+    void SetUp() {}
+    void TearDown() {}
+    static void SetUpTestCase()
+    {
+        DelayedSpSingleton<PowerMgrService>::GetInstance()->OnStart();
+    }
+    static void TearDownTestCase()
+    {
+        DelayedSpSingleton<PowerMgrService>::GetInstance()->OnStop();
+    }
+};
+
+namespace {
+/**
+ * @tc.name: PowerProfileLoaderTest001
+ * @tc.desc: test Load publishes a snapshot with every profile parsed
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerProfileLoaderTest, PowerProfileLoaderTest001, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerProfileLoaderTest001 function start!");
+    PowerProfileLoader& loader = PowerProfileLoader::GetInstance();
+    auto before = loader.GetSnapshot();
+    loader.Load();
+    auto snapshot = loader.GetSnapshot();
+    ASSERT_NE(snapshot, nullptr);
+    EXPECT_NE(snapshot, before);
+    EXPECT_EQ(snapshot->version, before == nullptr ? 1 : before->version + 1);
+    EXPECT_NE(snapshot->wakeupSources, nullptr);
+    EXPECT_NE(snapshot->suspendSources, nullptr);
+    EXPECT_EQ(loader.GetWakeupSources(), snapshot->wakeupSources);
+    EXPECT_EQ(loader.GetSuspendSources(), snapshot->suspendSources);
+    POWER_HILOGI(LABEL_TEST, "PowerProfileLoaderTest001 function end!");
+}
+
+/**
+ * @tc.name: PowerProfileLoaderTest002
+ * @tc.desc: test a reload swaps in a new snapshot and leaves the old one untouched
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerProfileLoaderTest, PowerProfileLoaderTest002, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerProfileLoaderTest002 function start!");
+    PowerProfileLoader& loader = PowerProfileLoader::GetInstance();
+    loader.Load();
+    auto old = loader.GetSnapshot();
+    ASSERT_NE(old, nullptr);
+    auto oldWakeup = old->wakeupSources;
+    auto oldSuspend = old->suspendSources;
+
+    auto wakeupSources = loader.ReloadWakeupSources();
+    ASSERT_NE(wakeupSources, nullptr);
+    auto suspendSources = loader.ReloadSuspendSources();
+    ASSERT_NE(suspendSources, nullptr);
+    auto snapshot = loader.GetSnapshot();
+    EXPECT_EQ(snapshot->version, old->version + 2);
+    EXPECT_EQ(snapshot->wakeupSources, wakeupSources);
+    EXPECT_EQ(snapshot->suspendSources, suspendSources);
+    EXPECT_EQ(old->wakeupSources, oldWakeup);
+    EXPECT_EQ(old->suspendSources, oldSuspend);
+    EXPECT_EQ(wakeupSources->GetSourceList().size(), oldWakeup->GetSourceList().size());
+    POWER_HILOGI(LABEL_TEST, "PowerProfileLoaderTest002 function end!");
+}
+} // namespace
+} // namespace PowerMgr
+} // namespace OHOS
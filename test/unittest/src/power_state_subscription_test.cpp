@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <power_log.h>
+#include <power_state_subscription.h>
+
+namespace OHOS {
+namespace PowerMgr {
+using namespace testing;
+using namespace ext;
+namespace {
+class FakePowerStateSource : public PowerStateSource {
+public:
+    bool RegisterStateCallback(const sptr<IPowerStateCallback>& callback) override
+    {
+        stateRegisterCount++;
+        if (!allowState) {
+            return false;
+        }
+        stateCallback = callback;
+        return true;
+    }
+    void UnRegisterStateCallback(const sptr<IPowerStateCallback>& callback) override
+    {
+        stateUnregisterCount++;
+        stateCallback = nullptr;
+    }
+    bool RegisterModeCallback(const sptr<IPowerModeCallback>& callback) override
+    {
+        if (!allowMode) {
+            return false;
+        }
+        modeCallback = callback;
+        return true;
+    }
+    void UnRegisterModeCallback(const sptr<IPowerModeCallback>& callback) override
+    {
+        modeCallback = nullptr;
+    }
+    bool IsScreenOn() override
+    {
+        screenOnReads++;
+        return screenOn;
+    }
+    PowerState GetState() override
+    {
+        return state;
+    }
+    PowerMode GetDeviceMode() override
+    {
+        modeReads++;
+        return mode;
+    }
+
+    bool allowState {true};
+    bool allowMode {true};
+    bool screenOn {true};
+    PowerState state {PowerState::AWAKE};
+    PowerMode mode {PowerMode::NORMAL_MODE};
+    int32_t stateRegisterCount {0};
+    int32_t stateUnregisterCount {0};
+    int32_t screenOnReads {0};
+    int32_t modeReads {0};
+    sptr<IPowerStateCallback> stateCallback;
+    sptr<IPowerModeCallback> modeCallback;
+};
+} // namespace
+
+class PowerStateSubscriptionTest : public Test {
+public:
+    void SetUp()
+    {
+        auto source = std::make_unique<FakePowerStateSource>();
+        source_ = source.get();
+        subscription_ = std::make_unique<PowerStateSubscription>(std::move(source));
+    }
+    void TearDown()
+    {
+        subscription_.reset();
+        source_ = nullptr;
+    }
+
+protected:
+    FakePowerStateSource* source_ {nullptr};
+    std::unique_ptr<PowerStateSubscription> subscription_;
+};
+
+namespace {
+/**
+ * @tc.name: PowerStateSubscriptionTest001
+ * @tc.desc: Listeners share one registration, which is dropped with the last listener
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerStateSubscriptionTest, PowerStateSubscriptionTest001, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerStateSubscriptionTest001 function start!");
+    std::vector<PowerState> first;
+    std::vector<PowerState> second;
+    uint64_t firstId = 0;
+    uint64_t secondId = 0;
+    EXPECT_EQ(subscription_->Subscribe([&first](PowerState state) { first.push_back(state); }, firstId),
+        PowerErrors::ERR_OK);
+    EXPECT_EQ(subscription_->Subscribe([&second](PowerState state) { second.push_back(state); }, secondId),
+        PowerErrors::ERR_OK);
+    EXPECT_NE(firstId, secondId);
+    EXPECT_EQ(source_->stateRegisterCount, 1);
+    EXPECT_EQ(subscription_->GetListenerCount(), 2);
+
+    ASSERT_NE(source_->stateCallback, nullptr);
+    source_->stateCallback->OnAsyncPowerStateChanged(PowerState::INACTIVE);
+    EXPECT_EQ(first, std::vector<PowerState>({PowerState::INACTIVE}));
+    EXPECT_EQ(second, std::vector<PowerState>({PowerState::INACTIVE}));
+
+    subscription_->Unsubscribe(firstId);
+    EXPECT_EQ(source_->stateUnregisterCount, 0);
+    source_->stateCallback->OnAsyncPowerStateChanged(PowerState::AWAKE);
+    EXPECT_EQ(first.size(), 1);
+    EXPECT_EQ(second.size(), 2);
+
+    subscription_->Unsubscribe(secondId);
+    EXPECT_EQ(source_->stateUnregisterCount, 1);
+    EXPECT_EQ(source_->stateCallback, nullptr);
+    EXPECT_EQ(subscription_->GetListenerCount(), 0);
+    POWER_HILOGI(LABEL_TEST, "PowerStateSubscriptionTest001 function end!");
+}
+
+/**
+ * @tc.name: PowerStateSubscriptionTest002
+ * @tc.desc: IsScreenOn and GetDeviceMode are answered from the cache while subscribed
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerStateSubscriptionTest, PowerStateSubscriptionTest002, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerStateSubscriptionTest002 function start!");
+    uint64_t id = 0;
+    EXPECT_EQ(subscription_->Subscribe([](PowerState) {}, id), PowerErrors::ERR_OK);
+    EXPECT_TRUE(subscription_->IsStateCached());
+    EXPECT_TRUE(subscription_->IsModeCached());
+    int32_t screenOnReads = source_->screenOnReads;
+    int32_t modeReads = source_->modeReads;
+
+    EXPECT_TRUE(subscription_->IsScreenOn());
+    source_->stateCallback->OnAsyncPowerStateChanged(PowerState::DIM);
+    EXPECT_TRUE(subscription_->IsScreenOn());
+    source_->stateCallback->OnAsyncPowerStateChanged(PowerState::SLEEP);
+    EXPECT_FALSE(subscription_->IsScreenOn());
+    EXPECT_EQ(subscription_->GetState(), PowerState::SLEEP);
+    source_->stateCallback->OnAsyncPowerStateChanged(PowerState::FREEZE);
+    EXPECT_FALSE(subscription_->IsScreenOn());
+
+    source_->modeCallback->OnPowerModeChanged(PowerMode::POWER_SAVE_MODE);
+    EXPECT_EQ(subscription_->GetDeviceMode(), PowerMode::POWER_SAVE_MODE);
+    EXPECT_EQ(source_->screenOnReads, screenOnReads);
+    EXPECT_EQ(source_->modeReads, modeReads);
+
+    subscription_->Unsubscribe(id);
+    EXPECT_FALSE(subscription_->IsStateCached());
+    EXPECT_TRUE(subscription_->IsScreenOn());
+    EXPECT_EQ(subscription_->GetDeviceMode(), PowerMode::NORMAL_MODE);
+    EXPECT_EQ(source_->screenOnReads, screenOnReads + 1);
+    EXPECT_EQ(source_->modeReads, modeReads + 1);
+    POWER_HILOGI(LABEL_TEST, "PowerStateSubscriptionTest002 function end!");
+}
+
+/**
+ * @tc.name: PowerStateSubscriptionTest003
+ * @tc.desc: A refused registration fails the subscription, a refused mode callback only disables the mode cache
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerStateSubscriptionTest, PowerStateSubscriptionTest003, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerStateSubscriptionTest003 function start!");
+    uint64_t id = 0;
+    source_->allowState = false;
+    EXPECT_EQ(subscription_->Subscribe([](PowerState) {}, id), PowerErrors::ERR_PERMISSION_DENIED);
+    EXPECT_EQ(subscription_->GetListenerCount(), 0);
+    EXPECT_FALSE(subscription_->IsStateCached());
+    EXPECT_EQ(subscription_->Subscribe(nullptr, id), PowerErrors::ERR_PARAM_INVALID);
+
+    source_->allowState = true;
+    source_->allowMode = false;
+    EXPECT_EQ(subscription_->Subscribe([](PowerState) {}, id), PowerErrors::ERR_OK);
+    EXPECT_TRUE(subscription_->IsStateCached());
+    EXPECT_FALSE(subscription_->IsModeCached());
+    int32_t modeReads = source_->modeReads;
+    source_->mode = PowerMode::PERFORMANCE_MODE;
+    EXPECT_EQ(subscription_->GetDeviceMode(), PowerMode::PERFORMANCE_MODE);
+    EXPECT_EQ(source_->modeReads, modeReads + 1);
+    subscription_->Unsubscribe(id);
+    POWER_HILOGI(LABEL_TEST, "PowerStateSubscriptionTest003 function end!");
+}
+
+/**
+ * @tc.name: PowerStateSubscriptionTest004
+ * @tc.desc: The cache is bypassed after the service died and read again once the registration is restored
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerStateSubscriptionTest, PowerStateSubscriptionTest004, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerStateSubscriptionTest004 function start!");
+    uint64_t id = 0;
+    EXPECT_EQ(subscription_->Subscribe([](PowerState) {}, id), PowerErrors::ERR_OK);
+    subscription_->InvalidateCache();
+    EXPECT_FALSE(subscription_->IsStateCached());
+    source_->screenOn = false;
+    source_->state = PowerState::INACTIVE;
+    EXPECT_FALSE(subscription_->IsScreenOn());
+
+    subscription_->RefreshCache();
+    EXPECT_TRUE(subscription_->IsStateCached());
+    EXPECT_TRUE(subscription_->IsModeCached());
+    int32_t screenOnReads = source_->screenOnReads;
+    EXPECT_FALSE(subscription_->IsScreenOn());
+    EXPECT_EQ(subscription_->GetState(), PowerState::INACTIVE);
+    EXPECT_EQ(source_->screenOnReads, screenOnReads);
+    subscription_->Unsubscribe(id);
+
+    subscription_->RefreshCache();
+    EXPECT_FALSE(subscription_->IsStateCached());
+    POWER_HILOGI(LABEL_TEST, "PowerStateSubscriptionTest004 function end!");
+}
+} // namespace
+} // namespace PowerMgr
+} // namespace OHOS
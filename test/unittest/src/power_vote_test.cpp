@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <ipc_object_proxy.h>
+#include <ipc_skeleton.h>
+#define private public
+#include <power_vote/power_vote.h>
+#undef private
+#include <power_log.h>
+
+namespace OHOS {
+namespace PowerMgr {
+using namespace testing;
+using namespace ext;
+class PowerVoteTest : public Test {
+public:
+    void SetUp() {}
+    void TearDown() {}
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+};
+
+namespace {
+/**
+ * @tc.name: PowerVoteTest001
+ * @tc.desc: class unittest, cover abnormal branches
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerVoteTest, PowerVoteTest001, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerVoteTest001 function start!");
+    constexpr size_t paramCount = 8;
+    auto testVote = sptr<PowerVote>::MakeSptr("test", paramCount, 0, PowerVote::ChangeFunc {});
+    sptr<IPCObjectProxy> testProxy = sptr<IPCObjectProxy>::MakeSptr(0, std::u16string {u"test"});
+    sptr<IPCObjectProxy> testProxyInvalid = sptr<IPCObjectProxy>::MakeSptr(0, std::u16string {u"nottest"});
+    constexpr pid_t testPid = 1;
+    constexpr PowerVote::VoteBits input = 0b10101010;
+    testVote->Set(nullptr, testPid, -1, input);
+    EXPECT_EQ(testVote->GetResult(), 0);
+    EXPECT_FALSE(testVote->RemoveInvoker(PowerVote::GetInvokerId(testProxy)));
+    POWER_HILOGI(LABEL_TEST, "phase 1 dump: %{public}s", testVote->Dump().c_str());
+
+    testVote->Set(testProxy, testPid, -1, input);
+    EXPECT_EQ(testVote->GetResult(), input);
+    POWER_HILOGI(LABEL_TEST, "phase 2 dump: %{public}s", testVote->Dump().c_str());
+
+    testVote->OnRemoteDied(nullptr);
+    EXPECT_EQ(testVote->GetResult(), input);
+    POWER_HILOGI(LABEL_TEST, "phase 3 dump: %{public}s", testVote->Dump().c_str());
+
+    testVote->OnRemoteDied(testProxyInvalid);
+    EXPECT_EQ(testVote->GetResult(), input);
+    POWER_HILOGI(LABEL_TEST, "phase 4 dump: %{public}s", testVote->Dump().c_str());
+
+    testVote->OnRemoteDied(testProxy);
+    EXPECT_EQ(testVote->GetResult(), 0);
+    POWER_HILOGI(LABEL_TEST, "phase 5 dump: %{public}s", testVote->Dump().c_str());
+
+    // cover abnormal branch
+    testVote->invokers_.emplace(PowerVote::LOCAL_INVOKER_ID_MAX, PowerVote::Invoker {});
+    POWER_HILOGI(LABEL_TEST, "phase 6 dump: %{public}s", testVote->Dump().c_str());
+    EXPECT_TRUE(testVote->RemoveInvoker(PowerVote::LOCAL_INVOKER_ID_MAX));
+    testVote->SetLocal(PowerVote::LOCAL_INVOKER_ID_MAX + 1, input);
+    EXPECT_EQ(testVote->GetResult(), 0);
+    POWER_HILOGI(LABEL_TEST, "PowerVoteTest001 function end!");
+}
+
+/**
+ * @tc.name: PowerVoteTest002
+ * @tc.desc: test bits are packed at compile time
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerVoteTest, PowerVoteTest002, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerVoteTest002 function start!");
+    static_assert(PowerVote::ToBits() == 0);
+    static_assert(PowerVote::ToBits(true, false, true) == 0b101);
+    static_assert(PowerVote::ToBits(false, true, true, false) == 0b0110);
+    static_assert(PowerVote::TestBit(0b100, 2) && !PowerVote::TestBit(0b100, 0));
+    bool enabled = true;
+    EXPECT_EQ(PowerVote::ToBits(enabled, !enabled), 0b10);
+    POWER_HILOGI(LABEL_TEST, "PowerVoteTest002 function end!");
+}
+
+/**
+ * @tc.name: PowerVoteTest003
+ * @tc.desc: test the callback only runs when the aggregate flips and defaults are respected
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerVoteTest, PowerVoteTest003, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerVoteTest003 function start!");
+    constexpr PowerVote::VoteBits defaults = PowerVote::ToBits(true, false, true);
+    int32_t changeCount = 0;
+    PowerVote::VoteBits lastResult = defaults;
+    auto testVote = sptr<PowerVote>::MakeSptr("test", 3, defaults, [&](PowerVote::VoteBits result) {
+        changeCount++;
+        lastResult = result;
+    });
+    EXPECT_EQ(testVote->GetResult(), defaults);
+    sptr<IPCObjectProxy> proxyA = sptr<IPCObjectProxy>::MakeSptr(0, std::u16string {u"a"});
+    sptr<IPCObjectProxy> proxyB = sptr<IPCObjectProxy>::MakeSptr(0, std::u16string {u"b"});
+
+    // voting the defaults changes nothing
+    testVote->Set(proxyA, 1, -1, defaults);
+    EXPECT_EQ(changeCount, 0);
+    testVote->Set(proxyA, 1, -1, PowerVote::ToBits(false, false, true));
+    EXPECT_EQ(changeCount, 1);
+    EXPECT_EQ(lastResult, PowerVote::ToBits(false, false, true));
+    // the second vote on the same bit does not flip the aggregate
+    testVote->Set(proxyB, 2, -1, PowerVote::ToBits(false, false, true));
+    testVote->Set(proxyA, 1, 100, PowerVote::ToBits(false, false, true));
+    EXPECT_EQ(changeCount, 1);
+    testVote->Set(proxyA, 1, -1, defaults);
+    testVote->Set(proxyA, 1, 100, defaults);
+    EXPECT_EQ(changeCount, 1);
+    EXPECT_EQ(testVote->GetResult(), PowerVote::ToBits(false, false, true));
+    testVote->Set(proxyB, 2, -1, defaults);
+    EXPECT_EQ(changeCount, 2);
+    EXPECT_EQ(lastResult, defaults);
+    EXPECT_EQ(testVote->GetResult(), defaults);
+
+    testVote->SetLocal(1, PowerVote::ToBits(true, true, true));
+    EXPECT_EQ(changeCount, 3);
+    EXPECT_TRUE(testVote->RemoveInvoker(1));
+    EXPECT_EQ(changeCount, 4);
+    EXPECT_EQ(testVote->GetResult(), defaults);
+    EXPECT_TRUE(testVote->invokers_.empty());
+    POWER_HILOGI(LABEL_TEST, "PowerVoteTest003 function end!");
+}
+} // namespace
+} // namespace PowerMgr
+} // namespace OHOS
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <power_log.h>
+#include <proximity_event_pipeline.h>
+
+namespace OHOS {
+namespace PowerMgr {
+using namespace testing;
+using namespace ext;
+namespace {
+constexpr uint32_t AWAY = 0;
+constexpr uint32_t CLOSE = 1;
+constexpr int32_t WAIT_STEP_MS = 10;
+constexpr int32_t WAIT_MAX_MS = 2000;
+} // namespace
+
+class ProximityEventPipelineTest : public Test {
+public:
+    void SetUp()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        applied_.clear();
+    }
+    void TearDown() {}
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+
+    void OnApplied(uint32_t status)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        applied_.push_back(status);
+    }
+    std::vector<uint32_t> WaitApplied(size_t num)
+    {
+        for (int32_t waited = 0; waited < WAIT_MAX_MS; waited += WAIT_STEP_MS) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (applied_.size() >= num) {
+                    return applied_;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_STEP_MS));
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        return applied_;
+    }
+
+    std::mutex mutex_;
+    std::vector<uint32_t> applied_;
+};
+
+namespace {
+/**
+ * @tc.name: ProximityEventPipelineTest001
+ * @tc.desc: repeated samples are dropped on the sensor side, edges are applied in order
+ * @tc.type: FUNC
+ */
+HWTEST_F(ProximityEventPipelineTest, ProximityEventPipelineTest001, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "ProximityEventPipelineTest001 function start!");
+    ProximityEventPipeline pipeline([this](uint32_t status) { OnApplied(status); }, CLOSE);
+    int64_t now = ProximityEventPipeline::GetNowUs();
+    EXPECT_TRUE(pipeline.Post(CLOSE, now));
+    EXPECT_FALSE(pipeline.Post(CLOSE, now));
+    EXPECT_TRUE(pipeline.Post(AWAY, now));
+    EXPECT_FALSE(pipeline.Post(AWAY, now));
+    EXPECT_TRUE(pipeline.Post(CLOSE, now));
+    std::vector<uint32_t> applied = WaitApplied(3);
+    EXPECT_EQ(applied, std::vector<uint32_t>({CLOSE, AWAY, CLOSE}));
+    // the sensor was switched off and on again, the first sample counts even if it repeats
+    pipeline.Reset();
+    EXPECT_TRUE(pipeline.Post(CLOSE, now));
+    applied = WaitApplied(4);
+    EXPECT_EQ(applied.size(), 4U);
+    ProximityEventPipeline::Stats stats = pipeline.GetStats();
+    EXPECT_EQ(stats.posted, 4U);
+    EXPECT_EQ(stats.applied, 4U);
+    EXPECT_EQ(stats.dropped, 0U);
+    POWER_HILOGI(LABEL_TEST, "ProximityEventPipelineTest001 function end!");
+}
+
+/**
+ * @tc.name: ProximityEventPipelineTest002
+ * @tc.desc: a stuck consumer never blocks the sensor side, the newest edge is applied last
+ * @tc.type: FUNC
+ */
+HWTEST_F(ProximityEventPipelineTest, ProximityEventPipelineTest002, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "ProximityEventPipelineTest002 function start!");
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    ProximityEventPipeline pipeline([this, released](uint32_t status) {
+        released.wait();
+        OnApplied(status);
+    }, CLOSE);
+    constexpr uint32_t EDGE_NUM = ProximityEventPipeline::QUEUE_CAPACITY * 2 + 1;
+    int64_t now = ProximityEventPipeline::GetNowUs();
+    for (uint32_t i = 0; i < EDGE_NUM; i++) {
+        EXPECT_TRUE(pipeline.Post(i % 2 == 0 ? CLOSE : AWAY, now));
+    }
+    release.set_value();
+    ProximityEventPipeline::Stats stats;
+    for (int32_t waited = 0; waited < WAIT_MAX_MS; waited += WAIT_STEP_MS) {
+        stats = pipeline.GetStats();
+        if (stats.applied + stats.dropped == EDGE_NUM) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_STEP_MS));
+    }
+    EXPECT_EQ(stats.posted, EDGE_NUM);
+    EXPECT_GT(stats.dropped, 0U);
+    EXPECT_EQ(stats.applied + stats.dropped, EDGE_NUM);
+    std::vector<uint32_t> applied = WaitApplied(stats.applied);
+    ASSERT_FALSE(applied.empty());
+    EXPECT_EQ(applied.back(), CLOSE);
+    POWER_HILOGI(LABEL_TEST, "ProximityEventPipelineTest002 function end!");
+}
+
+/**
+ * @tc.name: ProximityEventPipelineTest003
+ * @tc.desc: close to screen off latency is measured once per close edge
+ * @tc.type: FUNC
+ */
+HWTEST_F(ProximityEventPipelineTest, ProximityEventPipelineTest003, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "ProximityEventPipelineTest003 function start!");
+    constexpr int64_t SCREEN_OFF_DELAY_US = 300000;
+    ProximityEventPipeline pipeline([this](uint32_t status) { OnApplied(status); }, CLOSE);
+    int64_t closeUs = ProximityEventPipeline::GetNowUs();
+    pipeline.RecordScreenOff(closeUs);
+    EXPECT_EQ(pipeline.GetStats().screenOffNum, 0U);
+
+    EXPECT_TRUE(pipeline.Post(CLOSE, closeUs));
+    WaitApplied(1);
+    pipeline.RecordScreenOff(closeUs + SCREEN_OFF_DELAY_US);
+    pipeline.RecordScreenOff(closeUs + SCREEN_OFF_DELAY_US * 2);
+    ProximityEventPipeline::Stats stats = pipeline.GetStats();
+    EXPECT_EQ(stats.screenOffNum, 1U);
+    EXPECT_EQ(stats.lastScreenOffUs, SCREEN_OFF_DELAY_US);
+    EXPECT_EQ(stats.maxScreenOffUs, SCREEN_OFF_DELAY_US);
+
+    // an away edge before the screen went off cancels the measurement
+    EXPECT_TRUE(pipeline.Post(AWAY, closeUs));
+    WaitApplied(2);
+    pipeline.RecordScreenOff(closeUs + SCREEN_OFF_DELAY_US);
+    EXPECT_EQ(pipeline.GetStats().screenOffNum, 1U);
+
+    std::string result;
+    pipeline.DumpInfo(result);
+    EXPECT_NE(result.find("closeToScreenOffUs(last/max)=300000/300000"), std::string::npos);
+    POWER_HILOGI(LABEL_TEST, "ProximityEventPipelineTest003 function end!");
+}
+} // namespace
+} // namespace PowerMgr
+} // namespace OHOS
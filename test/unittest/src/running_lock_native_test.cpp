@@ -19,6 +19,7 @@
 #include "power_utils.h"
 
 #include "actions/irunning_lock_action.h"
+#include "running_lock_change_stream.h"
 #include "running_lock_changed_callback_stub.h"
 #include "death_recipient_manager.h"
 
@@ -292,9 +293,9 @@ HWTEST_F (RunningLockNativeTest, RunningLockNative006, TestSize.Level1)
     EXPECT_TRUE(runningLockMgr->CreateRunningLock(remoteObj, runningLockParam) != nullptr);
     runningLockMgr->Lock(remoteObj);
 
-    runningLockMgr->NotifyRunningLockChanged(runningLockParam, "DUBAI_TAG_RUNNINGLOCK_REMOVE", "RE");
-    runningLockMgr->NotifyRunningLockChanged(runningLockParam, "DUBAI_TAG_RUNNINGLOCK_ADD", "AD");
-    runningLockMgr->NotifyRunningLockChanged(runningLockParam, "DUBAI_TAG_RUNNINGLOCK_REMOVE", "RE");
+    runningLockMgr->NotifyRunningLockChanged(runningLockParam, RunningLockChangeAction::REMOVE);
+    runningLockMgr->NotifyRunningLockChanged(runningLockParam, RunningLockChangeAction::ADD);
+    runningLockMgr->NotifyRunningLockChanged(runningLockParam, RunningLockChangeAction::REMOVE);
 
 #ifdef HAS_SENSORS_SENSOR_PART
     auto runningLockMgrController = std::make_shared<RunningLockMgr::ProximityController>();
@@ -478,8 +479,8 @@ HWTEST_F(RunningLockNativeTest, RunningLockNative013, TestSize.Level1)
     sptr<IRemoteObject> remoteObj = new RunningLockTokenStub();
     RunningLockParam runningLockParam {0,
         "runninglockNativeTest1", "", RunningLockType::RUNNINGLOCK_SCREEN, TIMEOUTMS, UNPID, UNUID};
-    runningLockMgr->NotifyRunningLockChanged(runningLockParam, "DUBAI_TAG_RUNNINGLOCK_ADD", "AD");
-    runningLockMgr->NotifyRunningLockChanged(runningLockParam, "DUBAI_TAG_RUNNINGLOCK_REMOVE", "RE");
+    runningLockMgr->NotifyRunningLockChanged(runningLockParam, RunningLockChangeAction::ADD);
+    runningLockMgr->NotifyRunningLockChanged(runningLockParam, RunningLockChangeAction::REMOVE);
     EXPECT_TRUE(runningLockMgr != nullptr);
     POWER_HILOGI(LABEL_TEST, "RunningLockNative013 function end!");
 }
@@ -632,23 +633,23 @@ HWTEST_F(RunningLockNativeTest, RunningLockNative020, TestSize.Level1)
     runningLockMgr->RegisterRunningLockCallback(callback1);
     RunningLockParam runningLockParam1 {0,
         "runninglockNativeTest1", "", RunningLockType::RUNNINGLOCK_SCREEN, TIMEOUTMS, UNPID, UNUID};
-    runningLockMgr->NotifyRunningLockChanged(runningLockParam1, "DUBAI_TAG_RUNNINGLOCK_ADD", "AD");
-    runningLockMgr->NotifyRunningLockChanged(runningLockParam1, "DUBAI_TAG_RUNNINGLOCK_REMOVE", "RE");
+    runningLockMgr->NotifyRunningLockChanged(runningLockParam1, RunningLockChangeAction::ADD);
+    runningLockMgr->NotifyRunningLockChanged(runningLockParam1, RunningLockChangeAction::REMOVE);
 
     sptr<IPowerRunninglockCallback> callback2 =new PowerRunningLockTestCallback();
     runningLockMgr->RegisterRunningLockCallback(callback2);
 #ifdef HAS_SENSORS_SENSOR_PART
     RunningLockParam runningLockParam2 {0, "runninglockNativeTest2", "",
         RunningLockType::RUNNINGLOCK_PROXIMITY_SCREEN_CONTROL, TIMEOUTMS, UNPID, UNUID};
-    runningLockMgr->NotifyRunningLockChanged(runningLockParam2, "DUBAI_TAG_RUNNINGLOCK_ADD", "AD");
-    runningLockMgr->NotifyRunningLockChanged(runningLockParam2, "DUBAI_TAG_RUNNINGLOCK_REMOVE", "RE");
+    runningLockMgr->NotifyRunningLockChanged(runningLockParam2, RunningLockChangeAction::ADD);
+    runningLockMgr->NotifyRunningLockChanged(runningLockParam2, RunningLockChangeAction::REMOVE);
 #endif
 
     runningLockMgr->UnRegisterRunningLockCallback(callback2);
     RunningLockParam runningLockParam3 {0, "runninglockNativeTest3", "",
         RunningLockType::RUNNINGLOCK_BACKGROUND_TASK, TIMEOUTMS, UNPID, UNUID};
-    runningLockMgr->NotifyRunningLockChanged(runningLockParam3, "DUBAI_TAG_RUNNINGLOCK_ADD", "AD");
-    runningLockMgr->NotifyRunningLockChanged(runningLockParam3, "DUBAI_TAG_RUNNINGLOCK_REMOVE", "RE");
+    runningLockMgr->NotifyRunningLockChanged(runningLockParam3, RunningLockChangeAction::ADD);
+    runningLockMgr->NotifyRunningLockChanged(runningLockParam3, RunningLockChangeAction::REMOVE);
     EXPECT_TRUE(runningLockMgr != nullptr);
     POWER_HILOGI(LABEL_TEST, "RunningLockNative020 function end!");
 }
@@ -2808,4 +2809,68 @@ HWTEST_F(RunningLockNativeTest, RunningLockNative083, TestSize.Level1)
 }
 #endif
 #endif
+
+/**
+ * @tc.name: RunningLockNative084
+ * @tc.desc: test running lock changes are delivered in batches in order
+ * @tc.type: FUNC
+ */
+HWTEST_F(RunningLockNativeTest, RunningLockNative084, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "RunningLockNative084 function start!");
+    auto& stream = RunningLockChangeStream::GetInstance();
+    sptr<PowerRunningLockBatchTestCallback> callback = new PowerRunningLockBatchTestCallback();
+    stream.SetObserver(callback);
+    constexpr uint32_t recordNum = RunningLockChangeStream::BATCH_SIZE + 10;
+    for (uint32_t index = 0; index < recordNum; index++) {
+        RunningLockParam param {index, "runninglockNativeTest_1", "bundle",
+            RunningLockType::RUNNINGLOCK_BACKGROUND, TIMEOUTMS, UNPID, UNUID};
+        RunningLockMgr::NotifyRunningLockChanged(param, RunningLockChangeAction::REMOVE);
+    }
+    // a timer or a full batch may already have delivered part of it, take the rest synchronously
+    stream.Flush();
+    ASSERT_EQ(callback->records_.size(), recordNum);
+    EXPECT_GE(callback->batchCount_, 2);
+    for (uint32_t index = 0; index < recordNum; index++) {
+        EXPECT_EQ(callback->records_[index].lockid, index);
+    }
+    EXPECT_EQ(callback->records_[0].name, "runninglockNativeTest");
+    EXPECT_EQ(callback->records_[0].action, RunningLockChangeAction::REMOVE);
+    EXPECT_EQ(callback->records_[0].ToMessage().find("TAG=DUBAI_TAG_RUNNINGLOCK_REMOVE") != std::string::npos, true);
+    stream.SetObserver(nullptr);
+    POWER_HILOGI(LABEL_TEST, "RunningLockNative084 function end!");
+}
+
+/**
+ * @tc.name: RunningLockNative085
+ * @tc.desc: test running lock changes beyond the ring capacity are dropped and counted
+ * @tc.type: FUNC
+ */
+HWTEST_F(RunningLockNativeTest, RunningLockNative085, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "RunningLockNative085 function start!");
+    auto& stream = RunningLockChangeStream::GetInstance();
+    RunningLockParam param {0, "runninglockNativeTest", "", RunningLockType::RUNNINGLOCK_BACKGROUND,
+        TIMEOUTMS, UNPID, UNUID};
+    RunningLockMgr::NotifyRunningLockChanged(param, RunningLockChangeAction::ADD);
+    EXPECT_EQ(stream.GetPendingCount(), 0);
+
+    sptr<PowerRunningLockBatchTestCallback> callback = new PowerRunningLockBatchTestCallback();
+    uint64_t droppedBefore = stream.GetDroppedCount();
+    constexpr uint32_t overflowNum = 10;
+    stream.SetObserver(callback);
+    {
+        // nothing is delivered while the ring is filled up
+        std::lock_guard<std::mutex> flushLock(stream.flushMutex_);
+        for (uint32_t index = 0; index < RunningLockChangeStream::RING_CAPACITY + overflowNum; index++) {
+            RunningLockMgr::NotifyRunningLockChanged(param, RunningLockChangeAction::ADD);
+        }
+    }
+    EXPECT_EQ(stream.GetDroppedCount(), droppedBefore + overflowNum);
+    stream.Flush();
+    EXPECT_EQ(callback->droppedCount_, overflowNum);
+    EXPECT_EQ(callback->records_.size(), RunningLockChangeStream::RING_CAPACITY);
+    stream.SetObserver(nullptr);
+    POWER_HILOGI(LABEL_TEST, "RunningLockNative085 function end!");
+}
 } // namespace
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define private public
+#define protected public
+#include "power_replay_harness.h"
+#undef private
+#undef protected
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <fstream>
+#include <sstream>
+
+#ifdef HAS_MULTIMODALINPUT_INPUT_PART
+#include <input_manager.h>
+#endif
+#include "iproximity_controller.h"
+#include "power_log.h"
+#include "power_utils.h"
+#include "running_lock_token_stub.h"
+#include "wakeup_controller.h"
+
+namespace OHOS {
+namespace PowerMgr {
+namespace {
+constexpr int32_t DECIMAL = 10;
+constexpr int64_t REPLAY_CLOCK_START_MS = 1000000;
+
+bool ToInt64(const std::string& str, int64_t& value)
+{
+    if (str.empty()) {
+        return false;
+    }
+    char* end = nullptr;
+    errno = 0;
+    long long result = strtoll(str.c_str(), &end, DECIMAL);
+    if (errno != 0 || end == nullptr || *end != '\0') {
+        return false;
+    }
+    value = static_cast<int64_t>(result);
+    return true;
+}
+} // namespace
+
+PowerReplayHarness::PowerReplayHarness(const sptr<PowerMgrService>& pms) : pms_(pms)
+{
+    clock_ = std::make_shared<VirtualPowerClock>(REPLAY_CLOCK_START_MS);
+    startMs_ = REPLAY_CLOCK_START_MS;
+    PowerClock::SetClock(clock_);
+}
+
+PowerReplayHarness::~PowerReplayHarness()
+{
+    for (const auto& [id, token] : tokens_) {
+        pms_->ReleaseRunningLock(token);
+    }
+    tokens_.clear();
+    PowerClock::SetClock(nullptr);
+}
+
+bool PowerReplayHarness::ParseLine(const std::string& line, Event& event)
+{
+    std::istringstream stream(line.substr(0, line.find('#')));
+    std::string time;
+    if (!(stream >> time)) {
+        return false;
+    }
+    if (!ToInt64(time, event.timeMs) || event.timeMs < 0 || !(stream >> event.name)) {
+        POWER_HILOGW(LABEL_TEST, "invalid replay line: %{public}s", line.c_str());
+        return false;
+    }
+    std::string arg;
+    while (stream >> arg) {
+        event.args.push_back(arg);
+    }
+    return true;
+}
+
+bool PowerReplayHarness::LoadString(const std::string& timeline)
+{
+    std::istringstream stream(timeline);
+    std::string line;
+    int64_t lastMs = 0;
+    while (std::getline(stream, line)) {
+        Event event;
+        if (!ParseLine(line, event)) {
+            continue;
+        }
+        if (event.timeMs < lastMs) {
+            POWER_HILOGE(LABEL_TEST, "replay timeline goes backwards at %{public}" PRId64 "ms", event.timeMs);
+            return false;
+        }
+        lastMs = event.timeMs;
+        events_.push_back(std::move(event));
+    }
+    POWER_HILOGI(LABEL_TEST, "replay timeline loaded, %{public}zu events", events_.size());
+    return !events_.empty();
+}
+
+bool PowerReplayHarness::LoadFile(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        POWER_HILOGE(LABEL_TEST, "open replay file %{public}s failed", path.c_str());
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return LoadString(buffer.str());
+}
+
+void PowerReplayHarness::CheckState(const std::string& trigger)
+{
+    PowerState state = pms_->GetPowerStateMachine()->GetState();
+    if (state == lastState_) {
+        return;
+    }
+    Transition transition;
+    transition.timeMs = clock_->GetTickCount() - startMs_;
+    transition.from = lastState_;
+    transition.to = state;
+    transition.trigger = trigger;
+    transition.latencyMs = lastInputMs_ < 0 ? -1 : transition.timeMs - lastInputMs_;
+    transitions_.push_back(transition);
+    lastState_ = state;
+}
+
+size_t PowerReplayHarness::Replay(int64_t tailMs)
+{
+    lastState_ = pms_->GetPowerStateMachine()->GetState();
+    auto onTimer = [this](int64_t) { CheckState("timer"); };
+    size_t dispatched = 0;
+    for (const auto& event : events_) {
+        clock_->AdvanceTo(startMs_ + event.timeMs, onTimer);
+        if (Dispatch(event)) {
+            dispatched++;
+        }
+        CheckState(event.name);
+    }
+    clock_->AdvanceBy(tailMs, onTimer);
+    return dispatched;
+}
+
+bool PowerReplayHarness::Dispatch(const Event& event)
+{
+    bool ret = true;
+    const std::vector<std::string>& args = event.args;
+    if (event.name == "key") {
+        ret = DispatchKey(event);
+    } else if (event.name == "touch") {
+        ret = DispatchTouch();
+    } else if (event.name == "lock" || event.name == "unlock" || event.name == "worksource" ||
+        event.name == "release") {
+        ret = DispatchLock(event);
+    } else if (event.name == "suspend" && !args.empty()) {
+        int64_t reason = 0;
+        ret = ToInt64(args[0], reason) && pms_->GetSuspendController() != nullptr;
+        if (ret) {
+            pms_->GetSuspendController()->ExecSuspendMonitorByReason(static_cast<SuspendDeviceType>(reason));
+        }
+    } else if (event.name == "proximity" && !args.empty()) {
+        pms_->MockProximity(args[0] == "close" ? IProximityController::PROXIMITY_CLOSE :
+            IProximityController::PROXIMITY_AWAY);
+    } else if (event.name == "hall") {
+        ret = DispatchHall(event);
+    } else if (event.name != "advance") {
+        ret = false;
+    }
+    if (event.name == "key" || event.name == "touch" || event.name == "hall" || event.name == "proximity") {
+        lastInputMs_ = event.timeMs;
+    }
+    if (!ret) {
+        POWER_HILOGW(LABEL_TEST, "replay event %{public}s at %{public}" PRId64 "ms failed",
+            event.name.c_str(), event.timeMs);
+    }
+    return ret;
+}
+
+bool PowerReplayHarness::DispatchKey(const Event& event)
+{
+#ifdef HAS_MULTIMODALINPUT_INPUT_PART
+    int64_t keyCode = 0;
+    if (event.args.empty() || !ToInt64(event.args[0], keyCode)) {
+        return false;
+    }
+    std::shared_ptr<MMI::KeyEvent> keyEvent = MMI::KeyEvent::Create();
+    keyEvent->SetKeyCode(static_cast<int32_t>(keyCode));
+    bool isUp = event.args.size() > 1 && event.args[1] == "up";
+    keyEvent->SetKeyAction(isUp ? MMI::KeyEvent::KEY_ACTION_UP : MMI::KeyEvent::KEY_ACTION_DOWN);
+    InputCallback callback;
+    callback.OnInputEvent(keyEvent);
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool PowerReplayHarness::DispatchTouch()
+{
+#ifdef HAS_MULTIMODALINPUT_INPUT_PART
+    auto pointerEvent = MMI::PointerEvent::Create();
+    MMI::PointerEvent::PointerItem item;
+    item.SetPointerId(0);
+    item.SetToolType(MMI::PointerEvent::TOOL_TYPE_FINGER);
+    pointerEvent->AddPointerItem(item);
+    pointerEvent->SetPointerId(0);
+    pointerEvent->SetPointerAction(MMI::PointerEvent::POINTER_ACTION_DOWN);
+    pointerEvent->SetSourceType(MMI::PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+    InputCallback callback;
+    callback.OnInputEvent(pointerEvent);
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool PowerReplayHarness::DispatchLock(const Event& event)
+{
+    if (event.args.empty()) {
+        return false;
+    }
+    const std::string& id = event.args[0];
+    auto iter = tokens_.find(id);
+    if (event.name == "lock") {
+        int64_t type = 0;
+        if (event.args.size() < 2 || !ToInt64(event.args[1], type)) {
+            return false;
+        }
+        int64_t timeoutMs = -1;
+        if (event.args.size() > 2 && !ToInt64(event.args[2], timeoutMs)) {
+            return false;
+        }
+        if (iter == tokens_.end()) {
+            sptr<IRemoteObject> token = new RunningLockTokenStub();
+            RunningLockInfo info("replay_lock_" + id, static_cast<RunningLockType>(type));
+            if (pms_->CreateRunningLock(token, info) != PowerErrors::ERR_OK) {
+                return false;
+            }
+            iter = tokens_.emplace(id, token).first;
+        }
+        return pms_->Lock(iter->second, static_cast<int32_t>(timeoutMs)) == PowerErrors::ERR_OK;
+    }
+    if (iter == tokens_.end()) {
+        return false;
+    }
+    if (event.name == "unlock") {
+        return pms_->UnLock(iter->second) == PowerErrors::ERR_OK;
+    }
+    if (event.name == "worksource") {
+        std::vector<int32_t> workSources;
+        std::istringstream stream(event.args.size() > 1 ? event.args[1] : "");
+        std::string uid;
+        int64_t value = 0;
+        while (std::getline(stream, uid, ',')) {
+            if (!ToInt64(uid, value)) {
+                return false;
+            }
+            workSources.push_back(static_cast<int32_t>(value));
+        }
+        return pms_->UpdateWorkSource(iter->second, workSources);
+    }
+    bool ret = pms_->ReleaseRunningLock(iter->second);
+    tokens_.erase(iter);
+    return ret;
+}
+
+bool PowerReplayHarness::DispatchHall(const Event& event)
+{
+#ifdef HAS_SENSORS_SENSOR_PART
+    if (event.args.empty()) {
+        return false;
+    }
+    SensorEvent sensorEvent;
+    HallData data;
+    data.status = event.args[0] == "close" ? 1 : 0;
+    sensorEvent.sensorTypeId = SENSOR_TYPE_ID_HALL;
+    sensorEvent.data = reinterpret_cast<uint8_t*>(&data);
+    sensorEvent.dataLen = sizeof(HallData);
+    PowerMgrService::HallSensorCallback(&sensorEvent);
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::string PowerReplayHarness::GetReport() const
+{
+    std::string result("REPLAY REPORT: events=");
+    result.append(std::to_string(events_.size()))
+        .append(" transitions=").append(std::to_string(transitions_.size())).append("\n");
+    int64_t maxLatencyMs = -1;
+    for (const auto& transition : transitions_) {
+        result.append("  ").append(std::to_string(transition.timeMs)).append("ms ")
+            .append(PowerUtils::GetPowerStateString(transition.from)).append(" -> ")
+            .append(PowerUtils::GetPowerStateString(transition.to))
+            .append(" trigger=").append(transition.trigger)
+            .append(" latency=").append(std::to_string(transition.latencyMs)).append("ms\n");
+        maxLatencyMs = std::max(maxLatencyMs, transition.latencyMs);
+    }
+    result.append("  max latency=").append(std::to_string(maxLatencyMs)).append("ms\n");
+    return result;
+}
+} // namespace PowerMgr
+} // namespace OHOS
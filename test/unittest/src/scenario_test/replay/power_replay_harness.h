@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_POWER_REPLAY_HARNESS_H
+#define POWERMGR_POWER_REPLAY_HARNESS_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "power_clock.h"
+#include "power_mgr_service.h"
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Replays a recorded timeline of input, running lock, suspend, proximity and hall
+ * events against the power service on a virtual clock.
+ *
+ * Timeline lines are "<timeMs> <event> [args...]", '#' starts a comment:
+ *   key <keyCode> down|up
+ *   touch
+ *   lock <id> <runningLockType> [timeoutMs]
+ *   unlock <id>
+ *   worksource <id> <uid>[,<uid>...]
+ *   release <id>
+ *   suspend <SuspendDeviceType>
+ *   proximity close|away
+ *   hall open|close
+ *   advance
+ * Timestamps are relative to the start of the replay and must not decrease.
+ */
+class PowerReplayHarness {
+public:
+    struct Event {
+        int64_t timeMs {0};
+        std::string name;
+        std::vector<std::string> args;
+    };
+    struct Transition {
+        int64_t timeMs {0};
+        PowerState from {PowerState::UNKNOWN};
+        PowerState to {PowerState::UNKNOWN};
+        std::string trigger;
+        // time since the last dispatched input event, -1 if none was dispatched
+        int64_t latencyMs {-1};
+    };
+
+    explicit PowerReplayHarness(const sptr<PowerMgrService>& pms);
+    ~PowerReplayHarness();
+    bool LoadFile(const std::string& path);
+    bool LoadString(const std::string& timeline);
+    /**
+     * Replay all loaded events, then run the clock for tailMs more.
+     *
+     * @return number of events dispatched successfully.
+     */
+    size_t Replay(int64_t tailMs = 0);
+    const std::vector<Transition>& GetTransitions() const
+    {
+        return transitions_;
+    }
+    std::shared_ptr<VirtualPowerClock> GetClock() const
+    {
+        return clock_;
+    }
+    std::string GetReport() const;
+
+private:
+    static bool ParseLine(const std::string& line, Event& event);
+    bool Dispatch(const Event& event);
+    bool DispatchKey(const Event& event);
+    bool DispatchTouch();
+    bool DispatchLock(const Event& event);
+    bool DispatchHall(const Event& event);
+    void CheckState(const std::string& trigger);
+
+    sptr<PowerMgrService> pms_;
+    std::shared_ptr<VirtualPowerClock> clock_;
+    int64_t startMs_ {0};
+    int64_t lastInputMs_ {-1};
+    PowerState lastState_ {PowerState::UNKNOWN};
+    std::vector<Event> events_;
+    std::vector<Transition> transitions_;
+    std::map<std::string, sptr<IRemoteObject>> tokens_;
+};
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWERMGR_POWER_REPLAY_HARNESS_H
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <gtest/gtest.h>
+
+#include "ffrt_utils.h"
+#include "power_log.h"
+#include "power_replay_harness.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace PowerMgr {
+namespace {
+sptr<PowerMgrService> g_service = nullptr;
+constexpr int32_t DISPLAY_OFF_TIME_MS = 30000;
+constexpr int64_t REPLAY_TAIL_MS = 60000;
+const std::string REPLAY_FILE = "/data/test/power_replay_timeline.txt";
+} // namespace
+
+class PowerReplayTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        g_service = DelayedSpSingleton<PowerMgrService>::GetInstance();
+        g_service->OnStart();
+    }
+    static void TearDownTestCase()
+    {
+        g_service->OnStop();
+        DelayedSpSingleton<PowerMgrService>::DestroyInstance();
+    }
+    void SetUp()
+    {
+        g_service->WakeupDevice(0, WakeupDeviceType::WAKEUP_DEVICE_APPLICATION, "PowerReplayTest");
+    }
+    void TearDown()
+    {
+        g_service->RestoreScreenOffTime();
+    }
+};
+
+/**
+ * @tc.name: PowerReplayTest001
+ * @tc.desc: test the virtual clock runs delay tasks in due order and honours cancel
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerReplayTest, PowerReplayTest001, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerReplayTest001 function start!");
+    auto clock = std::make_shared<VirtualPowerClock>(0);
+    std::string order;
+    clock->SubmitDelayTask([&order]() { order.append("b"); }, 20);
+    clock->SubmitDelayTask([&order]() { order.append("a"); }, 10);
+    uint64_t cancelId = clock->SubmitDelayTask([&order]() { order.append("x"); }, 15);
+    clock->CancelTask(cancelId);
+    EXPECT_EQ(clock->GetNextDueTime(), 10);
+    EXPECT_EQ(clock->AdvanceTo(15), 1);
+    EXPECT_EQ(clock->GetTickCount(), 15);
+    EXPECT_EQ(clock->AdvanceBy(100), 1);
+    EXPECT_EQ(order, "ab");
+    EXPECT_EQ(clock->GetPendingCount(), 0);
+
+    PowerClock::SetClock(clock);
+    EXPECT_EQ(PowerClock::GetTickCount(), 115);
+    FFRTTimer timer("PowerReplayTest001");
+    bool fired = false;
+    FFRTTask task = [&fired]() { fired = true; };
+    timer.SetTimer(0, task, 10);
+    EXPECT_EQ(clock->GetPendingCount(), 1);
+    clock->AdvanceBy(10);
+    EXPECT_TRUE(fired);
+    PowerClock::SetClock(nullptr);
+    EXPECT_NE(PowerClock::GetTickCount(), 115);
+    POWER_HILOGI(LABEL_TEST, "PowerReplayTest001 function end!");
+}
+
+/**
+ * @tc.name: PowerReplayTest002
+ * @tc.desc: test replaying an input and lock storm turns the screen off by timeout deterministically
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerReplayTest, PowerReplayTest002, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerReplayTest002 function start!");
+    {
+        std::ofstream file(REPLAY_FILE, std::ios::trunc);
+        file << "# time event args\n";
+        for (int32_t index = 0; index < 50; index++) {
+            file << index * 20 << " touch\n";
+        }
+        file << "1000 lock 1 2\n"
+             << "1010 worksource 1 1000,1001\n"
+             << "1100 unlock 1\n"
+             << "1200 release 1\n"
+             << "1300 key 2 down\n"
+             << "1310 key 2 up\n";
+    }
+    PowerReplayHarness harness(g_service);
+    g_service->OverrideScreenOffTime(DISPLAY_OFF_TIME_MS);
+    ASSERT_TRUE(harness.LoadFile(REPLAY_FILE));
+    harness.Replay(REPLAY_TAIL_MS);
+    std::string report = harness.GetReport();
+    POWER_HILOGI(LABEL_TEST, "%{public}s", report.c_str());
+    EXPECT_NE(report.find("REPLAY REPORT"), std::string::npos);
+    EXPECT_NE(g_service->GetState(), PowerState::AWAKE);
+    for (const auto& transition : harness.GetTransitions()) {
+        EXPECT_GE(transition.latencyMs, 0);
+    }
+    POWER_HILOGI(LABEL_TEST, "PowerReplayTest002 function end!");
+}
+
+/**
+ * @tc.name: PowerReplayTest003
+ * @tc.desc: test malformed and backwards timelines are rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(PowerReplayTest, PowerReplayTest003, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "PowerReplayTest003 function start!");
+    {
+        PowerReplayHarness harness(g_service);
+        EXPECT_FALSE(harness.LoadString("abc touch\n# only comment\n"));
+        EXPECT_FALSE(harness.LoadFile("/data/test/power_replay_not_exist.txt"));
+    }
+    {
+        PowerReplayHarness harness(g_service);
+        EXPECT_FALSE(harness.LoadString("100 touch\n50 touch\n"));
+    }
+    {
+        PowerReplayHarness harness(g_service);
+        EXPECT_TRUE(harness.LoadString("0 unknown\n10 unlock 9\n20 advance\n"));
+        EXPECT_EQ(harness.Replay(), 1);
+    }
+    EXPECT_EQ(PowerClock::GetClock(), nullptr);
+    POWER_HILOGI(LABEL_TEST, "PowerReplayTest003 function end!");
+}
+} // namespace PowerMgr
+} // namespace OHOS
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <power_log.h>
+
+#include "actions/running_lock_action_info.h"
+#include "screen_lock_index.h"
+
+namespace OHOS {
+namespace PowerMgr {
+using namespace testing;
+using namespace ext;
+namespace {
+constexpr uint64_t DISPLAY_MAIN = 0;
+constexpr uint64_t DISPLAY_SUB = 1001;
+constexpr uint64_t DISPLAY_IDLE = 1002;
+
+RunningLockInfo MakeScreenLock(const std::string& name, uint64_t displayId)
+{
+    RunningLockInfo info(name, RunningLockType::RUNNINGLOCK_SCREEN);
+    info.displayId = displayId;
+    return info;
+}
+} // namespace
+
+class ScreenLockIndexTest : public Test {
+protected:
+    ScreenLockIndex index_;
+};
+
+namespace {
+/**
+ * @tc.name: ScreenLockIndexTest001
+ * @tc.desc: Each display counts its own locks plus those of all displays
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScreenLockIndexTest, ScreenLockIndexTest001, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "ScreenLockIndexTest001 function start!");
+    EXPECT_TRUE(index_.Add("1", MakeScreenLock("main", DISPLAY_MAIN)));
+    EXPECT_TRUE(index_.Add("2", MakeScreenLock("sub", DISPLAY_SUB)));
+    EXPECT_TRUE(index_.Add("3", MakeScreenLock("sub2", DISPLAY_SUB)));
+    EXPECT_FALSE(index_.Add("3", MakeScreenLock("sub2", DISPLAY_SUB)));
+    EXPECT_EQ(index_.GetCount(DISPLAY_MAIN), 1);
+    EXPECT_EQ(index_.GetCount(DISPLAY_SUB), 2);
+    EXPECT_EQ(index_.GetCount(DISPLAY_IDLE), 0);
+    EXPECT_EQ(index_.GetCount(RUNNINGLOCK_DISPLAY_ID_ALL), 0);
+
+    EXPECT_TRUE(index_.Add("4", MakeScreenLock("all", RUNNINGLOCK_DISPLAY_ID_ALL)));
+    EXPECT_EQ(index_.GetCount(DISPLAY_MAIN), 2);
+    EXPECT_EQ(index_.GetCount(DISPLAY_SUB), 3);
+    EXPECT_EQ(index_.GetCount(DISPLAY_IDLE), 1);
+    EXPECT_EQ(index_.GetCount(RUNNINGLOCK_DISPLAY_ID_ALL), 1);
+    EXPECT_EQ(index_.GetTotalCount(), 4);
+
+    EXPECT_TRUE(index_.Remove("2"));
+    EXPECT_FALSE(index_.Remove("2"));
+    EXPECT_TRUE(index_.Remove("4"));
+    EXPECT_EQ(index_.GetCount(DISPLAY_SUB), 1);
+    EXPECT_EQ(index_.GetCount(DISPLAY_IDLE), 0);
+    EXPECT_EQ(index_.GetTotalCount(), 2);
+    POWER_HILOGI(LABEL_TEST, "ScreenLockIndexTest001 function end!");
+}
+
+/**
+ * @tc.name: ScreenLockIndexTest002
+ * @tc.desc: Queries return the locks of one display or of all of them
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScreenLockIndexTest, ScreenLockIndexTest002, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "ScreenLockIndexTest002 function start!");
+    index_.Add("1", MakeScreenLock("main", DISPLAY_MAIN));
+    index_.Add("2", MakeScreenLock("sub", DISPLAY_SUB));
+    index_.Add("3", MakeScreenLock("all", RUNNINGLOCK_DISPLAY_ID_ALL));
+
+    std::map<std::string, RunningLockInfo> lockLists;
+    index_.Query(lockLists, DISPLAY_SUB);
+    ASSERT_EQ(lockLists.size(), 2);
+    EXPECT_EQ(lockLists["2"].name, "sub");
+    EXPECT_EQ(lockLists["3"].name, "all");
+
+    lockLists.clear();
+    index_.Query(lockLists, RUNNINGLOCK_DISPLAY_ID_ALL);
+    EXPECT_EQ(lockLists.size(), 1);
+
+    lockLists.clear();
+    index_.QueryAll(lockLists);
+    EXPECT_EQ(lockLists.size(), 3);
+
+    std::string dump;
+    index_.DumpInfo(dump);
+    EXPECT_NE(dump.find("D=1001 own=1 effective=2"), std::string::npos);
+    EXPECT_NE(dump.find("D=ALL own=1 effective=1"), std::string::npos);
+    POWER_HILOGI(LABEL_TEST, "ScreenLockIndexTest002 function end!");
+}
+} // namespace
+} // namespace PowerMgr
+} // namespace OHOS
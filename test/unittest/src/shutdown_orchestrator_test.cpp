@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+#include <power_log.h>
+#include <shutdown_orchestrator.h>
+
+namespace OHOS {
+namespace PowerMgr {
+using namespace testing;
+using namespace ext;
+namespace {
+constexpr int64_t BUDGET_MS = 1000;
+constexpr int64_t PHASE_BUDGET_MS = 200;
+constexpr int64_t SLOW_PHASE_MS = 100;
+constexpr int64_t SHORT_BUDGET_MS = 300;
+constexpr int64_t HUNG_PHASE_MS = 1000;
+const std::string REPORT_PATH = "/data/local/tmp/shutdown_orchestrator_test_report";
+
+ShutdownOrchestrator::PhaseRecord FindRecord(const ShutdownOrchestrator& orchestrator, const std::string& name)
+{
+    for (const auto& record : orchestrator.GetRecords()) {
+        if (record.name == name) {
+            return record;
+        }
+    }
+    return {};
+}
+} // namespace
+
+class ShutdownOrchestratorTest : public Test {
+public:
+    void SetUp() {}
+    void TearDown() {}
+    static void SetUpTestCase() {}
+    static void TearDownTestCase()
+    {
+        unlink(REPORT_PATH.c_str());
+    }
+};
+
+namespace {
+/**
+ * @tc.name: ShutdownOrchestratorTest001
+ * @tc.desc: invalid phases are rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(ShutdownOrchestratorTest, ShutdownOrchestratorTest001, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "ShutdownOrchestratorTest001 function start!");
+    ShutdownOrchestrator orchestrator(BUDGET_MS);
+    auto noop = []() {};
+    EXPECT_TRUE(orchestrator.AddPhase("a", {}, PHASE_BUDGET_MS, noop));
+    EXPECT_FALSE(orchestrator.AddPhase("a", {}, PHASE_BUDGET_MS, noop));
+    EXPECT_FALSE(orchestrator.AddPhase("b", {"unknown"}, PHASE_BUDGET_MS, noop));
+    EXPECT_FALSE(orchestrator.AddPhase("b", {}, BUDGET_MS + 1, noop));
+    EXPECT_FALSE(orchestrator.AddPhase("b", {}, 0, noop));
+    EXPECT_FALSE(orchestrator.AddPhase("b", {}, PHASE_BUDGET_MS, nullptr));
+    EXPECT_TRUE(orchestrator.AddPhase("b", {"a"}, PHASE_BUDGET_MS, noop));
+    EXPECT_EQ(orchestrator.GetRecords().size(), 2U);
+    POWER_HILOGI(LABEL_TEST, "ShutdownOrchestratorTest001 function end!");
+}
+
+/**
+ * @tc.name: ShutdownOrchestratorTest002
+ * @tc.desc: independent phases overlap, a dependent phase starts after its dependency
+ * @tc.type: FUNC
+ */
+HWTEST_F(ShutdownOrchestratorTest, ShutdownOrchestratorTest002, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "ShutdownOrchestratorTest002 function start!");
+    ShutdownOrchestrator orchestrator(BUDGET_MS);
+    auto slow = []() { std::this_thread::sleep_for(std::chrono::milliseconds(SLOW_PHASE_MS)); };
+    std::atomic<bool> syncDone {false};
+    std::atomic<bool> orderKept {false};
+    EXPECT_TRUE(orchestrator.AddPhase("sync", {}, PHASE_BUDGET_MS, [&syncDone, slow]() {
+        slow();
+        syncDone = true;
+    }));
+    EXPECT_TRUE(orchestrator.AddPhase("async", {}, PHASE_BUDGET_MS, slow));
+    EXPECT_TRUE(orchestrator.AddPhase("screen", {"sync"}, PHASE_BUDGET_MS,
+        [&syncDone, &orderKept]() { orderKept = syncDone.load(); }));
+    EXPECT_TRUE(orchestrator.Run());
+    EXPECT_TRUE(orderKept.load());
+    // the two slow phases ran side by side
+    EXPECT_LT(orchestrator.GetTotalCostMs(), SLOW_PHASE_MS * 2);
+    EXPECT_GE(FindRecord(orchestrator, "screen").startMs, SLOW_PHASE_MS);
+    EXPECT_GE(orchestrator.GetPhaseEndMs("screen"), SLOW_PHASE_MS);
+    EXPECT_EQ(FindRecord(orchestrator, "async").state, ShutdownOrchestrator::PhaseState::DONE);
+    POWER_HILOGI(LABEL_TEST, "ShutdownOrchestratorTest002 function end!");
+}
+
+/**
+ * @tc.name: ShutdownOrchestratorTest003
+ * @tc.desc: a hung phase times out, its dependents still run and Run returns at the deadline
+ * @tc.type: FUNC
+ */
+HWTEST_F(ShutdownOrchestratorTest, ShutdownOrchestratorTest003, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "ShutdownOrchestratorTest003 function start!");
+    ShutdownOrchestrator orchestrator(SHORT_BUDGET_MS);
+    auto hung = []() { std::this_thread::sleep_for(std::chrono::milliseconds(HUNG_PHASE_MS)); };
+    std::atomic<bool> screenOff {false};
+    EXPECT_TRUE(orchestrator.AddPhase("sync", {}, SLOW_PHASE_MS, hung));
+    EXPECT_TRUE(orchestrator.AddPhase("screen", {"sync"}, SLOW_PHASE_MS, [&screenOff]() { screenOff = true; }));
+    EXPECT_TRUE(orchestrator.AddPhase("async", {}, SHORT_BUDGET_MS, hung));
+    EXPECT_TRUE(orchestrator.AddPhase("late", {"async"}, SLOW_PHASE_MS, []() {}));
+    int64_t beginMs = ShutdownOrchestrator::GetNowMs();
+    EXPECT_FALSE(orchestrator.Run());
+    EXPECT_LT(ShutdownOrchestrator::GetNowMs() - beginMs, HUNG_PHASE_MS);
+    EXPECT_TRUE(screenOff.load());
+    EXPECT_EQ(FindRecord(orchestrator, "sync").state, ShutdownOrchestrator::PhaseState::TIMEOUT);
+    EXPECT_EQ(FindRecord(orchestrator, "screen").state, ShutdownOrchestrator::PhaseState::DONE);
+    EXPECT_EQ(FindRecord(orchestrator, "async").state, ShutdownOrchestrator::PhaseState::TIMEOUT);
+    EXPECT_EQ(FindRecord(orchestrator, "late").state, ShutdownOrchestrator::PhaseState::SKIPPED);
+    EXPECT_EQ(orchestrator.GetPhaseEndMs("sync"), -1);
+    POWER_HILOGI(LABEL_TEST, "ShutdownOrchestratorTest003 function end!");
+}
+
+/**
+ * @tc.name: ShutdownOrchestratorTest004
+ * @tc.desc: the report is written to a file and read back
+ * @tc.type: FUNC
+ */
+HWTEST_F(ShutdownOrchestratorTest, ShutdownOrchestratorTest004, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "ShutdownOrchestratorTest004 function start!");
+    ShutdownOrchestrator orchestrator(BUDGET_MS);
+    EXPECT_TRUE(orchestrator.AddPhase("sync", {}, PHASE_BUDGET_MS, []() {}));
+    EXPECT_TRUE(orchestrator.AddPhase("screen", {"sync"}, PHASE_BUDGET_MS, []() {}));
+    EXPECT_TRUE(orchestrator.Run());
+    std::string report = orchestrator.FormatReport();
+    EXPECT_NE(report.find("screen budget=200ms"), std::string::npos);
+    EXPECT_NE(report.find("state=done deps=sync"), std::string::npos);
+    EXPECT_TRUE(ShutdownOrchestrator::SaveReport(REPORT_PATH, report));
+    EXPECT_EQ(ShutdownOrchestrator::LoadReport(REPORT_PATH), report);
+    EXPECT_TRUE(ShutdownOrchestrator::LoadReport(REPORT_PATH + ".missing").empty());
+    POWER_HILOGI(LABEL_TEST, "ShutdownOrchestratorTest004 function end!");
+}
+} // namespace
+} // namespace PowerMgr
+} // namespace OHOS
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <power_log.h>
+#include <suspend_entry_trace.h>
+
+namespace OHOS {
+namespace PowerMgr {
+using namespace testing;
+using namespace ext;
+class SuspendEntryTraceTest : public Test {
+public:
+    void SetUp() {}
+    void TearDown() {}
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+};
+
+namespace {
+/**
+ * @tc.name: SuspendEntryTraceTest001
+ * @tc.desc: test the phases of a cycle are recorded and dumped
+ * @tc.type: FUNC
+ */
+HWTEST_F(SuspendEntryTraceTest, SuspendEntryTraceTest001, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "SuspendEntryTraceTest001 function start!");
+    SuspendEntryTrace trace;
+    uint64_t id = trace.Begin(SuspendDeviceType::SUSPEND_DEVICE_REASON_TIMEOUT, false);
+    trace.Record(id, SuspendEntryTrace::Phase::STATE_CHANGE, 100);
+    trace.Record(id, SuspendEntryTrace::Phase::CALLBACKS, 200);
+    trace.Record(id, SuspendEntryTrace::Phase::BUTT, 400);
+    std::string info;
+    trace.DumpInfo(info);
+    EXPECT_NE(info.find("state=pending"), std::string::npos);
+
+    trace.Record(id, SuspendEntryTrace::Phase::HDI_CALL, 300);
+    trace.End(id);
+    info.clear();
+    trace.DumpInfo(info);
+    EXPECT_NE(info.find("callbacks=200us"), std::string::npos);
+    EXPECT_NE(info.find("hdi=300us"), std::string::npos);
+    EXPECT_NE(info.find("total=600us"), std::string::npos);
+    EXPECT_NE(info.find("state=done"), std::string::npos);
+    POWER_HILOGI(LABEL_TEST, "SuspendEntryTraceTest001 function end!");
+}
+
+/**
+ * @tc.name: SuspendEntryTraceTest002
+ * @tc.desc: test only the latest cycles are kept and late records of dropped cycles are ignored
+ * @tc.type: FUNC
+ */
+HWTEST_F(SuspendEntryTraceTest, SuspendEntryTraceTest002, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "SuspendEntryTraceTest002 function start!");
+    SuspendEntryTrace trace;
+    uint64_t first = trace.Begin(SuspendDeviceType::SUSPEND_DEVICE_REASON_POWER_KEY, true);
+    uint64_t last = first;
+    for (size_t index = 0; index < SuspendEntryTrace::MAX_CYCLE_NUM; index++) {
+        last = trace.Begin(SuspendDeviceType::SUSPEND_DEVICE_REASON_TIMEOUT, false);
+    }
+    trace.Record(first, SuspendEntryTrace::Phase::HDI_CALL, 100);
+    trace.End(first);
+    trace.Record(last, SuspendEntryTrace::Phase::HDI_CALL, 50);
+
+    std::vector<SuspendEntryTrace::Cycle> cycles = trace.GetCycles();
+    ASSERT_EQ(cycles.size(), SuspendEntryTrace::MAX_CYCLE_NUM);
+    EXPECT_EQ(cycles.front().id, first + 1);
+    EXPECT_EQ(cycles.back().id, last);
+    EXPECT_EQ(cycles.back().costUs[static_cast<uint32_t>(SuspendEntryTrace::Phase::HDI_CALL)], 50);
+    for (const auto& cycle : cycles) {
+        EXPECT_FALSE(cycle.force);
+        EXPECT_FALSE(cycle.completed);
+    }
+    POWER_HILOGI(LABEL_TEST, "SuspendEntryTraceTest002 function end!");
+}
+} // namespace
+} // namespace PowerMgr
+} // namespace OHOS
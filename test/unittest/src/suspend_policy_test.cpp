@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <power_log.h>
+#include <suspend_policy.h>
+
+namespace OHOS {
+namespace PowerMgr {
+using namespace testing;
+using namespace ext;
+class SuspendPolicyTest : public Test {
+public:
+    void SetUp() {}
+    void TearDown() {}
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+};
+
+namespace {
+/**
+ * @tc.name: SuspendPolicyTest001
+ * @tc.desc: test the auto sleep result follows the settings of the current power supply
+ * @tc.type: FUNC
+ */
+HWTEST_F(SuspendPolicyTest, SuspendPolicyTest001, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "SuspendPolicyTest001 function start!");
+    SuspendPolicy policy;
+    policy.acDisplayOffTime = 30000;
+    policy.acSleepTime = 120000;
+    policy.dcDisplayOffTime = 15000;
+    policy.dcSleepTime = 10000;
+
+    policy.powerConnected = true;
+    EXPECT_EQ(policy.CalculateAutoSleepResult(SuspendDeviceType::SUSPEND_DEVICE_REASON_TIMEOUT), 90000);
+    EXPECT_EQ(policy.CalculateAutoSleepResult(SuspendDeviceType::SUSPEND_DEVICE_REASON_POWER_KEY), 120000);
+    EXPECT_EQ(policy.CalculateAutoSleepResult(SuspendDeviceType::SUSPEND_DEVICE_REASON_LID), 120000);
+
+    policy.powerConnected = false;
+    EXPECT_EQ(policy.CalculateAutoSleepResult(SuspendDeviceType::SUSPEND_DEVICE_REASON_TIMEOUT),
+        SuspendPolicy::SLEEP_NOW);
+    EXPECT_EQ(policy.CalculateAutoSleepResult(SuspendDeviceType::SUSPEND_DEVICE_REASON_SWITCH), 10000);
+
+    policy.dcSleepTime = SuspendPolicy::SLEEP_NEVER;
+    EXPECT_EQ(policy.CalculateAutoSleepResult(SuspendDeviceType::SUSPEND_DEVICE_REASON_POWER_KEY),
+        SuspendPolicy::SLEEP_NEVER);
+    POWER_HILOGI(LABEL_TEST, "SuspendPolicyTest001 function end!");
+}
+
+/**
+ * @tc.name: SuspendPolicyTest002
+ * @tc.desc: test updates publish a new policy and leave the old one untouched
+ * @tc.type: FUNC
+ */
+HWTEST_F(SuspendPolicyTest, SuspendPolicyTest002, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "SuspendPolicyTest002 function start!");
+    SuspendPolicySnapshot snapshot;
+    std::shared_ptr<const SuspendPolicy> before = snapshot.Get();
+    ASSERT_NE(before, nullptr);
+
+    snapshot.Update([](SuspendPolicy& policy) {
+        policy.powerConnected = true;
+        policy.acSleepTime = 5000;
+    });
+    snapshot.Update(nullptr);
+    std::shared_ptr<const SuspendPolicy> after = snapshot.Get();
+    EXPECT_FALSE(before->powerConnected);
+    EXPECT_EQ(before->acSleepTime, SuspendPolicy::DEFAULT_TIME_MS);
+    EXPECT_EQ(after->GetSleepTime(), 5000);
+    POWER_HILOGI(LABEL_TEST, "SuspendPolicyTest002 function end!");
+}
+
+/**
+ * @tc.name: SuspendPolicyTest003
+ * @tc.desc: benchmark the suspend decision while the settings keep changing
+ * @tc.type: PERF
+ */
+HWTEST_F(SuspendPolicyTest, SuspendPolicyTest003, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "SuspendPolicyTest003 function start!");
+    constexpr int64_t loopCount = 1000000;
+    SuspendPolicySnapshot snapshot;
+    snapshot.Update([](SuspendPolicy& policy) {
+        policy.dcSleepTime = SuspendPolicy::DEFAULT_TIME_MS * 2;
+    });
+    std::atomic_bool stop {false};
+    uint64_t updateCount = 0;
+    std::thread writer([&snapshot, &stop, &updateCount]() {
+        int64_t time = SuspendPolicy::DEFAULT_TIME_MS;
+        while (!stop.load()) {
+            snapshot.Update([time](SuspendPolicy& policy) {
+                policy.dcDisplayOffTime = time;
+                policy.dcSleepTime = time * 2;
+            });
+            time++;
+            updateCount++;
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    });
+
+    int64_t invalidCount = 0;
+    auto begin = std::chrono::steady_clock::now();
+    for (int64_t index = 0; index < loopCount; index++) {
+        int64_t result = snapshot.Get()->CalculateAutoSleepResult(SuspendDeviceType::SUSPEND_DEVICE_REASON_TIMEOUT);
+        // display off and sleep time always come from the same update
+        invalidCount += (result < SuspendPolicy::DEFAULT_TIME_MS) ? 1 : 0;
+    }
+    auto costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    stop.store(true);
+    writer.join();
+
+    POWER_HILOGI(LABEL_TEST, "decisions=%{public}" PRId64 ", avg=%{public}" PRId64 "ns, updates=%{public}" PRIu64,
+        loopCount, static_cast<int64_t>(costNs) / loopCount, updateCount);
+    EXPECT_EQ(invalidCount, 0);
+    POWER_HILOGI(LABEL_TEST, "SuspendPolicyTest003 function end!");
+}
+} // namespace
+} // namespace PowerMgr
+} // namespace OHOS
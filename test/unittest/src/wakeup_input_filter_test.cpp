@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <power_log.h>
+#include <wakeup_input_filter.h>
+
+namespace OHOS {
+namespace PowerMgr {
+using namespace testing;
+using namespace ext;
+
+class WakeupInputFilterTest : public Test {
+public:
+    void SetUp() {}
+    void TearDown() {}
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+};
+
+namespace {
+/**
+ * @tc.name: WakeupInputFilterTest001
+ * @tc.desc: only the device types in the enabled bitmap pass the filter
+ * @tc.type: FUNC
+ */
+HWTEST_F(WakeupInputFilterTest, WakeupInputFilterTest001, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "WakeupInputFilterTest001 function start!");
+    WakeupInputFilter filter;
+    EXPECT_FALSE(filter.IsEnabled(WakeupDeviceType::WAKEUP_DEVICE_SINGLE_CLICK));
+    filter.SetEnabledTypes(WakeupInputFilter::ToMask(WakeupDeviceType::WAKEUP_DEVICE_SINGLE_CLICK) |
+        WakeupInputFilter::ToMask(WakeupDeviceType::WAKEUP_DEVICE_KEYBOARD));
+    EXPECT_TRUE(filter.IsEnabled(WakeupDeviceType::WAKEUP_DEVICE_SINGLE_CLICK));
+    EXPECT_TRUE(filter.IsEnabled(WakeupDeviceType::WAKEUP_DEVICE_KEYBOARD));
+    EXPECT_FALSE(filter.IsEnabled(WakeupDeviceType::WAKEUP_DEVICE_MOUSE));
+    EXPECT_FALSE(filter.IsEnabled(WakeupDeviceType::WAKEUP_DEVICE_UNKNOWN));
+    EXPECT_FALSE(filter.IsEnabled(WakeupDeviceType::WAKEUP_DEVICE_MAX));
+    EXPECT_EQ(WakeupInputFilter::ToMask(WakeupDeviceType::WAKEUP_DEVICE_MAX), 0ULL);
+    filter.SetEnabledTypes(0);
+    EXPECT_FALSE(filter.IsEnabled(WakeupDeviceType::WAKEUP_DEVICE_SINGLE_CLICK));
+    POWER_HILOGI(LABEL_TEST, "WakeupInputFilterTest001 function end!");
+}
+
+/**
+ * @tc.name: WakeupInputFilterTest002
+ * @tc.desc: awake events are coalesced over one second, dim and inactive are full rate
+ * @tc.type: FUNC
+ */
+HWTEST_F(WakeupInputFilterTest, WakeupInputFilterTest002, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "WakeupInputFilterTest002 function start!");
+    EXPECT_EQ(WakeupInputFilter::GetSubscribeInterval(PowerState::AWAKE), WakeupInputFilter::AWAKE_INTERVAL_MS);
+    EXPECT_EQ(WakeupInputFilter::GetSubscribeInterval(PowerState::DIM), 0);
+    EXPECT_EQ(WakeupInputFilter::GetSubscribeInterval(PowerState::INACTIVE), 0);
+    EXPECT_LT(WakeupInputFilter::GetSubscribeInterval(PowerState::SLEEP), 0);
+    EXPECT_LT(WakeupInputFilter::GetSubscribeInterval(PowerState::UNKNOWN), 0);
+    EXPECT_TRUE(WakeupInputFilter::IsScreenOffState(PowerState::INACTIVE));
+    EXPECT_TRUE(WakeupInputFilter::IsScreenOffState(PowerState::SLEEP));
+    EXPECT_FALSE(WakeupInputFilter::IsScreenOffState(PowerState::DIM));
+    EXPECT_FALSE(WakeupInputFilter::IsScreenOffState(PowerState::AWAKE));
+    POWER_HILOGI(LABEL_TEST, "WakeupInputFilterTest002 function end!");
+}
+
+/**
+ * @tc.name: WakeupInputFilterTest003
+ * @tc.desc: events of a debounced type closer than the minimum gap are dropped, other types never are
+ * @tc.type: FUNC
+ */
+HWTEST_F(WakeupInputFilterTest, WakeupInputFilterTest003, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "WakeupInputFilterTest003 function start!");
+    constexpr int64_t START_MS = 1000;
+    WakeupInputFilter filter;
+    EXPECT_FALSE(filter.IsTooFrequent(WakeupDeviceType::WAKEUP_DEVICE_MOUSE, START_MS));
+    EXPECT_TRUE(filter.IsTooFrequent(WakeupDeviceType::WAKEUP_DEVICE_MOUSE, START_MS + 1));
+    // the types are debounced independently
+    EXPECT_FALSE(filter.IsTooFrequent(WakeupDeviceType::WAKEUP_DEVICE_KEYBOARD, START_MS + 1));
+    EXPECT_FALSE(filter.IsTooFrequent(WakeupDeviceType::WAKEUP_DEVICE_MOUSE,
+        START_MS + MIN_TIME_MS_BETWEEN_MULTIMODEACTIVITIES));
+    EXPECT_FALSE(filter.IsTooFrequent(WakeupDeviceType::WAKEUP_DEVICE_DOUBLE_CLICK, START_MS));
+    EXPECT_FALSE(filter.IsTooFrequent(WakeupDeviceType::WAKEUP_DEVICE_DOUBLE_CLICK, START_MS));
+    POWER_HILOGI(LABEL_TEST, "WakeupInputFilterTest003 function end!");
+}
+
+/**
+ * @tc.name: WakeupInputFilterTest004
+ * @tc.desc: concurrent events of one type at the same time let exactly one through
+ * @tc.type: FUNC
+ */
+HWTEST_F(WakeupInputFilterTest, WakeupInputFilterTest004, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "WakeupInputFilterTest004 function start!");
+    constexpr int32_t THREAD_NUM = 8;
+    constexpr int64_t NOW_MS = 5000;
+    WakeupInputFilter filter;
+    std::atomic<int32_t> passed {0};
+    std::vector<std::thread> threads;
+    for (int32_t i = 0; i < THREAD_NUM; i++) {
+        threads.emplace_back([&filter, &passed]() {
+            if (!filter.IsTooFrequent(WakeupDeviceType::WAKEUP_DEVICE_TOUCH_SCREEN, NOW_MS)) {
+                passed++;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(passed.load(), 1);
+    POWER_HILOGI(LABEL_TEST, "WakeupInputFilterTest004 function end!");
+}
+} // namespace
+} // namespace PowerMgr
+} // namespace OHOS
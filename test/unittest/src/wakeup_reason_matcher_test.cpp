@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <chrono>
+#include <cinttypes>
+
+#include <gtest/gtest.h>
+#include <power_log.h>
+#include <wakeup_action_source_parser.h>
+#include <wakeup_reason_matcher.h>
+
+namespace OHOS {
+namespace PowerMgr {
+using namespace testing;
+using namespace ext;
+namespace {
+// same layout as power_wakeup_action.json, plus a key the HDI does not report as a number
+const std::string WAKEUP_ACTION_CONFIG = R"({
+    "53": {"scene": "LowCapacity", "action": 1},
+    "52": {"scene": "SocNtcOverheatInMsAndLidClose", "action": 1},
+    "57": {"scene": "UlsrWakeupAlarm", "action": 0},
+    "74": {"scene": "UlsrWakeupNearlinkRing", "action": 0},
+    "rtc_alarm": {"scene": "RtcAlarm", "action": 0},
+    "thermal": {"scene": "ThermalShutdown", "action": 2}
+})";
+
+struct SyntheticWakeup {
+    std::string rawReason;
+    WakeupAction expectAction;
+};
+} // namespace
+
+class WakeupReasonMatcherTest : public Test {
+public:
+    void SetUp()
+    {
+        std::shared_ptr<WakeupActionSources> sources = WakeupActionSourceParser::ParseSources(WAKEUP_ACTION_CONFIG);
+        ASSERT_NE(sources, nullptr);
+        matcher_.Build(sources->GetSourceMap());
+    }
+    void TearDown() {}
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+
+    WakeupReasonMatcher matcher_;
+};
+
+namespace {
+/**
+ * @tc.name: WakeupReasonMatcherTest001
+ * @tc.desc: test raw HDI reasons are classified by the configured action
+ * @tc.type: FUNC
+ */
+HWTEST_F(WakeupReasonMatcherTest, WakeupReasonMatcherTest001, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "WakeupReasonMatcherTest001 function start!");
+    EXPECT_EQ(matcher_.GetSize(), 6);
+    WakeupReasonMatch match = matcher_.Match("53\n");
+    EXPECT_EQ(match.GetAction(), WakeupAction::ACTION_HIBERNATE);
+    EXPECT_EQ(match.suspendType, SuspendDeviceType::SUSPEND_DEVICE_LOW_CAPACITY);
+    EXPECT_EQ(match.source->GetScene(), "LowCapacity");
+
+    EXPECT_TRUE(matcher_.Match("57").IsDarkWakeup());
+    EXPECT_TRUE(matcher_.Match("rtc_alarm \n").IsDarkWakeup());
+    EXPECT_EQ(matcher_.Match("thermal").GetAction(), WakeupAction::ACTION_SHUTDOWN);
+
+    EXPECT_FALSE(matcher_.Match("").IsMatched());
+    EXPECT_FALSE(matcher_.Match("\n").IsMatched());
+    EXPECT_FALSE(matcher_.Match("053").IsMatched());
+    EXPECT_FALSE(matcher_.Match("58").IsMatched());
+    EXPECT_FALSE(matcher_.Match("99999").IsMatched());
+    EXPECT_FALSE(matcher_.Match("57").GetAction() == WakeupAction::ACTION_INVALID);
+    EXPECT_FALSE(matcher_.Match("58").IsDarkWakeup());
+    POWER_HILOGI(LABEL_TEST, "WakeupReasonMatcherTest001 function end!");
+}
+
+/**
+ * @tc.name: WakeupReasonMatcherTest002
+ * @tc.desc: feed a synthetic sequence of wakeup reasons and account the dark wakeups
+ * @tc.type: FUNC
+ */
+HWTEST_F(WakeupReasonMatcherTest, WakeupReasonMatcherTest002, TestSize.Level0)
+{
+    POWER_HILOGI(LABEL_TEST, "WakeupReasonMatcherTest002 function start!");
+    const std::vector<SyntheticWakeup> wakeups = {
+        {"57\n", WakeupAction::ACTION_NONE},
+        {"74\n", WakeupAction::ACTION_NONE},
+        {"1\n", WakeupAction::ACTION_INVALID},
+        {"52\n", WakeupAction::ACTION_HIBERNATE},
+        {"rtc_alarm\n", WakeupAction::ACTION_NONE},
+        {"thermal\n", WakeupAction::ACTION_SHUTDOWN},
+    };
+    DarkWakeupStats stats;
+    for (const auto& wakeup : wakeups) {
+        auto begin = std::chrono::steady_clock::now();
+        WakeupReasonMatch match = matcher_.Match(wakeup.rawReason);
+        EXPECT_EQ(match.GetAction(), wakeup.expectAction) << wakeup.rawReason;
+        if (match.IsDarkWakeup()) {
+            stats.Record(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - begin).count());
+        }
+    }
+    EXPECT_EQ(stats.GetCount(), 3);
+    std::string info;
+    stats.DumpInfo(info);
+    EXPECT_NE(info.find("count=3"), std::string::npos);
+    POWER_HILOGI(LABEL_TEST, "%{public}s", info.c_str());
+    POWER_HILOGI(LABEL_TEST, "WakeupReasonMatcherTest002 function end!");
+}
+
+/**
+ * @tc.name: WakeupReasonMatcherTest003
+ * @tc.desc: compare the matcher with the map lookup it replaces
+ * @tc.type: PERF
+ */
+HWTEST_F(WakeupReasonMatcherTest, WakeupReasonMatcherTest003, TestSize.Level1)
+{
+    POWER_HILOGI(LABEL_TEST, "WakeupReasonMatcherTest003 function start!");
+    constexpr int64_t loopCount = 1000000;
+    std::shared_ptr<WakeupActionSources> sources = WakeupActionSourceParser::ParseSources(WAKEUP_ACTION_CONFIG);
+    std::map<std::string, std::shared_ptr<WakeupActionSource>> sourceMap = sources->GetSourceMap();
+    const std::string rawReason = "57\n";
+
+    int64_t mapHits = 0;
+    auto mapBegin = std::chrono::steady_clock::now();
+    for (int64_t index = 0; index < loopCount; index++) {
+        std::string reason = rawReason;
+        reason.erase(reason.end() - 1);
+        mapHits += sourceMap.find(reason) != sourceMap.end() ? 1 : 0;
+    }
+    auto mapNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - mapBegin).count();
+
+    int64_t matcherHits = 0;
+    auto matcherBegin = std::chrono::steady_clock::now();
+    for (int64_t index = 0; index < loopCount; index++) {
+        matcherHits += matcher_.Match(rawReason).IsDarkWakeup() ? 1 : 0;
+    }
+    auto matcherNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - matcherBegin).count();
+
+    POWER_HILOGI(LABEL_TEST, "map=%{public}" PRId64 "ns, matcher=%{public}" PRId64 "ns per reason",
+        static_cast<int64_t>(mapNs) / loopCount, static_cast<int64_t>(matcherNs) / loopCount);
+    EXPECT_EQ(mapHits, loopCount);
+    EXPECT_EQ(matcherHits, loopCount);
+    POWER_HILOGI(LABEL_TEST, "WakeupReasonMatcherTest003 function end!");
+}
+} // namespace
+} // namespace PowerMgr
+} // namespace OHOS
@@ -299,6 +299,17 @@ HWTEST_F(ZidlCallbackProxyTest, PowerRunningLock_SendRequestFail, TestSize.Level
     TeardownMock();
 }
 
+HWTEST_F(ZidlCallbackProxyTest, PowerRunningLock_Changes_SendRequestFail, TestSize.Level1)
+{
+    SetupMockSendRequestFail();
+    auto proxy = MakeProxy<PowerRunningLockCallbackProxy>();
+    ASSERT_TRUE(proxy != nullptr);
+    RunningLockChangeRecord record;
+    record.action = RunningLockChangeAction::ADD;
+    proxy->HandleRunningLockChanges({record}, 0);
+    TeardownMock();
+}
+
 HWTEST_F(ZidlCallbackProxyTest, PowerState_SendRequestFail, TestSize.Level1)
 {
     SetupMockSendRequestFail();
@@ -159,6 +159,33 @@ HWTEST_F(ZidlCallbackStubTest, RunningLock_Normal, TestSize.Level1)
     delete stub;
 }
 
+HWTEST_F(ZidlCallbackStubTest, RunningLock_Changes, TestSize.Level1)
+{
+    auto stub = new PowerRunningLockCallbackStub();
+    EXPECT_TRUE(stub != nullptr);
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+    data.WriteInterfaceToken(stub->GetDescriptor());
+    data.WriteUint32(1);
+    RunningLockChangeRecord record;
+    record.action = RunningLockChangeAction::UPDATE;
+    record.name = "test_lock";
+    EXPECT_TRUE(record.Marshalling(data));
+    data.WriteUint32(0);
+    int ret = stub->OnRemoteRequest(
+        static_cast<uint32_t>(PowerRunningLockCallbackInterfaceCode::POWER_RUNNINGLOCK_CHANGES), data, reply, option);
+    EXPECT_EQ(ret, ERR_OK);
+
+    MessageParcel oversized;
+    oversized.WriteInterfaceToken(stub->GetDescriptor());
+    oversized.WriteUint32(UINT32_MAX);
+    ret = stub->OnRemoteRequest(static_cast<uint32_t>(PowerRunningLockCallbackInterfaceCode::POWER_RUNNINGLOCK_CHANGES),
+        oversized, reply, option);
+    EXPECT_EQ(ret, E_READ_PARCEL_ERROR);
+    delete stub;
+}
+
 // ==================== PowerStateCallbackStub ====================
 
 HWTEST_F(ZidlCallbackStubTest, PowerState_WrongDescriptor, TestSize.Level1)
@@ -14,6 +14,7 @@
  */
 
 #include "app_manager_utils.h"
+#include "foreground_app_tracker.h"
 #include "power_log.h"
 #include <ability_manager_client.h>
 #include <string>
@@ -67,6 +68,16 @@ bool PowerIsForegroundApplication(const std::set<std::string>& appNames)
     return AppManagerUtils::IsForegroundApplication(appNames);
 }
 
+bool PowerStartForegroundAppTracker()
+{
+    return ForegroundAppTracker::GetInstance()->Start();
+}
+
+void PowerStopForegroundAppTracker()
+{
+    ForegroundAppTracker::GetInstance()->Stop();
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -16,6 +16,8 @@
 #ifndef POWERMGR_APP_MANAGER_UTILS_H
 #define POWERMGR_APP_MANAGER_UTILS_H
 
+#include <mutex>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -26,13 +28,16 @@ namespace PowerMgr {
 class AppManagerUtils final {
 public:
     static sptr<OHOS::AppExecFwk::IAppMgr> GetAppManagerInstance();
+    static void ResetAppManagerInstance();
     static void GetForegroundApplications(std::vector<OHOS::AppExecFwk::AppStateData>& appsData);
+    // answered by ForegroundAppTracker once it is started, otherwise by asking AppMgr
     static bool IsForegroundApplication(const std::set<std::string>& appNames);
     static int32_t GetApiTargetVersion();
     static void GetForegroundBundleNames(std::set<std::string>& bundleNames);
 
 private:
     static sptr<OHOS::AppExecFwk::IAppMgr> appManagerInstance_;
+    static std::mutex instanceMutex_;
 };
 
 } // namespace PowerMgr
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_FOREGROUND_APP_TRACKER_H
+#define POWERMGR_FOREGROUND_APP_TRACKER_H
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+#include "application_state_observer_stub.h"
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Foreground applications of the device, kept up to date by an application state observer so that
+ * membership queries are answered locally instead of asking AppMgr for the whole list every time.
+ * Until Start succeeded, and after AppMgr died, IsReady is false and callers fall back to the IPC.
+ */
+class ForegroundAppTracker : public AppExecFwk::ApplicationStateObserverStub {
+public:
+    static sptr<ForegroundAppTracker> GetInstance();
+
+    // register the observer and seed the set from AppMgr, nothing to do when already started
+    bool Start();
+    // AppMgr died, the observer is gone with it
+    void Stop();
+    bool IsReady() const
+    {
+        return ready_.load(std::memory_order_acquire);
+    }
+
+    bool IsForeground(const std::string& bundleName) const;
+    bool IsForegroundUid(int32_t uid) const;
+    bool IsAnyForeground(const std::set<std::string>& bundleNames) const;
+    void GetBundleNames(std::set<std::string>& bundleNames) const;
+    size_t GetCount() const;
+
+    void OnForegroundApplicationChanged(const AppExecFwk::AppStateData& appStateData) override;
+    void OnAppStopped(const AppExecFwk::AppStateData& appStateData) override;
+
+private:
+    static bool IsForegroundState(int32_t state);
+    void AddLocked(int32_t uid, const std::string& bundleName);
+    void RemoveLocked(int32_t uid);
+
+    mutable std::mutex mutex_;
+    // the uids are the identity, one bundle may run as several uids (clones, users)
+    std::unordered_map<int32_t, std::string> uidToBundle_;
+    std::unordered_map<std::string, uint32_t> bundleRefs_;
+    std::atomic<bool> ready_ {false};
+};
+} // namespace PowerMgr
+} // namespace OHOS
+
+#endif // POWERMGR_FOREGROUND_APP_TRACKER_H
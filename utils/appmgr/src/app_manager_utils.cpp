@@ -19,6 +19,9 @@
 #include "system_ability_definition.h"
 #endif
 
+#include <atomic>
+
+#include "foreground_app_tracker.h"
 #include "power_log.h"
 #include <app_mgr_interface.h>
 #include "app_mgr_proxy.h"
@@ -29,12 +32,14 @@ namespace OHOS {
 namespace PowerMgr {
 static constexpr uint32_t APP_MGR_SERVICE_ID = 501;
 sptr<OHOS::AppExecFwk::IAppMgr> AppManagerUtils::appManagerInstance_ = nullptr;
+std::mutex AppManagerUtils::instanceMutex_;
 namespace {
 const int32_t API_VERSION_MOD = 1000;
 }
 
 sptr<OHOS::AppExecFwk::IAppMgr> AppManagerUtils::GetAppManagerInstance()
 {
+    std::lock_guard<std::mutex> lock(instanceMutex_);
     if (appManagerInstance_) {
         return appManagerInstance_;
     }
@@ -59,6 +64,12 @@ sptr<OHOS::AppExecFwk::IAppMgr> AppManagerUtils::GetAppManagerInstance()
     return appManagerInstance_;
 }
 
+void AppManagerUtils::ResetAppManagerInstance()
+{
+    std::lock_guard<std::mutex> lock(instanceMutex_);
+    appManagerInstance_ = nullptr;
+}
+
 void AppManagerUtils::GetForegroundApplications(std::vector<OHOS::AppExecFwk::AppStateData>& appsData)
 {
     auto appMgr = GetAppManagerInstance();
@@ -76,6 +87,10 @@ bool AppManagerUtils::IsForegroundApplication(const std::set<std::string>& appNa
         POWER_HILOGW(FEATURE_UTIL, "IsForegroundApplication: app name is empty");
         return false;
     }
+    auto tracker = ForegroundAppTracker::GetInstance();
+    if (tracker->IsReady()) {
+        return tracker->IsAnyForeground(appNames);
+    }
 
     bool IsForeground = false;
     std::vector<OHOS::AppExecFwk::AppStateData> appsData;
@@ -94,9 +109,11 @@ bool AppManagerUtils::IsForegroundApplication(const std::set<std::string>& appNa
 int32_t AppManagerUtils::GetApiTargetVersion()
 {
 #ifdef HAS_ABILITY_RUNTIME_PART
-    static int32_t apiTargetVersion = -1;
-    if (apiTargetVersion != -1) {
-        return apiTargetVersion;
+    // the version of the calling hap never changes, only the first call asks BMS
+    static std::atomic<int32_t> apiTargetVersion {-1};
+    int32_t cachedVersion = apiTargetVersion.load(std::memory_order_relaxed);
+    if (cachedVersion != -1) {
+        return cachedVersion;
     }
     sptr<OHOS::ISystemAbilityManager> saManager =
         OHOS::SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
@@ -118,7 +135,7 @@ int32_t AppManagerUtils::GetApiTargetVersion()
         return 0;
     }
     int32_t hapApiVersion = bundleInfo.applicationInfo.apiTargetVersion % API_VERSION_MOD;
-    apiTargetVersion = hapApiVersion;
+    apiTargetVersion.store(hapApiVersion, std::memory_order_relaxed);
     POWER_HILOGI(FEATURE_UTIL, "GetApiTargetVersion: hapApiVersion is %{public}d", hapApiVersion);
     return hapApiVersion;
 #else
@@ -129,6 +146,11 @@ int32_t AppManagerUtils::GetApiTargetVersion()
 
 void AppManagerUtils::GetForegroundBundleNames(std::set<std::string>& bundleNames)
 {
+    auto tracker = ForegroundAppTracker::GetInstance();
+    if (tracker->IsReady()) {
+        tracker->GetBundleNames(bundleNames);
+        return;
+    }
     std::vector<OHOS::AppExecFwk::AppStateData> appList;
     GetForegroundApplications(appList);
     for (const auto &curApp : appList) {
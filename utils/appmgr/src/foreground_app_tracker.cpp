@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "foreground_app_tracker.h"
+
+#include <app_mgr_constants.h>
+
+#include "app_manager_utils.h"
+#include "power_log.h"
+
+namespace OHOS {
+namespace PowerMgr {
+sptr<ForegroundAppTracker> ForegroundAppTracker::GetInstance()
+{
+    static sptr<ForegroundAppTracker> instance = new ForegroundAppTracker();
+    return instance;
+}
+
+bool ForegroundAppTracker::Start()
+{
+    if (IsReady()) {
+        return true;
+    }
+    auto appMgr = AppManagerUtils::GetAppManagerInstance();
+    if (appMgr == nullptr) {
+        return false;
+    }
+    // held across the seed, state changes delivered meanwhile are applied on top of the snapshot
+    std::lock_guard<std::mutex> lock(mutex_);
+    int32_t ret = appMgr->RegisterApplicationStateObserver(this);
+    if (ret != ERR_OK) {
+        POWER_HILOGE(FEATURE_UTIL, "register application state observer failed, ret=%{public}d", ret);
+        return false;
+    }
+    std::vector<AppExecFwk::AppStateData> appsData;
+    appMgr->GetForegroundApplications(appsData);
+    uidToBundle_.clear();
+    bundleRefs_.clear();
+    for (const auto& appData : appsData) {
+        AddLocked(appData.uid, appData.bundleName);
+    }
+    ready_.store(true, std::memory_order_release);
+    POWER_HILOGI(FEATURE_UTIL, "foreground app tracker started, num=%{public}zu", uidToBundle_.size());
+    return true;
+}
+
+void ForegroundAppTracker::Stop()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ready_.store(false, std::memory_order_release);
+    uidToBundle_.clear();
+    bundleRefs_.clear();
+    AppManagerUtils::ResetAppManagerInstance();
+    POWER_HILOGI(FEATURE_UTIL, "foreground app tracker stopped");
+}
+
+bool ForegroundAppTracker::IsForeground(const std::string& bundleName) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bundleRefs_.find(bundleName) != bundleRefs_.end();
+}
+
+bool ForegroundAppTracker::IsForegroundUid(int32_t uid) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return uidToBundle_.find(uid) != uidToBundle_.end();
+}
+
+bool ForegroundAppTracker::IsAnyForeground(const std::set<std::string>& bundleNames) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& bundleName : bundleNames) {
+        if (bundleRefs_.find(bundleName) != bundleRefs_.end()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ForegroundAppTracker::GetBundleNames(std::set<std::string>& bundleNames) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& [bundleName, refs] : bundleRefs_) {
+        bundleNames.emplace(bundleName);
+    }
+}
+
+size_t ForegroundAppTracker::GetCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return uidToBundle_.size();
+}
+
+void ForegroundAppTracker::OnForegroundApplicationChanged(const AppExecFwk::AppStateData& appStateData)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (IsForegroundState(appStateData.state)) {
+        AddLocked(appStateData.uid, appStateData.bundleName);
+    } else {
+        RemoveLocked(appStateData.uid);
+    }
+}
+
+void ForegroundAppTracker::OnAppStopped(const AppExecFwk::AppStateData& appStateData)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    RemoveLocked(appStateData.uid);
+}
+
+bool ForegroundAppTracker::IsForegroundState(int32_t state)
+{
+    return state == static_cast<int32_t>(AppExecFwk::ApplicationState::APP_STATE_FOREGROUND) ||
+        state == static_cast<int32_t>(AppExecFwk::ApplicationState::APP_STATE_FOCUS);
+}
+
+void ForegroundAppTracker::AddLocked(int32_t uid, const std::string& bundleName)
+{
+    auto iter = uidToBundle_.find(uid);
+    if (iter != uidToBundle_.end()) {
+        if (iter->second == bundleName) {
+            return;
+        }
+        RemoveLocked(uid);
+    }
+    uidToBundle_.emplace(uid, bundleName);
+    bundleRefs_[bundleName]++;
+}
+
+void ForegroundAppTracker::RemoveLocked(int32_t uid)
+{
+    auto iter = uidToBundle_.find(uid);
+    if (iter == uidToBundle_.end()) {
+        return;
+    }
+    auto refIter = bundleRefs_.find(iter->second);
+    if (refIter != bundleRefs_.end() && --refIter->second == 0) {
+        bundleRefs_.erase(refIter);
+    }
+    uidToBundle_.erase(iter);
+}
+} // namespace PowerMgr
+} // namespace OHOS
@@ -16,6 +16,8 @@
 #define POWERMGR_FFRT_UTILS_H
 
 #include <functional>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "c/ffrt_ipc.h"
@@ -149,6 +151,7 @@ private:
     std::unordered_map<uint32_t, FFRTMutex> mutexMap_;
 };
 
+class IPowerClock;
 class FFRTTimer {
 public:
     FFRTTimer();
@@ -170,6 +173,8 @@ private:
     FFRTQueue queue_;
     std::unordered_map<uint32_t, FFRTHandle> handleMap_;
     std::unordered_map<uint32_t, uint32_t> taskId_;
+    // timers submitted while a custom clock is installed, see PowerClock
+    std::unordered_map<uint32_t, std::pair<std::shared_ptr<IPowerClock>, uint64_t>> clockTaskMap_;
 };
 
 class NoCoroutineSwitchGuard {
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef POWERMGR_POWER_CLOCK_H
+#define POWERMGR_POWER_CLOCK_H
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Time source used by the power timers.
+ * The service runs on the monotonic clock. Replay and stress tests install a
+ * virtual clock so that timeouts fire deterministically.
+ */
+class IPowerClock {
+public:
+    using ClockTask = std::function<void()>;
+    virtual ~IPowerClock() = default;
+    /**
+     * Current time in milliseconds.
+     */
+    virtual int64_t GetTickCount() = 0;
+    /**
+     * Run the task once the clock has advanced by delayMs.
+     *
+     * @return id used to cancel the task.
+     */
+    virtual uint64_t SubmitDelayTask(const ClockTask& task, uint32_t delayMs) = 0;
+    virtual void CancelTask(uint64_t taskId) = 0;
+};
+
+class VirtualPowerClock : public IPowerClock {
+public:
+    explicit VirtualPowerClock(int64_t startMs = 0) : nowMs_(startMs) {}
+    ~VirtualPowerClock() override = default;
+    int64_t GetTickCount() override;
+    uint64_t SubmitDelayTask(const ClockTask& task, uint32_t delayMs) override;
+    void CancelTask(uint64_t taskId) override;
+    /**
+     * Move the clock forward to targetMs. Due tasks run on the calling thread,
+     * ordered by due time and then by submission order.
+     *
+     * @param onTaskDone called with the due time after each task has run.
+     * @return number of tasks executed.
+     */
+    size_t AdvanceTo(int64_t targetMs, const std::function<void(int64_t)>& onTaskDone = nullptr);
+    size_t AdvanceBy(int64_t deltaMs, const std::function<void(int64_t)>& onTaskDone = nullptr);
+    size_t GetPendingCount();
+    int64_t GetNextDueTime();
+
+private:
+    using TaskKey = std::pair<int64_t, uint64_t>;
+    std::mutex mutex_;
+    int64_t nowMs_ {0};
+    uint64_t nextId_ {1};
+    std::map<TaskKey, ClockTask> tasks_;
+    std::unordered_map<uint64_t, int64_t> dueTimes_;
+};
+
+class PowerClock final {
+public:
+    /**
+     * Current time in milliseconds, from the installed clock or the monotonic clock.
+     */
+    static int64_t GetTickCount();
+    /**
+     * Install a clock, nullptr restores the monotonic clock.
+     */
+    static void SetClock(const std::shared_ptr<IPowerClock>& clock);
+    static std::shared_ptr<IPowerClock> GetClock();
+};
+} // namespace PowerMgr
+} // namespace OHOS
+
+#endif // POWERMGR_POWER_CLOCK_H
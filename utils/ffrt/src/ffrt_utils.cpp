@@ -14,6 +14,7 @@
  */
 
 #include "ffrt_utils.h"
+#include "power_clock.h"
 #include "power_log.h"
 
 namespace OHOS {
@@ -103,6 +104,7 @@ void FFRTTimer::Clear()
     CancelAllTimerInner();
     handleMap_.clear();
     taskId_.clear();
+    clockTaskMap_.clear();
     mutex_.unlock();
 }
 
@@ -127,7 +129,12 @@ void FFRTTimer::SetTimer(uint32_t timerId, FFRTTask& task, uint32_t delayMs)
     ++taskId_[timerId];
     POWER_HILOGD(FEATURE_UTIL, "Timer[%{public}u] Add Task[%{public}u] with delay = %{public}u",
         timerId, taskId_[timerId], delayMs);
-    handleMap_[timerId] = FFRTUtils::SubmitDelayTask(task, delayMs, queue_);
+    auto clock = PowerClock::GetClock();
+    if (clock != nullptr) {
+        clockTaskMap_[timerId] = std::make_pair(clock, clock->SubmitDelayTask(task, delayMs));
+    } else {
+        handleMap_[timerId] = FFRTUtils::SubmitDelayTask(task, delayMs, queue_);
+    }
     mutex_.unlock();
 }
 
@@ -156,6 +163,10 @@ void FFRTTimer::CancelAllTimerInner()
             p.second = nullptr;
         }
     }
+    for (auto &p : clockTaskMap_) {
+        p.second.first->CancelTask(p.second.second);
+    }
+    clockTaskMap_.clear();
 }
 
 void FFRTTimer::CancelTimerInner(uint32_t timerId)
@@ -165,6 +176,11 @@ void FFRTTimer::CancelTimerInner(uint32_t timerId)
         FFRTUtils::CancelTask(handleMap_[timerId], queue_);
         handleMap_[timerId] = nullptr;
     }
+    auto iter = clockTaskMap_.find(timerId);
+    if (iter != clockTaskMap_.end()) {
+        iter->second.first->CancelTask(iter->second.second);
+        clockTaskMap_.erase(iter);
+    }
 }
 
 } // namespace PowerMgr
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "power_clock.h"
+
+#include <algorithm>
+#include <datetime_ex.h>
+#include "power_log.h"
+
+namespace OHOS {
+namespace PowerMgr {
+namespace {
+std::shared_ptr<IPowerClock> g_clock {nullptr};
+}
+
+int64_t PowerClock::GetTickCount()
+{
+    auto clock = std::atomic_load(&g_clock);
+    if (clock == nullptr) {
+        return OHOS::GetTickCount();
+    }
+    return clock->GetTickCount();
+}
+
+void PowerClock::SetClock(const std::shared_ptr<IPowerClock>& clock)
+{
+    POWER_HILOGI(FEATURE_UTIL, "Power clock switched to %{public}s", clock == nullptr ? "monotonic" : "custom");
+    std::atomic_store(&g_clock, clock);
+}
+
+std::shared_ptr<IPowerClock> PowerClock::GetClock()
+{
+    return std::atomic_load(&g_clock);
+}
+
+int64_t VirtualPowerClock::GetTickCount()
+{
+    std::lock_guard lock(mutex_);
+    return nowMs_;
+}
+
+uint64_t VirtualPowerClock::SubmitDelayTask(const ClockTask& task, uint32_t delayMs)
+{
+    std::lock_guard lock(mutex_);
+    uint64_t taskId = nextId_++;
+    int64_t dueTime = nowMs_ + static_cast<int64_t>(delayMs);
+    tasks_.emplace(TaskKey {dueTime, taskId}, task);
+    dueTimes_.emplace(taskId, dueTime);
+    return taskId;
+}
+
+void VirtualPowerClock::CancelTask(uint64_t taskId)
+{
+    std::lock_guard lock(mutex_);
+    auto iter = dueTimes_.find(taskId);
+    if (iter == dueTimes_.end()) {
+        return;
+    }
+    tasks_.erase(TaskKey {iter->second, taskId});
+    dueTimes_.erase(iter);
+}
+
+size_t VirtualPowerClock::AdvanceTo(int64_t targetMs, const std::function<void(int64_t)>& onTaskDone)
+{
+    size_t count = 0;
+    while (true) {
+        ClockTask task;
+        int64_t dueTime = 0;
+        {
+            std::lock_guard lock(mutex_);
+            auto iter = tasks_.begin();
+            if (iter == tasks_.end() || iter->first.first > targetMs) {
+                nowMs_ = std::max(nowMs_, targetMs);
+                break;
+            }
+            dueTime = iter->first.first;
+            nowMs_ = std::max(nowMs_, dueTime);
+            task = std::move(iter->second);
+            dueTimes_.erase(iter->first.second);
+            tasks_.erase(iter);
+        }
+        // tasks may submit or cancel other tasks, so they run without holding the mutex
+        if (task) {
+            task();
+        }
+        count++;
+        if (onTaskDone) {
+            onTaskDone(dueTime);
+        }
+    }
+    return count;
+}
+
+size_t VirtualPowerClock::AdvanceBy(int64_t deltaMs, const std::function<void(int64_t)>& onTaskDone)
+{
+    return AdvanceTo(GetTickCount() + deltaMs, onTaskDone);
+}
+
+size_t VirtualPowerClock::GetPendingCount()
+{
+    std::lock_guard lock(mutex_);
+    return tasks_.size();
+}
+
+int64_t VirtualPowerClock::GetNextDueTime()
+{
+    std::lock_guard lock(mutex_);
+    return tasks_.empty() ? -1 : tasks_.begin()->first.first;
+}
+} // namespace PowerMgr
+} // namespace OHOS
@@ -22,6 +22,17 @@
 #include <stdint.h>
 
 #include "hilog/log.h"
+#include "power_log_budget.h"
+
+// Levels as in hilog LogLevel, lines below POWER_LOG_MIN_LEVEL are compiled out with their arguments
+#define POWER_LOG_LEVEL_DEBUG 3
+#define POWER_LOG_LEVEL_INFO 4
+#define POWER_LOG_LEVEL_WARN 5
+#define POWER_LOG_LEVEL_ERROR 6
+#define POWER_LOG_LEVEL_FATAL 7
+#ifndef POWER_LOG_MIN_LEVEL
+#define POWER_LOG_MIN_LEVEL POWER_LOG_LEVEL_DEBUG
+#endif
 
 namespace OHOS {
 namespace PowerMgr {
@@ -46,6 +57,14 @@ namespace PowerMgr {
 #undef POWER_HILOGD
 #endif
 
+#ifdef POWER_HILOGI_LIMITED
+#undef POWER_HILOGI_LIMITED
+#endif
+
+#ifdef POWER_HILOGW_LIMITED
+#undef POWER_HILOGW_LIMITED
+#endif
+
 #ifdef POWER_KHILOGF
 #undef POWER_KHILOGF
 #endif
@@ -160,21 +179,66 @@ static constexpr PowerManagerLogLabelDomain POWER_LABEL_DOMAIN[LABEL_END] = {
     {LABEL_TEST,                 DOMAIN_TEST},
 };
 
+// type checked but never evaluated, so variables only logged do not become unused
+#define POWER_LOG_DISCARD(domain, ...) \
+    (0 ? (void)HILOG_IMPL(LOG_CORE, LOG_DEBUG, POWER_LABEL_DOMAIN[domain].domainId, POWER_LABEL_TAG[domain].tag, \
+    ##__VA_ARGS__) : (void)0)
+
 #define POWER_HILOGF(domain, ...) \
     ((void)HILOG_IMPL(LOG_CORE, LOG_FATAL, POWER_LABEL_DOMAIN[domain].domainId, POWER_LABEL_TAG[domain].tag,   \
     ##__VA_ARGS__))
 #define POWER_HILOGE(domain, ...) \
     ((void)HILOG_IMPL(LOG_CORE, LOG_ERROR, POWER_LABEL_DOMAIN[domain].domainId, POWER_LABEL_TAG[domain].tag,   \
     ##__VA_ARGS__))
+#if POWER_LOG_MIN_LEVEL > POWER_LOG_LEVEL_WARN
+#define POWER_HILOGW(domain, ...) POWER_LOG_DISCARD(domain, ##__VA_ARGS__)
+#else
 #define POWER_HILOGW(domain, ...) \
     ((void)HILOG_IMPL(LOG_CORE, LOG_WARN, POWER_LABEL_DOMAIN[domain].domainId, POWER_LABEL_TAG[domain].tag,    \
     ##__VA_ARGS__))
+#endif
+#if POWER_LOG_MIN_LEVEL > POWER_LOG_LEVEL_INFO
+#define POWER_HILOGI(domain, ...) POWER_LOG_DISCARD(domain, ##__VA_ARGS__)
+#else
 #define POWER_HILOGI(domain, ...) \
     ((void)HILOG_IMPL(LOG_CORE, LOG_INFO, POWER_LABEL_DOMAIN[domain].domainId, POWER_LABEL_TAG[domain].tag,    \
     ##__VA_ARGS__))
+#endif
+#if POWER_LOG_MIN_LEVEL > POWER_LOG_LEVEL_DEBUG
+#define POWER_HILOGD(domain, ...) POWER_LOG_DISCARD(domain, ##__VA_ARGS__)
+#else
 #define POWER_HILOGD(domain, ...) \
     ((void)HILOG_IMPL(LOG_CORE, LOG_DEBUG, POWER_LABEL_DOMAIN[domain].domainId, POWER_LABEL_TAG[domain].tag,   \
     ##__VA_ARGS__))
+#endif
+
+// For hot paths: each call site prints at most the budget of PowerLogBudgetConfig, the next printed line
+// tells how many were dropped. fmt has to be a string literal.
+#define POWER_HILOG_LIMITED_IMPL(level, domain, fmt, ...) \
+    do { \
+        static OHOS::PowerMgr::PowerLogBudget powerLogBudget; \
+        uint32_t powerLogSuppressed = 0; \
+        if (!powerLogBudget.TryAcquire(powerLogSuppressed)) { \
+            break; \
+        } \
+        if (powerLogSuppressed == 0) { \
+            ((void)HILOG_IMPL(LOG_CORE, level, POWER_LABEL_DOMAIN[domain].domainId, POWER_LABEL_TAG[domain].tag, \
+                fmt, ##__VA_ARGS__)); \
+        } else { \
+            ((void)HILOG_IMPL(LOG_CORE, level, POWER_LABEL_DOMAIN[domain].domainId, POWER_LABEL_TAG[domain].tag, \
+                fmt " (%{public}u suppressed)", ##__VA_ARGS__, powerLogSuppressed)); \
+        } \
+    } while (0)
+#if POWER_LOG_MIN_LEVEL > POWER_LOG_LEVEL_WARN
+#define POWER_HILOGW_LIMITED(domain, ...) POWER_LOG_DISCARD(domain, ##__VA_ARGS__)
+#else
+#define POWER_HILOGW_LIMITED(domain, ...) POWER_HILOG_LIMITED_IMPL(LOG_WARN, domain, ##__VA_ARGS__)
+#endif
+#if POWER_LOG_MIN_LEVEL > POWER_LOG_LEVEL_INFO
+#define POWER_HILOGI_LIMITED(domain, ...) POWER_LOG_DISCARD(domain, ##__VA_ARGS__)
+#else
+#define POWER_HILOGI_LIMITED(domain, ...) POWER_HILOG_LIMITED_IMPL(LOG_INFO, domain, ##__VA_ARGS__)
+#endif
 
 constexpr OHOS::HiviewDFX::HiLogLabel POWER_KERNEL_LABEL = {
     LOG_KMSG,
@@ -227,6 +291,8 @@ constexpr OHOS::HiviewDFX::HiLogLabel POWER_KERNEL_LABEL = {
 #define POWER_HILOGW(...)
 #define POWER_HILOGI(...)
 #define POWER_HILOGD(...)
+#define POWER_HILOGI_LIMITED(...)
+#define POWER_HILOGW_LIMITED(...)
 
 #define POWER_KHILOGF(...)
 #define POWER_KHILOGE(...)
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWER_LOG_BUDGET_H
+#define POWER_LOG_BUDGET_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * Budget shared by the rate limited log lines of this process, tunable with the
+ * "persist.powermgr.log.budget" parameter as "<lines per second>/<burst>". A rate of 0 lifts the limit.
+ */
+class PowerLogBudgetConfig {
+public:
+    static constexpr const char* PARAM_KEY = "persist.powermgr.log.budget";
+    static constexpr uint32_t DEFAULT_RATE = 10;
+    static constexpr uint32_t DEFAULT_BURST = 20;
+
+    static PowerLogBudgetConfig& GetInstance()
+    {
+        static PowerLogBudgetConfig config;
+        return config;
+    }
+
+    void Set(uint32_t rate, uint32_t burst)
+    {
+        rate_.store(rate, std::memory_order_relaxed);
+        burst_.store(burst == 0 ? 1 : burst, std::memory_order_relaxed);
+    }
+    // an empty or malformed value restores the defaults
+    bool Apply(const char* value)
+    {
+        constexpr int32_t DECIMAL = 10;
+        char* end = nullptr;
+        unsigned long rate = (value == nullptr) ? 0 : strtoul(value, &end, DECIMAL);
+        if (value == nullptr || end == value || *end != '/') {
+            Set(DEFAULT_RATE, DEFAULT_BURST);
+            return false;
+        }
+        const char* burstStr = end + 1;
+        unsigned long burst = strtoul(burstStr, &end, DECIMAL);
+        if (end == burstStr || *end != '\0') {
+            Set(DEFAULT_RATE, DEFAULT_BURST);
+            return false;
+        }
+        Set(static_cast<uint32_t>(rate), static_cast<uint32_t>(burst));
+        return true;
+    }
+    uint32_t GetRate() const
+    {
+        return rate_.load(std::memory_order_relaxed);
+    }
+    uint32_t GetBurst() const
+    {
+        return burst_.load(std::memory_order_relaxed);
+    }
+
+private:
+    PowerLogBudgetConfig() = default;
+
+    std::atomic<uint32_t> rate_ {DEFAULT_RATE};
+    std::atomic<uint32_t> burst_ {DEFAULT_BURST};
+};
+
+/**
+ * Token bucket of one log call site, kept as the time the bucket is full again so that a check is a
+ * single compare and swap. Lines over budget are counted and reported with the next printed one.
+ */
+class PowerLogBudget {
+public:
+    // true when the line may be printed, suppressed is then the number of lines dropped before it
+    bool TryAcquire(uint32_t& suppressed)
+    {
+        return TryAcquire(GetNowUs(), suppressed);
+    }
+    bool TryAcquire(int64_t nowUs, uint32_t& suppressed)
+    {
+        constexpr int64_t US_PER_SECOND = 1000000;
+        const PowerLogBudgetConfig& config = PowerLogBudgetConfig::GetInstance();
+        uint32_t rate = config.GetRate();
+        suppressed = 0;
+        if (rate != 0) {
+            int64_t intervalUs = US_PER_SECOND / rate;
+            int64_t burstUs = intervalUs * static_cast<int64_t>(config.GetBurst());
+            int64_t fullAt = fullAtUs_.load(std::memory_order_relaxed);
+            int64_t next = 0;
+            do {
+                next = ((fullAt > nowUs) ? fullAt : nowUs) + intervalUs;
+                if (next - nowUs > burstUs) {
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+            } while (!fullAtUs_.compare_exchange_weak(fullAt, next, std::memory_order_relaxed));
+        }
+        if (dropped_.load(std::memory_order_relaxed) != 0) {
+            suppressed = dropped_.exchange(0, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+private:
+    static int64_t GetNowUs()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    std::atomic<int64_t> fullAtUs_ {0};
+    std::atomic<uint32_t> dropped_ {0};
+};
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWER_LOG_BUDGET_H
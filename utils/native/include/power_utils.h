@@ -34,6 +34,9 @@ public:
     static WakeupDeviceType ParseWakeupDeviceType(const std::string& details);
     static const std::string JsonToSimpleStr(const std::string& json);
     static bool IsForegroundApplication(const std::set<std::string>& appNames);
+    // follow the foreground applications locally, call again whenever AppMgr (re)starts
+    static bool StartForegroundAppTracker();
+    static void StopForegroundAppTracker();
     static std::set<std::string> Split(const std::string& str, char delimiter);
 };
 } // namespace PowerMgr
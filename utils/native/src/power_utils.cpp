@@ -339,30 +339,56 @@ const std::string PowerUtils::JsonToSimpleStr(const std::string& json)
     return str;
 }
 
-bool PowerUtils::IsForegroundApplication(const std::set<std::string>& appNames)
+namespace {
+// loaded once and kept, the symbols are looked up on every proximity close during a call
+void* GetPowerAbilitySymbol(const char* name)
 {
-    void* handler = dlopen("libpower_ability.z.so", RTLD_NOW | RTLD_NODELETE);
+    static void* handler = []() {
+        void* handle = dlopen("libpower_ability.z.so", RTLD_NOW | RTLD_NODELETE);
+        if (handle == nullptr) {
+            POWER_HILOGE(FEATURE_UTIL, "dlopen libpower_ability.z.so failed, reason : %{public}s", dlerror());
+        }
+        return handle;
+    }();
     if (handler == nullptr) {
-        POWER_HILOGE(FEATURE_UTIL, "dlopen libpower_ability.z.so failed, reason : %{public}s", dlerror());
-        return false;
+        return nullptr;
+    }
+    void* symbol = dlsym(handler, name);
+    if (symbol == nullptr) {
+        POWER_HILOGE(FEATURE_UTIL, "find %{public}s function failed, reason : %{public}s", name, dlerror());
     }
+    return symbol;
+}
+} // namespace
 
-    auto powerIsForegroundApplicationFunc =
-        reinterpret_cast<bool (*)(const std::set<std::string>&)>(dlsym(handler, "PowerIsForegroundApplication"));
+bool PowerUtils::IsForegroundApplication(const std::set<std::string>& appNames)
+{
+    static auto powerIsForegroundApplicationFunc = reinterpret_cast<bool (*)(const std::set<std::string>&)>(
+        GetPowerAbilitySymbol("PowerIsForegroundApplication"));
     if (powerIsForegroundApplicationFunc == nullptr) {
-        POWER_HILOGE(FEATURE_UTIL, "find PowerIsForegroundApplication function failed, reason : %{public}s", dlerror());
-#ifndef FUZZ_TEST
-        dlclose(handler);
-#endif
-        handler = nullptr;
         return false;
     }
-    bool isForeground = powerIsForegroundApplicationFunc(appNames);
-#ifndef FUZZ_TEST
-    dlclose(handler);
-#endif
-    handler = nullptr;
-    return isForeground;
+    return powerIsForegroundApplicationFunc(appNames);
+}
+
+bool PowerUtils::StartForegroundAppTracker()
+{
+    static auto powerStartTrackerFunc =
+        reinterpret_cast<bool (*)()>(GetPowerAbilitySymbol("PowerStartForegroundAppTracker"));
+    if (powerStartTrackerFunc == nullptr) {
+        return false;
+    }
+    return powerStartTrackerFunc();
+}
+
+void PowerUtils::StopForegroundAppTracker()
+{
+    static auto powerStopTrackerFunc =
+        reinterpret_cast<void (*)()>(GetPowerAbilitySymbol("PowerStopForegroundAppTracker"));
+    if (powerStopTrackerFunc == nullptr) {
+        return;
+    }
+    powerStopTrackerFunc();
 }
 
 std::set<std::string> PowerUtils::Split(const std::string& str, char delimiter)
@@ -33,7 +33,7 @@ public:
 private:
     static constexpr const char* KEY_BOOT_COMPLETED {"bootevent.boot.completed"};
     static constexpr int32_t VALUE_MAX_LEN = 32;
-    static void LoopReadBootCompletedParameter(BootCompletedCallback& callback);
+    static void NotifyIfBootCompleted(BootCompletedCallback& callback);
 };
 } // namespace PowerMgr
 } // namespace OHOS
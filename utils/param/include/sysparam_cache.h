@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POWERMGR_POWER_MANAGER_SYSPARAM_CACHE_H
+#define POWERMGR_POWER_MANAGER_SYSPARAM_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace OHOS {
+namespace PowerMgr {
+/**
+ * A system parameter read once and then kept up to date by a parameter watcher, so that Get is an
+ * atomic load instead of a paramservice lookup and a string conversion. "const." parameters never
+ * change and are not watched. The watcher holds this object as its context, keep instances static.
+ */
+template <typename T>
+class SysParamCache {
+public:
+    SysParamCache(const std::string& key, T def) : key_(key), def_(def), value_(def) {}
+    ~SysParamCache();
+    SysParamCache(const SysParamCache&) = delete;
+    SysParamCache& operator=(const SysParamCache&) = delete;
+
+    T Get()
+    {
+        if (!registered_.load(std::memory_order_acquire)) {
+            Register();
+        }
+        return value_.load(std::memory_order_relaxed);
+    }
+    const std::string& GetKey() const
+    {
+        return key_;
+    }
+    bool IsWatching() const
+    {
+        return watching_;
+    }
+
+private:
+    static void OnParameterChanged(const char* key, const char* value, void* context);
+    static bool Parse(const char* value, T& result);
+    void Register();
+    void Update(const char* value);
+
+    const std::string key_;
+    const T def_;
+    std::atomic<T> value_;
+    std::atomic<bool> registered_ {false};
+    std::once_flag registerFlag_;
+    bool watching_ {false};
+};
+
+using IntSysParam = SysParamCache<int32_t>;
+using BoolSysParam = SysParamCache<bool>;
+} // namespace PowerMgr
+} // namespace OHOS
+#endif // POWERMGR_POWER_MANAGER_SYSPARAM_CACHE_H
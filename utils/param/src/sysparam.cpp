@@ -24,21 +24,15 @@
 namespace OHOS {
 namespace PowerMgr {
 
-void SysParam::LoopReadBootCompletedParameter(BootCompletedCallback& callback)
+void SysParam::NotifyIfBootCompleted(BootCompletedCallback& callback)
 {
-    ffrt::submit([callback](void) -> void {
-        constexpr int32_t delayTimeMs = 50;
-        constexpr int32_t logInterval = 100;
-        int32_t count = 0;
-        while (!system::GetBoolParameter(KEY_BOOT_COMPLETED, false)) {
-            count++;
-            if (count >= logInterval) {
-                POWER_HILOGW(COMP_UTILS, "bootevent not fired!");
-                count = 0;
-            }
-            ffrt::this_task::sleep_for(std::chrono::milliseconds(delayTimeMs));
-        }
-        POWER_HILOGI(COMP_UTILS, "Get booteventCompleted true success!");
+    // a watcher added after the value flipped may never report it, and the SA registers again when the
+    // display service restarts long after boot, so check the current value once instead of polling it
+    if (!system::GetBoolParameter(KEY_BOOT_COMPLETED, false)) {
+        return;
+    }
+    POWER_HILOGI(COMP_UTILS, "boot already completed");
+    FFRTUtils::SubmitTask([callback]() {
         callback();
     });
 }
@@ -73,7 +67,7 @@ void SysParam::RegisterBootCompletedCallbackForPowerSa(BootCompletedCallback& ca
     if (ret != 0) {
         POWER_HILOGW(COMP_UTILS, "RegisterBootCompletedCallback for power SA failed, ret=%{public}d", ret);
     }
-    LoopReadBootCompletedParameter(callback);
+    NotifyIfBootCompleted(callback);
 }
 
 int32_t SysParam::GetIntValue(const std::string& key, int32_t def)
@@ -89,7 +83,6 @@ int32_t SysParam::GetIntValue(const std::string& key, int32_t def)
         POWER_HILOGW(COMP_UTILS, "StrToInt failed, return default def, value=%{public}s, def=%{public}d", value, def);
         return def;
     }
-    StrToInt(TrimStr(value), intValue);
     return intValue;
 }
 } // namespace PowerMgr
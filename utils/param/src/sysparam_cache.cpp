@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sysparam_cache.h"
+
+#include <cstring>
+
+#include "power_log.h"
+#include "string_ex.h"
+#include "syspara/parameter.h"
+
+namespace OHOS {
+namespace PowerMgr {
+namespace {
+constexpr int32_t VALUE_MAX_LEN = 32;
+constexpr const char* CONST_PARAM_PREFIX = "const.";
+} // namespace
+
+template <typename T>
+SysParamCache<T>::~SysParamCache()
+{
+    if (watching_) {
+        RemoveParameterWatcher(key_.c_str(), OnParameterChanged, this);
+    }
+}
+
+template <typename T>
+void SysParamCache<T>::Register()
+{
+    std::call_once(registerFlag_, [this]() {
+        char value[VALUE_MAX_LEN] = {0};
+        if (GetParameter(key_.c_str(), "", value, VALUE_MAX_LEN) > 0) {
+            Update(value);
+        }
+        if (key_.compare(0, strlen(CONST_PARAM_PREFIX), CONST_PARAM_PREFIX) != 0) {
+            int32_t ret = WatchParameter(key_.c_str(), OnParameterChanged, this);
+            watching_ = ret == 0;
+            if (!watching_) {
+                POWER_HILOGW(COMP_UTILS, "watch %{public}s failed, ret=%{public}d", key_.c_str(), ret);
+            }
+        }
+        registered_.store(true, std::memory_order_release);
+    });
+}
+
+template <typename T>
+void SysParamCache<T>::OnParameterChanged(const char* key, const char* value, void* context)
+{
+    if (context == nullptr) {
+        return;
+    }
+    static_cast<SysParamCache<T>*>(context)->Update(value);
+}
+
+template <typename T>
+void SysParamCache<T>::Update(const char* value)
+{
+    T result = def_;
+    // an empty value is a deleted or never set parameter
+    if (value != nullptr && value[0] != '\0' && !Parse(value, result)) {
+        POWER_HILOGW(COMP_UTILS, "invalid %{public}s=%{public}s, use default", key_.c_str(), value);
+        result = def_;
+    }
+    value_.store(result, std::memory_order_relaxed);
+}
+
+template <>
+bool SysParamCache<int32_t>::Parse(const char* value, int32_t& result)
+{
+    return StrToInt(TrimStr(value), result);
+}
+
+template <>
+bool SysParamCache<bool>::Parse(const char* value, bool& result)
+{
+    if (strcmp(value, "true") == 0 || strcmp(value, "1") == 0) {
+        result = true;
+        return true;
+    }
+    if (strcmp(value, "false") == 0 || strcmp(value, "0") == 0) {
+        result = false;
+        return true;
+    }
+    return false;
+}
+
+template class SysParamCache<int32_t>;
+template class SysParamCache<bool>;
+} // namespace PowerMgr
+} // namespace OHOS
@@ -16,6 +16,10 @@
 #ifndef POWERMGR_POWER_MANAGER_POWER_SETTING_HELPER_H
 #define POWERMGR_POWER_MANAGER_POWER_SETTING_HELPER_H
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "datashare_helper.h"
 #include "errors.h"
 #include "setting_observer.h"
@@ -26,6 +30,11 @@ class SettingProvider : public NoCopyable {
 public:
     static SettingProvider& GetInstance(int32_t systemAbilityId);
     ErrCode GetStringValue(const std::string& key, std::string& value);
+    /**
+     * Query several keys at once, one DataShare query per settings table.
+     * Keys that are not found are absent from values.
+     */
+    ErrCode GetStringValues(const std::vector<std::string>& keys, std::unordered_map<std::string, std::string>& values);
     ErrCode GetIntValue(const std::string& key, int32_t& value);
     ErrCode GetLongValue(const std::string& key, int64_t& value);
     ErrCode GetBoolValue(const std::string& key, bool& value);
@@ -111,6 +120,8 @@ private:
     bool IsNeedDataMigrationCopy();
     void DataMigrationCopy();
     ErrCode GetStringValueGlobal(const std::string& key, std::string& value);
+    ErrCode QueryStringValues(
+        const std::vector<std::string>& keys, std::unordered_map<std::string, std::string>& values);
     bool IsValidKeyGlobal(const std::string& key);
 };
 } // namespace PowerMgr
@@ -262,6 +262,77 @@ ErrCode SettingProvider::GetStringValue(const std::string& key, std::string& val
     return ERR_OK;
 }
 
+ErrCode SettingProvider::GetStringValues(
+    const std::vector<std::string>& keys, std::unordered_map<std::string, std::string>& values)
+{
+    // multi user keys and global keys live in different tables
+    std::vector<std::string> userKeys;
+    std::vector<std::string> normalKeys;
+    for (const auto& key : keys) {
+        if (IsNeedMultiUser(key)) {
+            userKeys.push_back(key);
+        } else {
+            normalKeys.push_back(key);
+        }
+    }
+    ErrCode ret = ERR_OK;
+    for (const auto& group : {userKeys, normalKeys}) {
+        if (group.empty()) {
+            continue;
+        }
+        ErrCode groupRet = QueryStringValues(group, values);
+        if (groupRet != ERR_OK) {
+            ret = groupRet;
+        }
+    }
+    return ret;
+}
+
+ErrCode SettingProvider::QueryStringValues(
+    const std::vector<std::string>& keys, std::unordered_map<std::string, std::string>& values)
+{
+    std::string callingIdentity = IPCSkeleton::ResetCallingIdentity();
+    auto helper = CreateDataShareHelper(keys.front());
+    if (helper == nullptr) {
+        IPCSkeleton::SetCallingIdentity(callingIdentity);
+        return ERR_NO_INIT;
+    }
+    std::vector<std::string> columns = {SETTING_COLUMN_KEYWORD, SETTING_COLUMN_VALUE};
+    DataShare::DataSharePredicates predicates;
+    predicates.In(SETTING_COLUMN_KEYWORD, keys);
+    std::string uriStr;
+    {
+        std::lock_guard<ffrt::mutex> lock(g_settingMutex);
+        uriStr = SETTING_URI_PROXY_USER + GetUriPrefix(currentUserId_, keys.front());
+    }
+    Uri uri(uriStr);
+    auto resultSet = helper->Query(uri, predicates, columns);
+    ReleaseDataShareHelper(helper);
+    if (resultSet == nullptr) {
+        POWER_HILOGE(COMP_UTILS, "helper->Query return nullptr");
+        IPCSkeleton::SetCallingIdentity(callingIdentity);
+        return ERR_INVALID_OPERATION;
+    }
+    const int32_t KEY_INDEX = 0;
+    const int32_t VALUE_INDEX = 1;
+    int32_t count = 0;
+    resultSet->GetRowCount(count);
+    for (int32_t row = 0; row < count; row++) {
+        std::string key;
+        std::string value;
+        if (resultSet->GoToRow(row) != NativeRdb::E_OK || resultSet->GetString(KEY_INDEX, key) != NativeRdb::E_OK ||
+            resultSet->GetString(VALUE_INDEX, value) != NativeRdb::E_OK) {
+            POWER_HILOGW(COMP_UTILS, "resultSet read row %{public}d failed", row);
+            continue;
+        }
+        values[key] = value;
+    }
+    resultSet->Close();
+    IPCSkeleton::SetCallingIdentity(callingIdentity);
+    POWER_HILOGI(COMP_UTILS, "batch query %{public}zu keys, found %{public}d", keys.size(), count);
+    return ERR_OK;
+}
+
 ErrCode SettingProvider::PutStringValue(const std::string& key, const std::string& value, bool needNotify)
 {
     std::string callingIdentity = IPCSkeleton::ResetCallingIdentity();